@@ -0,0 +1,78 @@
+#include "storm-bench/harness/Benchmark.h"
+#include "storm-bench/benchmarks/RandomMatrices.h"
+
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+namespace storm {
+    namespace bench {
+
+        namespace {
+            /*!
+             * Creates a matrix with many small SCCs (successors mostly lie ahead, only few transitions lead back).
+             */
+            RandomMatrixOptions getDecompositionMatrixOptions(uint64_t numberOfStates, uint64_t maxChoicesPerState) {
+                RandomMatrixOptions options;
+                options.numberOfStates = numberOfStates;
+                options.maxChoicesPerState = maxChoicesPerState;
+                options.maxSuccessorsPerChoice = 3;
+                options.backwardRange = 4;
+                options.forwardRange = 16;
+                return options;
+            }
+
+            class SccDecompositionBenchmark : public Benchmark {
+            public:
+                SccDecompositionBenchmark(bool topologicalSort) : topologicalSort(topologicalSort) {
+                    // Intentionally left empty.
+                }
+
+                void setUp(BenchmarkParameters const& parameters) override {
+                    matrix = createRandomMatrix(getDecompositionMatrixOptions(parameters.scale * 200000, 1));
+                    setStatistic("states", matrix.getRowCount());
+                    setStatistic("entries", matrix.getEntryCount());
+                    setStatistic("sccs", storm::storage::StronglyConnectedComponentDecomposition<double>(matrix).size());
+                }
+
+                void run() override {
+                    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+                    options.forceTopologicalSort(topologicalSort);
+                    storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix, options);
+                    consume(static_cast<uint64_t>(decomposition.size()));
+                }
+
+            private:
+                bool topologicalSort;
+                storm::storage::SparseMatrix<double> matrix;
+            };
+
+            class MecDecompositionBenchmark : public Benchmark {
+            public:
+                void setUp(BenchmarkParameters const& parameters) override {
+                    matrix = createRandomMatrix(getDecompositionMatrixOptions(parameters.scale * 50000, 3));
+                    backwardTransitions = matrix.transpose(true);
+                    setStatistic("states", matrix.getRowGroupCount());
+                    setStatistic("choices", matrix.getRowCount());
+                    setStatistic("entries", matrix.getEntryCount());
+                    setStatistic("mecs", storm::storage::MaximalEndComponentDecomposition<double>(matrix, backwardTransitions).size());
+                }
+
+                void run() override {
+                    storm::storage::MaximalEndComponentDecomposition<double> decomposition(matrix, backwardTransitions);
+                    consume(static_cast<uint64_t>(decomposition.size()));
+                }
+
+            private:
+                storm::storage::SparseMatrix<double> matrix;
+                storm::storage::SparseMatrix<double> backwardTransitions;
+            };
+        }
+
+        void registerDecompositionBenchmarks(BenchmarkRegistry& registry) {
+            registry.add<SccDecompositionBenchmark>("decomposition", "scc", "SCC decomposition of a random graph with many small SCCs.", false);
+            registry.add<SccDecompositionBenchmark>("decomposition", "scc-topological", "SCC decomposition (with topological sort) of a random graph with many small SCCs.", true);
+            registry.add<MecDecompositionBenchmark>("decomposition", "mec", "MEC decomposition of a random MDP.");
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#include "storm-bench/harness/Benchmark.h"
+
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/prism.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace bench {
+
+        namespace {
+            typedef std::function<std::string(uint64_t)> ConstantDefinitionGenerator;
+
+            /*!
+             * Describes a scalable PRISM model: the file and how the constants are defined for a given scale.
+             */
+            struct ScalableModel {
+                std::string filename;
+                ConstantDefinitionGenerator constants;
+            };
+
+            ScalableModel mdpRobotGrid() {
+                return {STORM_SOURCE_DIR "/resources/examples/benchmarks/mdp/robotGrid.nm", [] (uint64_t scale) { return "N=" + std::to_string(4 + 4 * scale); }};
+            }
+
+            ScalableModel smgRobotGrid() {
+                return {STORM_SOURCE_DIR "/resources/examples/benchmarks/smg/robotGrid.nm", [] (uint64_t scale) { return "N=" + std::to_string(4 + 4 * scale); }};
+            }
+
+            ScalableModel mdpCoin() {
+                return {STORM_TEST_RESOURCES_DIR "/mdp/coin2.nm", [] (uint64_t scale) { return "K=" + std::to_string(32 * scale); }};
+            }
+
+            /*!
+             * Base class for benchmarks on a PRISM program with a single property.
+             */
+            class PrismBenchmark : public Benchmark {
+            public:
+                PrismBenchmark(ScalableModel const& model, std::string const& property) : model(model), propertyString(property) {
+                    // Intentionally left empty.
+                }
+
+                void setUp(BenchmarkParameters const& parameters) override {
+                    program = storm::utility::prism::preprocess(storm::api::parseProgram(model.filename), model.constants(parameters.scale));
+                    auto properties = storm::api::parsePropertiesForPrismProgram(propertyString, program);
+                    STORM_LOG_THROW(properties.size() == 1, storm::exceptions::UnexpectedException, "Expected exactly one property.");
+                    property = properties.front();
+                    formulas = storm::api::extractFormulasFromProperties(properties);
+                }
+
+            protected:
+                std::shared_ptr<storm::models::sparse::Model<double>> buildModel() {
+                    auto result = storm::api::buildSparseModel<double>(program, formulas);
+                    setStatistic("states", result->getNumberOfStates());
+                    setStatistic("transitions", result->getNumberOfTransitions());
+                    setStatistic("choices", result->getNumberOfChoices());
+                    return result;
+                }
+
+                storm::prism::Program program;
+                storm::jani::Property property;
+                std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+
+            private:
+                ScalableModel model;
+                std::string propertyString;
+            };
+
+            class BuildBenchmark : public PrismBenchmark {
+            public:
+                BuildBenchmark(ScalableModel const& model, std::string const& property) : PrismBenchmark(model, property) {
+                    // Intentionally left empty.
+                }
+
+                void run() override {
+                    consume(static_cast<uint64_t>(buildModel()->getNumberOfStates()));
+                }
+            };
+
+            /*!
+             * Checks (and, if the property is a shielding property, creates a shield for) the property on the prebuilt model.
+             */
+            class CheckBenchmark : public PrismBenchmark {
+            public:
+                CheckBenchmark(ScalableModel const& model, std::string const& property) : PrismBenchmark(model, property) {
+                    // Intentionally left empty.
+                }
+
+                void setUp(BenchmarkParameters const& parameters) override {
+                    PrismBenchmark::setUp(parameters);
+                    sparseModel = buildModel();
+                }
+
+                void run() override {
+                    auto task = storm::api::createTask<double>(property.getRawFormula(), true);
+                    if (property.isShieldingProperty()) {
+                        task.setShieldingExpression(property.getShieldingExpression());
+                    }
+                    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(env, sparseModel, task);
+                    STORM_LOG_THROW(result, storm::exceptions::UnexpectedException, "Model checking did not yield a result.");
+                    consume(static_cast<uint64_t>(result->isQuantitative()));
+                }
+
+                void tearDown() override {
+                    sparseModel.reset();
+                }
+
+            private:
+                storm::Environment env;
+                std::shared_ptr<storm::models::sparse::Model<double>> sparseModel;
+            };
+        }
+
+        void registerModelBenchmarks(BenchmarkRegistry& registry) {
+            registry.add<BuildBenchmark>("build", "mdp-coin", "Explicit state space construction of the consensus protocol (coin2.nm).", mdpCoin(), "Pmin=? [ F (\"finished\" & \"all_coins_equal_1\") ]");
+            registry.add<BuildBenchmark>("build", "mdp-robot-grid", "Explicit state space construction of the robot MDP.", mdpRobotGrid(), "Pmax=? [ !\"crash\" U \"goal\" ]");
+            registry.add<BuildBenchmark>("build", "smg-robot-grid", "Explicit state space construction of the robot game.", smgRobotGrid(), "<<robot>> Pmax=? [ !\"crash\" U \"goal\" ]");
+
+            registry.add<CheckBenchmark>("check", "mdp-until", "Unbounded until on the robot MDP.", mdpRobotGrid(), "Pmax=? [ !\"crash\" U \"goal\" ]");
+            registry.add<CheckBenchmark>("check", "rpatl-until", "rPATL unbounded until on the robot game.", smgRobotGrid(), "<<robot>> Pmax=? [ !\"crash\" U \"goal\" ]");
+            registry.add<CheckBenchmark>("check", "rpatl-lra", "Long-run average rewards on the robot game.", smgRobotGrid(), "<<robot>> R{\"crashes\"}min=? [ LRA ]");
+
+            registry.add<CheckBenchmark>("shield", "mdp-pre-safety", "Pre-safety shield construction for the robot MDP.", mdpRobotGrid(), "<PreSafety, lambda=0.9> Pmin=? [ F<=10 \"crash\" ]");
+            registry.add<CheckBenchmark>("shield", "mdp-post-safety", "Post-safety shield construction for the robot MDP.", mdpRobotGrid(), "<PostSafety, gamma=0.9> Pmin=? [ F<=10 \"crash\" ]");
+            registry.add<CheckBenchmark>("shield", "smg-pre-safety", "Pre-safety shield construction for the robot game.", smgRobotGrid(), "<PreSafety, lambda=0.9> <<robot>> Pmin=? [ F<=10 \"crash\" ]");
+            registry.add<CheckBenchmark>("shield", "smg-post-safety", "Post-safety shield construction for the robot game.", smgRobotGrid(), "<PostSafety, gamma=0.9> <<robot>> Pmin=? [ F<=10 \"crash\" ]");
+        }
+    }
+}
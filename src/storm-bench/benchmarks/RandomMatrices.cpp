@@ -0,0 +1,45 @@
+#include "storm-bench/benchmarks/RandomMatrices.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace bench {
+
+        storm::storage::SparseMatrix<double> createRandomMatrix(RandomMatrixOptions const& options) {
+            STORM_LOG_THROW(options.numberOfStates > 0 && options.maxChoicesPerState > 0 && options.maxSuccessorsPerChoice > 0, storm::exceptions::InvalidArgumentException, "Invalid options for random matrix.");
+            std::mt19937_64 engine(options.seed);
+            bool hasRowGrouping = options.maxChoicesPerState > 1;
+            storm::storage::SparseMatrixBuilder<double> builder(0, options.numberOfStates, 0, false, hasRowGrouping);
+
+            std::vector<uint64_t> successors;
+            uint64_t row = 0;
+            for (uint64_t state = 0; state < options.numberOfStates; ++state) {
+                if (hasRowGrouping) {
+                    builder.newRowGroup(row);
+                }
+                uint64_t lowest = state >= options.backwardRange ? state - options.backwardRange : 0;
+                uint64_t highest = std::min(state + options.forwardRange, options.numberOfStates - 1);
+                uint64_t numberOfChoices = 1 + engine() % options.maxChoicesPerState;
+                for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+                    uint64_t numberOfSuccessors = 1 + engine() % options.maxSuccessorsPerChoice;
+                    successors.clear();
+                    for (uint64_t i = 0; i < numberOfSuccessors; ++i) {
+                        successors.push_back(lowest + engine() % (highest - lowest + 1));
+                    }
+                    std::sort(successors.begin(), successors.end());
+                    successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+                    double probability = 1.0 / successors.size();
+                    for (auto const& successor : successors) {
+                        builder.addNextValue(row, successor, probability);
+                    }
+                }
+            }
+            return builder.build(row, options.numberOfStates, hasRowGrouping ? options.numberOfStates : 0);
+        }
+    }
+}
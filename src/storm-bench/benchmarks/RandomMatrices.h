@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace bench {
+
+        struct RandomMatrixOptions {
+            uint64_t numberOfStates = 1000;
+            /// Each state gets between one and this many choices. If this is one, the matrix has the trivial row grouping.
+            uint64_t maxChoicesPerState = 1;
+            /// Each choice gets between one and this many successors.
+            uint64_t maxSuccessorsPerChoice = 8;
+            /// Successors of state i are drawn from [i - backwardRange, i + forwardRange]. Small backward ranges yield many small SCCs.
+            uint64_t backwardRange = 1000;
+            uint64_t forwardRange = 1000;
+            uint64_t seed = 42;
+        };
+
+        /*!
+         * Creates a (sub-)stochastic matrix whose structure is determined by the given options.
+         * Only the random engine (and not std's distributions, whose results are implementation-defined) is used, so the same options yield the
+         * same matrix on all platforms.
+         */
+        storm::storage::SparseMatrix<double> createRandomMatrix(RandomMatrixOptions const& options);
+    }
+}
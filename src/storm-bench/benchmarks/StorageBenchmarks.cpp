@@ -0,0 +1,208 @@
+#include "storm-bench/harness/Benchmark.h"
+#include "storm-bench/benchmarks/RandomMatrices.h"
+
+#include <random>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/solver/Multiplier.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace bench {
+
+        namespace {
+            storm::storage::BitVector createRandomBitVector(uint64_t size, std::mt19937_64& engine) {
+                storm::storage::BitVector result(size);
+                for (uint64_t index = 0; index + 64 <= size; index += 64) {
+                    result.setFromInt(index, 64, engine());
+                }
+                return result;
+            }
+
+            class BitVectorOperationsBenchmark : public Benchmark {
+            public:
+                void setUp(BenchmarkParameters const& parameters) override {
+                    std::mt19937_64 engine(42);
+                    uint64_t size = parameters.scale * (1ull << 22);
+                    first = createRandomBitVector(size, engine);
+                    second = createRandomBitVector(size, engine);
+                    setStatistic("bits", size);
+                }
+
+                void run() override {
+                    uint64_t checksum = 0;
+                    for (uint64_t iteration = 0; iteration < 10; ++iteration) {
+                        storm::storage::BitVector conjunction = first & second;
+                        storm::storage::BitVector disjunction = first | second;
+                        storm::storage::BitVector complement = ~first;
+                        checksum += conjunction.getNumberOfSetBits() + disjunction.getNumberOfSetBits() + complement.getNumberOfSetBits();
+                        checksum += conjunction.isSubsetOf(disjunction) ? 1 : 0;
+                    }
+                    consume(checksum);
+                }
+
+            private:
+                storm::storage::BitVector first;
+                storm::storage::BitVector second;
+            };
+
+            class BitVectorIterationBenchmark : public Benchmark {
+            public:
+                void setUp(BenchmarkParameters const& parameters) override {
+                    std::mt19937_64 engine(42);
+                    uint64_t size = parameters.scale * (1ull << 22);
+                    // Combining several random vectors yields a sparse vector (roughly one eighth of the bits is set).
+                    bits = createRandomBitVector(size, engine) & createRandomBitVector(size, engine) & createRandomBitVector(size, engine);
+                    setStatistic("bits", size);
+                    setStatistic("set-bits", bits.getNumberOfSetBits());
+                }
+
+                void run() override {
+                    uint64_t checksum = 0;
+                    for (uint64_t iteration = 0; iteration < 5; ++iteration) {
+                        for (auto index : bits) {
+                            checksum += index;
+                        }
+                        checksum += bits.getNumberOfSetBitsBeforeIndex(bits.size() / 2);
+                    }
+                    consume(checksum);
+                }
+
+            private:
+                storm::storage::BitVector bits;
+            };
+
+            class BitVectorHashMapBenchmark : public Benchmark {
+            public:
+                void setUp(BenchmarkParameters const& parameters) override {
+                    // The keys mimic compressed state valuations as they occur during model building.
+                    std::mt19937_64 engine(42);
+                    uint64_t numberOfKeys = parameters.scale * 200000;
+                    keys.reserve(numberOfKeys);
+                    for (uint64_t i = 0; i < numberOfKeys; ++i) {
+                        storm::storage::BitVector key(bucketSize);
+                        key.setFromInt(0, 64, engine());
+                        key.setFromInt(64, bucketSize - 64, engine() % (1ull << (bucketSize - 64)));
+                        keys.push_back(std::move(key));
+                    }
+                    setStatistic("keys", numberOfKeys);
+                }
+
+                void run() override {
+                    storm::storage::BitVectorHashMap<uint64_t> map(bucketSize);
+                    for (auto const& key : keys) {
+                        map.findOrAdd(key, map.size());
+                    }
+                    uint64_t checksum = 0;
+                    for (auto const& key : keys) {
+                        checksum += map.getValue(key);
+                    }
+                    consume(checksum + map.size());
+                }
+
+            private:
+                uint64_t const bucketSize = 96;
+                std::vector<storm::storage::BitVector> keys;
+            };
+
+            class MatrixVectorMultiplicationBenchmark : public Benchmark {
+            public:
+                void setUp(BenchmarkParameters const& parameters) override {
+                    RandomMatrixOptions options;
+                    options.numberOfStates = parameters.scale * 200000;
+                    matrix = createRandomMatrix(options);
+                    x = std::vector<double>(matrix.getColumnCount(), 0.5);
+                    result = std::vector<double>(matrix.getRowCount());
+                    setStatistic("rows", matrix.getRowCount());
+                    setStatistic("entries", matrix.getEntryCount());
+                }
+
+                void run() override {
+                    for (uint64_t iteration = 0; iteration < 20; ++iteration) {
+                        matrix.multiplyWithVector(x, result);
+                        std::swap(x, result);
+                    }
+                    consume(x.front());
+                }
+
+            private:
+                storm::storage::SparseMatrix<double> matrix;
+                std::vector<double> x;
+                std::vector<double> result;
+            };
+
+            class MultiplyAndReduceBenchmark : public Benchmark {
+            public:
+                MultiplyAndReduceBenchmark(storm::solver::MultiplierType const& type) : type(type) {
+                    // Intentionally left empty.
+                }
+
+                void setUp(BenchmarkParameters const& parameters) override {
+                    RandomMatrixOptions options;
+                    options.numberOfStates = parameters.scale * 100000;
+                    options.maxChoicesPerState = 4;
+                    matrix = createRandomMatrix(options);
+                    b = std::vector<double>(matrix.getRowCount(), 0.01);
+                    x = std::vector<double>(matrix.getColumnCount(), 0.5);
+                    result = std::vector<double>(matrix.getColumnCount());
+                    env.solver().multiplier().setType(type);
+                    setStatistic("states", matrix.getRowGroupCount());
+                    setStatistic("rows", matrix.getRowCount());
+                    setStatistic("entries", matrix.getEntryCount());
+                }
+
+                void run() override {
+                    auto multiplier = storm::solver::MultiplierFactory<double>().create(env, matrix);
+                    for (uint64_t iteration = 0; iteration < 20; ++iteration) {
+                        multiplier->multiplyAndReduce(env, storm::solver::OptimizationDirection::Maximize, x, &b, result);
+                        std::swap(x, result);
+                    }
+                    consume(x.front());
+                }
+
+            private:
+                storm::solver::MultiplierType type;
+                storm::Environment env;
+                storm::storage::SparseMatrix<double> matrix;
+                std::vector<double> b;
+                std::vector<double> x;
+                std::vector<double> result;
+            };
+
+            class TransposeBenchmark : public Benchmark {
+            public:
+                void setUp(BenchmarkParameters const& parameters) override {
+                    RandomMatrixOptions options;
+                    options.numberOfStates = parameters.scale * 100000;
+                    options.maxChoicesPerState = 4;
+                    matrix = createRandomMatrix(options);
+                    setStatistic("rows", matrix.getRowCount());
+                    setStatistic("entries", matrix.getEntryCount());
+                }
+
+                void run() override {
+                    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+                    consume(static_cast<uint64_t>(backwardTransitions.getEntryCount()));
+                }
+
+            private:
+                storm::storage::SparseMatrix<double> matrix;
+            };
+        }
+
+        void registerStorageBenchmarks(BenchmarkRegistry& registry) {
+            registry.add<BitVectorOperationsBenchmark>("storage", "bitvector-operations", "Conjunction, disjunction, complement and subset checks on random bit vectors.");
+            registry.add<BitVectorIterationBenchmark>("storage", "bitvector-iteration", "Iteration over the set bits of a sparse bit vector.");
+            registry.add<BitVectorHashMapBenchmark>("storage", "bitvector-hashmap", "Insertion and lookup of compressed states in a BitVectorHashMap.");
+            registry.add<MatrixVectorMultiplicationBenchmark>("storage", "matrix-multiply", "Repeated matrix-vector multiplication with a random stochastic matrix.");
+            registry.add<MultiplyAndReduceBenchmark>("storage", "matrix-multiply-reduce-native", "Repeated multiplyAndReduce with the native multiplier on a random MDP matrix.", storm::solver::MultiplierType::Native);
+            registry.add<MultiplyAndReduceBenchmark>("storage", "matrix-multiply-reduce-gmmxx", "Repeated multiplyAndReduce with the gmm++ multiplier on a random MDP matrix.", storm::solver::MultiplierType::Gmmxx);
+            registry.add<TransposeBenchmark>("storage", "matrix-transpose", "Computation of the backward transitions of a random MDP matrix.");
+        }
+    }
+}
@@ -0,0 +1,55 @@
+#include "storm-bench/harness/Benchmark.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace bench {
+
+        namespace {
+            // Values passed to consume are written here. As the variable is volatile, the writes (and thus the computations) can not be removed.
+            volatile uint64_t integerSink = 0;
+            volatile double doubleSink = 0.0;
+        }
+
+        void Benchmark::setUp(BenchmarkParameters const&) {
+            // Intentionally left empty.
+        }
+
+        void Benchmark::tearDown() {
+            // Intentionally left empty.
+        }
+
+        std::map<std::string, uint64_t> const& Benchmark::getStatistics() const {
+            return statistics;
+        }
+
+        void Benchmark::setStatistic(std::string const& name, uint64_t value) {
+            statistics[name] = value;
+        }
+
+        void Benchmark::consume(uint64_t value) {
+            integerSink = value;
+        }
+
+        void Benchmark::consume(double value) {
+            doubleSink = value;
+        }
+
+        std::string BenchmarkRegistry::Entry::getFullName() const {
+            return group + "/" + name;
+        }
+
+        void BenchmarkRegistry::add(std::string const& group, std::string const& name, std::string const& description, BenchmarkFactory const& factory) {
+            Entry entry{group, name, description, factory};
+            for (auto const& other : entries) {
+                STORM_LOG_THROW(other.getFullName() != entry.getFullName(), storm::exceptions::InvalidArgumentException, "Benchmark '" << entry.getFullName() << "' is registered twice.");
+            }
+            entries.push_back(std::move(entry));
+        }
+
+        std::vector<BenchmarkRegistry::Entry> const& BenchmarkRegistry::getEntries() const {
+            return entries;
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace storm {
+    namespace bench {
+
+        /*!
+         * Parameters that are shared by all benchmarks of a run.
+         */
+        struct BenchmarkParameters {
+            /// Factor with which the size of the benchmark instances is scaled.
+            uint64_t scale = 1;
+        };
+
+        /*!
+         * A single benchmark. The harness calls setUp once, then run for every (warm-up and measured) repetition and finally tearDown.
+         * Only run is measured, so expensive preparations (parsing, building input matrices, ...) belong to setUp.
+         * As run is called repeatedly, it must not depend on effects of previous calls.
+         */
+        class Benchmark {
+        public:
+            virtual ~Benchmark() = default;
+
+            virtual void setUp(BenchmarkParameters const& parameters);
+            virtual void run() = 0;
+            virtual void tearDown();
+
+            /*!
+             * Retrieves statistics describing the benchmark instance (e.g. the number of states). They are exported along with the
+             * timings such that changes of the instance itself (rather than of its runtime) can be detected.
+             */
+            std::map<std::string, uint64_t> const& getStatistics() const;
+
+        protected:
+            void setStatistic(std::string const& name, uint64_t value);
+
+            /*!
+             * Consumes the given value such that the compiler can not optimize away its computation.
+             */
+            void consume(uint64_t value);
+            void consume(double value);
+
+        private:
+            std::map<std::string, uint64_t> statistics;
+        };
+
+        class BenchmarkRegistry {
+        public:
+            typedef std::function<std::unique_ptr<Benchmark>()> BenchmarkFactory;
+
+            struct Entry {
+                std::string group;
+                std::string name;
+                std::string description;
+                BenchmarkFactory factory;
+
+                /*!
+                 * Retrieves the name of the benchmark that is used for filtering and reporting, i.e. <group>/<name>.
+                 */
+                std::string getFullName() const;
+            };
+
+            void add(std::string const& group, std::string const& name, std::string const& description, BenchmarkFactory const& factory);
+
+            template<typename BenchmarkType, typename... Args>
+            void add(std::string const& group, std::string const& name, std::string const& description, Args... args) {
+                add(group, name, description, [args...] () -> std::unique_ptr<Benchmark> { return std::make_unique<BenchmarkType>(args...); });
+            }
+
+            std::vector<Entry> const& getEntries() const;
+
+        private:
+            std::vector<Entry> entries;
+        };
+
+        /*!
+         * Adds the micro-benchmarks for the storage classes (bit vectors, hash maps and sparse matrices) to the given registry.
+         */
+        void registerStorageBenchmarks(BenchmarkRegistry& registry);
+
+        /*!
+         * Adds the micro-benchmarks for graph decompositions (SCCs and MECs) to the given registry.
+         */
+        void registerDecompositionBenchmarks(BenchmarkRegistry& registry);
+
+        /*!
+         * Adds the macro-benchmarks (model building, model checking and shield construction) to the given registry.
+         */
+        void registerModelBenchmarks(BenchmarkRegistry& registry);
+    }
+}
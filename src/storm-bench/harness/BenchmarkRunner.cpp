@@ -0,0 +1,168 @@
+#include "storm-bench/harness/BenchmarkRunner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <thread>
+
+#include "storm-version-info/storm-version.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace bench {
+
+        namespace {
+            // Increase this whenever the layout of the exported results changes in an incompatible way.
+            uint64_t const formatVersion = 1;
+
+            std::string dirtyStateToString(storm::StormVersion::DirtyState const& state) {
+                switch (state) {
+                    case storm::StormVersion::DirtyState::Clean:
+                        return "clean";
+                    case storm::StormVersion::DirtyState::Dirty:
+                        return "dirty";
+                    default:
+                        return "unknown";
+                }
+            }
+        }
+
+        BenchmarkRunner::BenchmarkRunner(BenchmarkParameters const& parameters, uint64_t repetitions, uint64_t warmupRepetitions) : parameters(parameters), repetitions(repetitions), warmupRepetitions(warmupRepetitions) {
+            STORM_LOG_THROW(repetitions > 0, storm::exceptions::InvalidArgumentException, "At least one measured repetition is required.");
+        }
+
+        BenchmarkResult BenchmarkRunner::run(BenchmarkRegistry::Entry const& entry) const {
+            std::unique_ptr<Benchmark> benchmark = entry.factory();
+            benchmark->setUp(parameters);
+            for (uint64_t repetition = 0; repetition < warmupRepetitions; ++repetition) {
+                benchmark->run();
+            }
+
+            BenchmarkResult result;
+            result.group = entry.group;
+            result.name = entry.name;
+            result.times.reserve(repetitions);
+            for (uint64_t repetition = 0; repetition < repetitions; ++repetition) {
+                auto start = std::chrono::steady_clock::now();
+                benchmark->run();
+                auto end = std::chrono::steady_clock::now();
+                result.times.push_back(std::chrono::duration<double>(end - start).count());
+            }
+            benchmark->tearDown();
+            result.statistics = benchmark->getStatistics();
+
+            std::vector<double> sortedTimes = result.times;
+            std::sort(sortedTimes.begin(), sortedTimes.end());
+            uint64_t middle = sortedTimes.size() / 2;
+            result.minimum = sortedTimes.front();
+            result.median = sortedTimes.size() % 2 == 0 ? (sortedTimes[middle - 1] + sortedTimes[middle]) / 2.0 : sortedTimes[middle];
+            result.mean = std::accumulate(sortedTimes.begin(), sortedTimes.end(), 0.0) / sortedTimes.size();
+            double squaredDeviations = 0.0;
+            for (auto const& time : sortedTimes) {
+                squaredDeviations += (time - result.mean) * (time - result.mean);
+            }
+            result.standardDeviation = sortedTimes.size() > 1 ? std::sqrt(squaredDeviations / (sortedTimes.size() - 1)) : 0.0;
+            return result;
+        }
+
+        storm::json<double> BenchmarkRunner::toJson(std::vector<BenchmarkResult> const& results) const {
+            storm::json<double> document;
+            document["format-version"] = formatVersion;
+            document["storm-version"] = storm::StormVersion::shortVersionString();
+            document["git-revision"] = storm::StormVersion::gitRevisionHash;
+            document["git-state"] = dirtyStateToString(storm::StormVersion::dirty);
+            document["system"] = storm::StormVersion::systemName + " " + storm::StormVersion::systemVersion;
+            document["compiler"] = storm::StormVersion::cxxCompiler;
+            document["cxx-flags"] = storm::StormVersion::cxxFlags;
+            document["hardware-threads"] = static_cast<uint64_t>(std::thread::hardware_concurrency());
+            document["scale"] = parameters.scale;
+            document["repetitions"] = repetitions;
+            document["warmup"] = warmupRepetitions;
+            document["time-unit"] = "s";
+
+            storm::json<double> benchmarksJson = storm::json<double>::object();
+            for (auto const& result : results) {
+                storm::json<double> resultJson;
+                resultJson["group"] = result.group;
+                resultJson["name"] = result.name;
+                resultJson["times"] = result.times;
+                resultJson["min"] = result.minimum;
+                resultJson["median"] = result.median;
+                resultJson["mean"] = result.mean;
+                resultJson["stddev"] = result.standardDeviation;
+                resultJson["statistics"] = storm::json<double>::object();
+                for (auto const& statistic : result.statistics) {
+                    resultJson["statistics"][statistic.first] = statistic.second;
+                }
+                benchmarksJson[result.group + "/" + result.name] = std::move(resultJson);
+            }
+            document["benchmarks"] = std::move(benchmarksJson);
+            return document;
+        }
+
+        std::vector<BenchmarkComparison> BenchmarkRunner::compare(std::vector<BenchmarkResult> const& results, storm::json<double> const& baseline, double tolerance) const {
+            STORM_LOG_THROW(baseline.count("format-version") > 0 && baseline["format-version"].get<uint64_t>() == formatVersion, storm::exceptions::InvalidArgumentException, "The baseline has an unsupported format.");
+            STORM_LOG_THROW(baseline["scale"].get<uint64_t>() == parameters.scale, storm::exceptions::InvalidArgumentException, "The baseline was obtained with scale " << baseline["scale"].get<uint64_t>() << " but the current scale is " << parameters.scale << ".");
+            STORM_LOG_WARN_COND(baseline["hardware-threads"].get<uint64_t>() == std::thread::hardware_concurrency(), "The baseline was obtained on a machine with a different number of hardware threads.");
+
+            std::vector<BenchmarkComparison> comparisons;
+            auto const& baselineBenchmarks = baseline["benchmarks"];
+            for (auto const& result : results) {
+                std::string fullName = result.group + "/" + result.name;
+                auto baselineIt = baselineBenchmarks.find(fullName);
+                if (baselineIt == baselineBenchmarks.end()) {
+                    STORM_LOG_INFO("Benchmark " << fullName << " does not appear in the baseline.");
+                    continue;
+                }
+                BenchmarkComparison comparison;
+                comparison.name = fullName;
+                comparison.baselineMedian = (*baselineIt)["median"].get<double>();
+                comparison.median = result.median;
+                comparison.relativeChange = comparison.baselineMedian > 0.0 ? (comparison.median - comparison.baselineMedian) / comparison.baselineMedian : 0.0;
+                comparison.regressed = comparison.relativeChange > tolerance;
+                comparison.statisticsDiffer = false;
+                auto const& baselineStatistics = (*baselineIt)["statistics"];
+                for (auto const& statistic : result.statistics) {
+                    auto statisticIt = baselineStatistics.find(statistic.first);
+                    if (statisticIt != baselineStatistics.end() && statisticIt->get<uint64_t>() != statistic.second) {
+                        comparison.statisticsDiffer = true;
+                    }
+                }
+                comparisons.push_back(std::move(comparison));
+            }
+            return comparisons;
+        }
+
+        void printResult(std::ostream& out, BenchmarkResult const& result) {
+            out << std::left << std::setw(48) << (result.group + "/" + result.name) << std::right << std::fixed << std::setprecision(6)
+                << " median " << std::setw(12) << result.median << "s"
+                << "  min " << std::setw(12) << result.minimum << "s"
+                << "  stddev " << std::setw(10) << result.standardDeviation << "s";
+            out.unsetf(std::ios_base::floatfield);
+            for (auto const& statistic : result.statistics) {
+                out << "  " << statistic.first << "=" << statistic.second;
+            }
+            out << '\n';
+        }
+
+        void printComparisons(std::ostream& out, std::vector<BenchmarkComparison> const& comparisons) {
+            for (auto const& comparison : comparisons) {
+                out << std::left << std::setw(48) << comparison.name << std::right << std::fixed << std::setprecision(6)
+                    << " baseline " << std::setw(12) << comparison.baselineMedian << "s"
+                    << "  current " << std::setw(12) << comparison.median << "s"
+                    << "  " << std::showpos << std::setprecision(1) << std::setw(7) << (100.0 * comparison.relativeChange) << "%" << std::noshowpos;
+                out.unsetf(std::ios_base::floatfield);
+                if (comparison.regressed) {
+                    out << "  REGRESSION";
+                }
+                if (comparison.statisticsDiffer) {
+                    out << "  (instance changed)";
+                }
+                out << '\n';
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <ostream>
+
+#include "storm-bench/harness/Benchmark.h"
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+    namespace bench {
+
+        struct BenchmarkResult {
+            std::string group;
+            std::string name;
+
+            /// The runtimes (in seconds) of the measured repetitions.
+            std::vector<double> times;
+            double minimum;
+            double median;
+            double mean;
+            double standardDeviation;
+
+            std::map<std::string, uint64_t> statistics;
+        };
+
+        /*!
+         * The result of comparing a benchmark with a previous (baseline) run.
+         */
+        struct BenchmarkComparison {
+            std::string name;
+            double baselineMedian;
+            double median;
+            /// The relative change of the median runtime, i.e. (median - baselineMedian) / baselineMedian.
+            double relativeChange;
+            bool regressed;
+            bool statisticsDiffer;
+        };
+
+        class BenchmarkRunner {
+        public:
+            BenchmarkRunner(BenchmarkParameters const& parameters, uint64_t repetitions, uint64_t warmupRepetitions);
+
+            /*!
+             * Sets up the given benchmark, runs it for the configured number of times and evaluates the measured runtimes.
+             */
+            BenchmarkResult run(BenchmarkRegistry::Entry const& entry) const;
+
+            /*!
+             * Converts the given results to JSON. Apart from the results, the document contains the parameters of the run as well as
+             * information about the build (version, git revision, compiler flags) such that results of different commits can be compared.
+             */
+            storm::json<double> toJson(std::vector<BenchmarkResult> const& results) const;
+
+            /*!
+             * Compares the given results with the baseline (as obtained by toJson). Benchmarks that do not appear in both are skipped.
+             *
+             * @param tolerance The relative slowdown of the median runtime above which a benchmark is considered to have regressed.
+             */
+            std::vector<BenchmarkComparison> compare(std::vector<BenchmarkResult> const& results, storm::json<double> const& baseline, double tolerance) const;
+
+        private:
+            BenchmarkParameters parameters;
+            uint64_t repetitions;
+            uint64_t warmupRepetitions;
+        };
+
+        void printResult(std::ostream& out, BenchmarkResult const& result);
+        void printComparisons(std::ostream& out, std::vector<BenchmarkComparison> const& comparisons);
+    }
+}
@@ -0,0 +1,91 @@
+#include "storm-bench/settings/modules/BenchmarkSettings.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/ArgumentBuilder.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+
+            const std::string BenchmarkSettings::moduleName = "benchmark";
+            const std::string listOptionName = "list";
+            const std::string filterOptionName = "filter";
+            const std::string repetitionsOptionName = "repetitions";
+            const std::string warmupOptionName = "warmup";
+            const std::string scaleOptionName = "scale";
+            const std::string exportJsonOptionName = "jsonresult";
+            const std::string baselineOptionName = "baseline";
+            const std::string toleranceOptionName = "tolerance";
+
+            BenchmarkSettings::BenchmarkSettings() : ModuleSettings(moduleName) {
+                this->addOption(storm::settings::OptionBuilder(moduleName, listOptionName, false, "Lists the available benchmarks without running them.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, filterOptionName, false, "Only runs the benchmarks whose name (<group>/<name>) matches the given regular expression.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("regex", "The regular expression.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, repetitionsOptionName, false, "Sets the number of measured runs of each benchmark.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of runs.").setDefaultValueUnsignedInteger(5).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, warmupOptionName, false, "Sets the number of unmeasured runs of each benchmark that precede the measured ones.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of runs.").setDefaultValueUnsignedInteger(1).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, scaleOptionName, false, "Scales the size of the benchmark instances. Results are only comparable for equal scales.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("factor", "The scaling factor.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, exportJsonOptionName, false, "Exports the results in JSON format to the given file.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, baselineOptionName, false, "Compares the results with the ones given in the file (as exported with --" + exportJsonOptionName + "). Storm-bench returns a non-zero exit code if some benchmark regressed.").addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file.").addValidatorString(ArgumentValidatorFactory::createExistingFileValidator()).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, toleranceOptionName, false, "Sets the relative slowdown of the median runtime (w.r.t. the baseline) above which a benchmark is considered to have regressed.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The relative slowdown.").setDefaultValueDouble(0.1).addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(0.0)).build()).build());
+            }
+
+            bool BenchmarkSettings::isListSet() const {
+                return this->getOption(listOptionName).getHasOptionBeenSet();
+            }
+
+            bool BenchmarkSettings::isFilterSet() const {
+                return this->getOption(filterOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BenchmarkSettings::getFilter() const {
+                return this->getOption(filterOptionName).getArgumentByName("regex").getValueAsString();
+            }
+
+            uint64_t BenchmarkSettings::getRepetitions() const {
+                return this->getOption(repetitionsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            uint64_t BenchmarkSettings::getWarmupRepetitions() const {
+                return this->getOption(warmupOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+
+            uint64_t BenchmarkSettings::getScale() const {
+                return this->getOption(scaleOptionName).getArgumentByName("factor").getValueAsUnsignedInteger();
+            }
+
+            bool BenchmarkSettings::isExportJsonSet() const {
+                return this->getOption(exportJsonOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BenchmarkSettings::getExportJsonFilename() const {
+                return this->getOption(exportJsonOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool BenchmarkSettings::isBaselineSet() const {
+                return this->getOption(baselineOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BenchmarkSettings::getBaselineFilename() const {
+                return this->getOption(baselineOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            double BenchmarkSettings::getTolerance() const {
+                return this->getOption(toleranceOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+
+            void BenchmarkSettings::finalize() {
+            }
+
+            bool BenchmarkSettings::check() const {
+                STORM_LOG_THROW(!isListSet() || (!isExportJsonSet() && !isBaselineSet()), storm::exceptions::InvalidArgumentException, "Listing the benchmarks can not be combined with exporting or comparing results.");
+                return true;
+            }
+
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
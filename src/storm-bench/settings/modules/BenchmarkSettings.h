@@ -0,0 +1,87 @@
+#pragma once
+
+#include "storm-config.h"
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+    namespace settings {
+        namespace modules {
+
+            /*!
+             * This class represents the settings for running the benchmark suite.
+             */
+            class BenchmarkSettings : public ModuleSettings {
+            public:
+
+                /*!
+                 * Creates a new set of benchmark settings.
+                 */
+                BenchmarkSettings();
+
+                virtual ~BenchmarkSettings() = default;
+
+                /*!
+                 * Retrieves whether the available benchmarks are to be listed (instead of being executed).
+                 */
+                bool isListSet() const;
+
+                /*!
+                 * Retrieves whether only benchmarks whose name matches a regular expression are to be executed.
+                 */
+                bool isFilterSet() const;
+
+                /*!
+                 * Retrieves the regular expression that restricts the set of executed benchmarks.
+                 */
+                std::string getFilter() const;
+
+                /*!
+                 * Retrieves the number of measured runs of each benchmark.
+                 */
+                uint64_t getRepetitions() const;
+
+                /*!
+                 * Retrieves the number of (unmeasured) runs of each benchmark that precede the measured ones.
+                 */
+                uint64_t getWarmupRepetitions() const;
+
+                /*!
+                 * Retrieves the factor with which the size of the benchmark instances is scaled.
+                 */
+                uint64_t getScale() const;
+
+                /*!
+                 * Retrieves whether the results are to be exported in JSON format.
+                 */
+                bool isExportJsonSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the results are exported.
+                 */
+                std::string getExportJsonFilename() const;
+
+                /*!
+                 * Retrieves whether the results are to be compared with previously exported results.
+                 */
+                bool isBaselineSet() const;
+
+                /*!
+                 * Retrieves the name of the file containing the previously exported results.
+                 */
+                std::string getBaselineFilename() const;
+
+                /*!
+                 * Retrieves the relative slowdown (w.r.t. the baseline) above which a benchmark is considered to have regressed.
+                 */
+                double getTolerance() const;
+
+                bool check() const override;
+                void finalize() override;
+
+                // The name of the module.
+                static const std::string moduleName;
+            };
+
+        } // namespace modules
+    } // namespace settings
+} // namespace storm
@@ -0,0 +1,119 @@
+#include "storm/utility/initialize.h"
+
+#include "storm-bench/settings/BenchSettings.h"
+#include "storm-bench/settings/modules/BenchmarkSettings.h"
+#include "storm-bench/harness/Benchmark.h"
+#include "storm-bench/harness/BenchmarkRunner.h"
+
+#include "storm-cli-utilities/cli.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/BaseException.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <regex>
+
+namespace storm {
+    namespace bench {
+        namespace cli {
+
+            /*!
+             * Runs the selected benchmarks.
+             * @return the exit code, i.e., zero iff no benchmark regressed w.r.t. the baseline (if given).
+             */
+            int processOptions() {
+                auto const& benchmarkSettings = storm::settings::getModule<storm::settings::modules::BenchmarkSettings>();
+
+                BenchmarkRegistry registry;
+                registerStorageBenchmarks(registry);
+                registerDecompositionBenchmarks(registry);
+                registerModelBenchmarks(registry);
+
+                if (benchmarkSettings.isListSet()) {
+                    for (auto const& entry : registry.getEntries()) {
+                        STORM_PRINT(entry.getFullName() << ": " << entry.description << std::endl);
+                    }
+                    return 0;
+                }
+
+                std::regex filter(benchmarkSettings.isFilterSet() ? benchmarkSettings.getFilter() : ".*");
+                BenchmarkParameters parameters;
+                parameters.scale = benchmarkSettings.getScale();
+                BenchmarkRunner runner(parameters, benchmarkSettings.getRepetitions(), benchmarkSettings.getWarmupRepetitions());
+
+                std::vector<BenchmarkResult> results;
+                for (auto const& entry : registry.getEntries()) {
+                    if (!std::regex_search(entry.getFullName(), filter)) {
+                        continue;
+                    }
+                    STORM_LOG_INFO("Running benchmark " << entry.getFullName() << ".");
+                    results.push_back(runner.run(entry));
+                    printResult(std::cout, results.back());
+                }
+                STORM_LOG_WARN_COND(!results.empty(), "No benchmark matches the given filter.");
+
+                if (benchmarkSettings.isExportJsonSet()) {
+                    std::ofstream stream;
+                    storm::utility::openFile(benchmarkSettings.getExportJsonFilename(), stream);
+                    stream << runner.toJson(results).dump(4) << std::endl;
+                    storm::utility::closeFile(stream);
+                }
+
+                if (benchmarkSettings.isBaselineSet()) {
+                    std::ifstream stream;
+                    storm::utility::openFile(benchmarkSettings.getBaselineFilename(), stream);
+                    storm::json<double> baseline;
+                    stream >> baseline;
+                    storm::utility::closeFile(stream);
+
+                    auto comparisons = runner.compare(results, baseline, benchmarkSettings.getTolerance());
+                    STORM_PRINT(std::endl << "Comparison with baseline " << benchmarkSettings.getBaselineFilename() << ":" << std::endl);
+                    printComparisons(std::cout, comparisons);
+                    uint64_t numberOfRegressions = std::count_if(comparisons.begin(), comparisons.end(), [] (BenchmarkComparison const& comparison) { return comparison.regressed; });
+                    if (numberOfRegressions > 0) {
+                        STORM_PRINT(numberOfRegressions << " benchmark(s) regressed by more than " << (100.0 * benchmarkSettings.getTolerance()) << "%." << std::endl);
+                        return 3;
+                    }
+                }
+                return 0;
+            }
+        }
+    }
+}
+
+/*!
+ * Entry point for the benchmark suite.
+ *
+ * @param argc The argc argument of main().
+ * @param argv The argv argument of main().
+ * @return Return code, 0 if successful, 3 if some benchmark regressed w.r.t. the baseline, not 0 otherwise.
+ */
+int main(const int argc, const char** argv) {
+    try {
+        storm::utility::setUp();
+        storm::cli::printHeader("Storm-bench", argc, argv);
+        storm::settings::initializeBenchSettings("Storm-bench", "storm-bench");
+
+        if (!storm::cli::parseOptions(argc, argv)) {
+            return -1;
+        }
+        storm::cli::setUrgentOptions();
+
+        int result = storm::bench::cli::processOptions();
+
+        storm::utility::cleanUp();
+        return result;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused Storm-bench to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused Storm-bench to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
@@ -8,6 +8,7 @@
 #include "storm/utility/initialize.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/profiling.h"
 
 #include <type_traits>
 #include <ctime>
@@ -55,12 +56,21 @@ namespace storm {
                 return -1;
             }
 
+            auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+            if (resourceSettings.isProfilingSet()) {
+                storm::utility::profiling::enable(resourceSettings.isProfilingTraceSet());
+            }
+
             processOptions();
 
             totalTimer.stop();
-            if (storm::settings::getModule<storm::settings::modules::ResourceSettings>().isPrintTimeAndMemorySet()) {
+            if (resourceSettings.isPrintTimeAndMemorySet()) {
                 storm::cli::printTimeAndMemoryStatistics(totalTimer.getTimeInMilliseconds());
             }
+            if (resourceSettings.isProfilingSet()) {
+                storm::utility::profiling::exportReports(resourceSettings.isProfilingReportSet() ? resourceSettings.getProfilingReportFilename() : "",
+                                                         resourceSettings.isProfilingTraceSet() ? resourceSettings.getProfilingTraceFilename() : "");
+            }
 
             storm::utility::cleanUp();
             return 0;
@@ -14,6 +14,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/profiling.h"
 
 #include <type_traits>
 
@@ -69,6 +70,7 @@ namespace storm {
         void parseSymbolicModelDescription(storm::settings::modules::IOSettings const& ioSettings, SymbolicInput& input) {
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             if (ioSettings.isPrismOrJaniInputSet()) {
+                STORM_PROFILE_PHASE("parsing");
                 storm::utility::Stopwatch modelParsingWatch(true);
                 if (ioSettings.isPrismInputSet()) {
                     input.model = storm::api::parseProgram(ioSettings.getPrismInputFilename(), buildSettings.isPrismCompatibilityEnabled(), !buildSettings.isNoSimplifySet());
@@ -460,6 +462,18 @@ namespace storm {
                 options.setAddOverlappingGuardsLabel(true);
             }
 
+            if (buildSettings.isSymmetricModulesSet()) {
+                for (auto const& group : buildSettings.getSymmetricModules()) {
+                    options.addSymmetricModules(group);
+                }
+            }
+            if (buildSettings.isPartialOrderReductionSet()) {
+                // A shield has to cover all states the controlled system may visit, not only those of the reduced model.
+                bool hasShieldingProperty = std::any_of(input.properties.begin(), input.properties.end(), [] (storm::jani::Property const& property) { return property.isShieldingProperty(); });
+                STORM_LOG_WARN_COND(!hasShieldingProperty, "Partial-order reduction is not applied, because shields are to be computed.");
+                options.setPartialOrderReduction(!hasShieldingProperty);
+            }
+
             return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
 
@@ -481,6 +495,7 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename ValueType>
         std::shared_ptr<storm::models::ModelBase> buildModel(SymbolicInput const& input, storm::settings::modules::IOSettings const& ioSettings, ModelProcessingInformation const& mpi) {
+            STORM_PROFILE_PHASE("model building");
             storm::utility::Stopwatch modelBuildingWatch(true);
 
             auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
@@ -552,6 +567,8 @@ namespace storm {
             }
 
             if (mpi.applyBisimulation) {
+                // Shields would be computed for the states and choices of the quotient, which the exported shield can not refer to.
+                STORM_LOG_THROW(!result.first->isOfType(storm::models::ModelType::Smg) || !ioSettings.isExportShieldSet(), storm::exceptions::NotSupportedException, "Exporting shields is not supported in combination with bisimulation minimization of games.");
                 result.first = preprocessSparseModelBisimulation(result.first, input, bisimulationSettings);
                 result.second = true;
             }
@@ -681,6 +698,7 @@ namespace storm {
 
         template <storm::dd::DdType DdType, typename BuildValueType, typename ExportValueType = BuildValueType>
         std::pair<std::shared_ptr<storm::models::ModelBase>, bool> preprocessModel(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+            STORM_PROFILE_PHASE("preprocessing");
             storm::utility::Stopwatch preprocessingWatch(true);
 
             std::pair<std::shared_ptr<storm::models::ModelBase>, bool> result = std::make_pair(model, false);
@@ -870,6 +888,7 @@ namespace storm {
             auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
             for (auto const& property : properties) {
                 printModelCheckingProperty(property);
+                STORM_PROFILE_PHASE("model checking " + property.getName());
                 bool ignored = false;
                 storm::utility::Stopwatch watch(true);
                 std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -992,7 +1011,19 @@ namespace storm {
             STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException, "Exploration does not support other data-types than floating points.");
             verifyProperties<ValueType>(input, [&input,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldExpression) {
                 STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException, "Exploration can only filter initial states.");
-                return storm::api::verifyWithExplorationEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+                auto task = storm::api::createTask<ValueType>(formula, true);
+                if (shieldExpression) {
+                    task.setShieldingExpression(shieldExpression);
+                }
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithExplorationEngine<ValueType>(mpi.env, input.model.get(), task);
+                
+                auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+                if (result && ioSettings.isExportShieldSet() && result->isExplicitQuantitativeCheckResult() && result->template asExplicitQuantitativeCheckResult<ValueType>().hasShield()) {
+                    // The shield refers to the states discovered during the exploration, so there is no model to take state valuations from.
+                    STORM_PRINT_AND_LOG("Exporting shield of the explored states ... ");
+                    storm::api::exportShield(std::shared_ptr<storm::models::sparse::Model<ValueType>>(), result->template asExplicitQuantitativeCheckResult<ValueType>().getShield(), ioSettings.getExportShieldFilenames());
+                }
+                return result;
             });
         }
 
@@ -1049,7 +1080,7 @@ namespace storm {
                                                         auto shield = result->template asExplicitQuantitativeCheckResult<ValueType>().getShield();
                                                         STORM_PRINT_AND_LOG("Exporting shield ... ");
                                                         
-                                                        storm::api::exportShield(sparseModel, shield, ioSettings.getExportShieldFilename());
+                                                        storm::api::exportShield(sparseModel, shield, ioSettings.getExportShieldFilenames());
                                                     }
                                                 }
                                             }
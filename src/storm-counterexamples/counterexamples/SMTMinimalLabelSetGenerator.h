@@ -1625,6 +1625,7 @@ namespace storm {
                 std::chrono::milliseconds analysisTime;
                 std::chrono::milliseconds cutTime;
                 uint64_t iterations;
+                uint64_t skippedModelChecks;
             };
 
 
@@ -1745,6 +1746,7 @@ namespace storm {
                 uint64_t firstCounterexampleFound = 0; // The value is not queried before being set.
                 std::vector<double> maximalPropertyValue;
                 uint_fast64_t zeroProbabilityCount = 0;
+                uint_fast64_t skippedModelCheckCount = 0;
                 size_t smallestCounterexampleSize = model.getNumberOfChoices(); // Definitive upper bound
                 uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
                 do {
@@ -1787,8 +1789,19 @@ namespace storm {
                     std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
                     std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
   
-                    // Now determine the maximal reachability probability in the sub-model.
-                    maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+                    // If the candidate can not reach a target state at all, the (cheaper) graph search suffices and we skip
+                    // the computation of the maximal reachability probability.
+                    boost::optional<storm::storage::BitVector> reachableStates;
+                    if (!rewardName) {
+                        reachableStates = storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                    }
+                    if (reachableStates && reachableStates.get().isDisjointFrom(psiStates)) {
+                        maximalPropertyValue.assign(1, storm::utility::zero<double>());
+                        ++skippedModelCheckCount;
+                    } else {
+                        // Now determine the maximal reachability probability in the sub-model.
+                        maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
+                    }
                     totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
                     
                     // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration process.
@@ -1804,10 +1817,12 @@ namespace storm {
                         }
                         
                         if (options.useDynamicConstraints) {
-                            // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                            storm::storage::BitVector reachableStates = storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                            // Determine which of the two analysis techniques to call by performing a reachability analysis (unless already done).
+                            if (!reachableStates) {
+                                reachableStates = storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                            }
                             
-                            if (reachableStates.isDisjointFrom(psiStates)) {
+                            if (reachableStates.get().isDisjointFrom(psiStates)) {
                                 // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
                                 analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet, variableInformation, relevancyInformation);
                             } else {
@@ -1863,6 +1878,7 @@ namespace storm {
                 stats.modelCheckingTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalModelCheckingTime);
                 stats.solverTime = std::chrono::duration_cast<std::chrono::milliseconds>(totalSolverTime);
                 stats.iterations = iterations;
+                stats.skippedModelChecks = skippedModelCheckCount;
 
                 if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
                     storm::storage::FlatSet<uint64_t> allLabels;
@@ -1886,7 +1902,8 @@ namespace storm {
                     std::cout << std::endl;
                     std::cout << "Other:" << std::endl;
                     std::cout << "    * number of models checked: " << iterations << std::endl;
-                    std::cout << "    * number of models that could not reach a target state: " << zeroProbabilityCount << " (" << 100 * static_cast<double>(zeroProbabilityCount)/iterations << "%)" << std::endl << std::endl;
+                    std::cout << "    * number of models that could not reach a target state: " << zeroProbabilityCount << " (" << 100 * static_cast<double>(zeroProbabilityCount)/iterations << "%)" << std::endl;
+                    std::cout << "    * number of models checked by graph search only: " << skippedModelCheckCount << std::endl << std::endl;
                 }
 
                 return result;
@@ -4,6 +4,10 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -35,6 +39,43 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            if (valuations.empty() || !checksBatchJointly(env)) {
+                return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(env, valuations);
+            }
+            auto const& nativeEnv = env.solver().native();
+            
+            if (!this->isBatchInstantiatorInitialized()) {
+                // Perform the qualitative analysis once on an arbitrary instantiation.
+                auto const& instantiatedModel = modelInstantiator.instantiate(valuations.front());
+                STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+                storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
+                auto const& pathFormula = this->currentCheckTask->getFormula().asOperatorFormula().getSubformula();
+                storm::storage::BitVector phiStates(instantiatedModel.getNumberOfStates(), true);
+                storm::storage::BitVector psiStates;
+                if (pathFormula.isUntilFormula()) {
+                    phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                } else {
+                    psiStates = modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                }
+                auto prob01 = storm::utility::graph::performProb01(instantiatedModel, phiStates, psiStates);
+                this->initializeBatchInstantiator(prob01.first, prob01.second);
+            }
+            
+            return this->checkReachabilityProbabilityFormulaBatch(valuations, boost::none, storm::utility::convertNumber<ConstantType>(nativeEnv.getPrecision()), nativeEnv.getRelativeTerminationCriterion(), nativeEnv.getMaximalNumberOfIterations());
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checksBatchJointly(Environment const& env) const {
+            auto const& nativeEnv = env.solver().native();
+            // The batch computation is value iteration, so we only use it if no other solver has been configured.
+            bool valueIterationSelected = (env.solver().isLinearEquationSolverTypeSetFromDefaultValue() && nativeEnv.isMethodSetFromDefault()) || (env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native && nativeEnv.getMethod() == storm::solver::NativeLinearEquationSolverMethod::Power);
+            return this->currentCheckTask && this->getInstantiationsAreGraphPreserving() && this->isBatchComputationApplicable(env) && valueIterationSelected && this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability());
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
             
@@ -22,6 +22,14 @@ namespace storm {
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+            /*!
+             * Checks the specified formula for each of the given valuations. If the instantiations are graph preserving,
+             * reachability probabilities are computed for all valuations jointly.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
+
+            virtual bool checksBatchJointly(Environment const& env) const override;
+
         protected:
             
             // Optimizations for the different formula types
@@ -5,6 +5,11 @@
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/vector.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -20,6 +25,64 @@ namespace storm {
         void SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
             currentFormula = checkTask.getFormula().asSharedPointer();
             currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
+            batchInstantiator.reset();
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            std::vector<std::unique_ptr<CheckResult>> result;
+            result.reserve(valuations.size());
+            for (auto const& valuation : valuations) {
+                result.push_back(check(env, valuation));
+            }
+            return result;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseInstantiationModelChecker<SparseModelType, ConstantType>::checksBatchJointly(Environment const&) const {
+            return false;
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        void SparseInstantiationModelChecker<SparseModelType, ConstantType>::initializeBatchInstantiator(storm::storage::BitVector const& prob0States, storm::storage::BitVector const& prob1States) {
+            auto const& transitionMatrix = parametricModel.getTransitionMatrix();
+            batchMaybeStates = ~(prob0States | prob1States);
+            batchProb1States = prob1States;
+            storm::storage::SparseMatrix<typename SparseModelType::ValueType> submatrix = transitionMatrix.getSubmatrix(true, batchMaybeStates, batchMaybeStates, false);
+            std::vector<typename SparseModelType::ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(batchMaybeStates, batchProb1States);
+            batchInstantiator = std::make_unique<storm::utility::BatchEquationSystemInstantiator<typename SparseModelType::ValueType, ConstantType>>(submatrix, b);
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseInstantiationModelChecker<SparseModelType, ConstantType>::isBatchInstantiatorInitialized() const {
+            return static_cast<bool>(batchInstantiator);
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseInstantiationModelChecker<SparseModelType, ConstantType>::isBatchComputationApplicable(Environment const& env) const {
+            return !storm::NumberTraits<ConstantType>::IsExact && !env.solver().isForceSoundness();
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormulaBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations, boost::optional<storm::solver::OptimizationDirection> const& dir, ConstantType const& precision, bool relative, uint64_t maxIterations) {
+            STORM_LOG_ASSERT(batchInstantiator, "Batch instantiator has not been initialized.");
+            batchInstantiator->instantiate(valuations);
+            std::vector<std::vector<ConstantType>> maybeStateValues = batchInstantiator->solveByValueIteration(dir, precision, relative, maxIterations);
+            
+            auto const& operatorFormula = currentCheckTask->getFormula().asOperatorFormula();
+            std::vector<std::unique_ptr<CheckResult>> result;
+            result.reserve(valuations.size());
+            for (auto& values : maybeStateValues) {
+                std::vector<ConstantType> stateValues(parametricModel.getNumberOfStates(), storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(stateValues, batchProb1States, storm::utility::one<ConstantType>());
+                storm::utility::vector::setVectorValues(stateValues, batchMaybeStates, values);
+                if (operatorFormula.hasQuantitativeResult()) {
+                    result.push_back(std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(stateValues)));
+                } else {
+                    result.push_back(ExplicitQuantitativeCheckResult<ConstantType>(std::move(stateValues)).compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>()));
+                }
+            }
+            return result;
         }
         
         template <typename SparseModelType, typename ConstantType>
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm-pars/utility/BatchEquationSystemInstantiator.h"
 #include "storm-pars/utility/parametric.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/CheckTask.h"
@@ -24,6 +29,19 @@ namespace storm {
             void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
+
+            /*!
+             * Checks the specified formula for each of the given valuations.
+             * The default implementation invokes check for each valuation individually.
+             * @return the check results in the order of the given valuations
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+
+            /*!
+             * @return true iff checkBatch shares work between the valuations under the given environment (instead of
+             * checking each of them individually), i.e., iff checking valuations in a batch pays off.
+             */
+            virtual bool checksBatchJointly(Environment const& env) const;
             
             // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
             // This bypasses the graph analysis for the different instantiations.
@@ -32,6 +50,27 @@ namespace storm {
             
         protected:
             
+            /*!
+             * Prepares the batch computation of (unbounded) reachability probabilities for the current formula.
+             * The equation system on the maybe states is compiled once. This requires graph-preserving instantiations.
+             *
+             * @param prob0States the states with probability zero (for all considered instantiations)
+             * @param prob1States the states with probability one (for all considered instantiations)
+             */
+            void initializeBatchInstantiator(storm::storage::BitVector const& prob0States, storm::storage::BitVector const& prob1States);
+            bool isBatchInstantiatorInitialized() const;
+            
+            /*!
+             * The batch computation performs (unsound) value iteration in floating point arithmetic.
+             * @return true iff this is acceptable for the value type and the given environment, i.e., the value type is not exact and soundness is not enforced.
+             */
+            bool isBatchComputationApplicable(Environment const& env) const;
+            
+            /*!
+             * Computes reachability probabilities for all given valuations using the (initialized) batch instantiator.
+             */
+            std::vector<std::unique_ptr<CheckResult>> checkReachabilityProbabilityFormulaBatch(std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations, boost::optional<storm::solver::OptimizationDirection> const& dir, ConstantType const& precision, bool relative, uint64_t maxIterations);
+            
             SparseModelType const& parametricModel;
             std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
             
@@ -39,6 +78,11 @@ namespace storm {
             // store the current formula. Note that currentCheckTask only stores a reference to the formula.
             std::shared_ptr<storm::logic::Formula const> currentFormula;
 
+            // Data for the batch computation. This is reset whenever a new formula is specified.
+            std::unique_ptr<storm::utility::BatchEquationSystemInstantiator<typename SparseModelType::ValueType, ConstantType>> batchInstantiator;
+            storm::storage::BitVector batchMaybeStates;
+            storm::storage::BitVector batchProb1States;
+
             bool instantiationsAreGraphPreserving;
         };
     }
@@ -4,6 +4,9 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
@@ -38,6 +41,44 @@ namespace storm {
             }
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            if (valuations.empty() || !checksBatchJointly(env)) {
+                return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(env, valuations);
+            }
+            auto const& minMaxEnv = env.solver().minMax();
+            storm::solver::OptimizationDirection dir = this->currentCheckTask->getOptimizationDirection();
+            
+            if (!this->isBatchInstantiatorInitialized()) {
+                // Perform the qualitative analysis once on an arbitrary instantiation.
+                auto const& instantiatedModel = modelInstantiator.instantiate(valuations.front());
+                STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+                storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ConstantType>> modelChecker(instantiatedModel);
+                auto const& pathFormula = this->currentCheckTask->getFormula().asOperatorFormula().getSubformula();
+                storm::storage::BitVector phiStates(instantiatedModel.getNumberOfStates(), true);
+                storm::storage::BitVector psiStates;
+                if (pathFormula.isUntilFormula()) {
+                    phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                } else {
+                    psiStates = modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                }
+                auto prob01 = storm::solver::minimize(dir) ? storm::utility::graph::performProb01Min(instantiatedModel, phiStates, psiStates) : storm::utility::graph::performProb01Max(instantiatedModel, phiStates, psiStates);
+                this->initializeBatchInstantiator(prob01.first, prob01.second);
+            }
+            
+            return this->checkReachabilityProbabilityFormulaBatch(valuations, dir, storm::utility::convertNumber<ConstantType>(minMaxEnv.getPrecision()), minMaxEnv.getRelativeTerminationCriterion(), minMaxEnv.getMaximalNumberOfIterations());
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::checksBatchJointly(Environment const& env) const {
+            auto const& minMaxEnv = env.solver().minMax();
+            // The batch computation is value iteration, so we only use it if no other solver has been configured.
+            bool valueIterationSelected = minMaxEnv.isMethodSetFromDefault() || minMaxEnv.getMethod() == storm::solver::MinMaxMethod::ValueIteration;
+            return this->currentCheckTask && this->getInstantiationsAreGraphPreserving() && this->isBatchComputationApplicable(env) && valueIterationSelected && this->currentCheckTask->isOptimizationDirectionSet() && this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability());
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseMdpInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ConstantType>>& modelChecker, storm::models::sparse::Mdp<ConstantType> const& instantiatedModel) {
 
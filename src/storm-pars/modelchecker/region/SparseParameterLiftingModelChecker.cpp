@@ -161,14 +161,26 @@ namespace storm {
             
             // Check if there is a point in the region for which the property is satisfied
             auto vertices = region.getVerticesOfRegion(region.getVariables());
-            auto vertexIt = vertices.begin();
-            while (vertexIt != vertices.end() && !(hasSatPoint && hasViolatedPoint)) {
-                if (getInstantiationChecker().check(env, *vertexIt)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
-                    hasSatPoint = true;
-                } else {
-                    hasViolatedPoint = true;
+            auto& instantiationChecker = getInstantiationChecker();
+            if (instantiationChecker.checksBatchJointly(env)) {
+                // All vertices are checked at once, which shares the work between them.
+                for (auto const& vertexResult : instantiationChecker.checkBatch(env, vertices)) {
+                    if (vertexResult->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+                        hasSatPoint = true;
+                    } else {
+                        hasViolatedPoint = true;
+                    }
+                }
+            } else {
+                auto vertexIt = vertices.begin();
+                while (vertexIt != vertices.end() && !(hasSatPoint && hasViolatedPoint)) {
+                    if (instantiationChecker.check(env, *vertexIt)->asExplicitQualitativeCheckResult()[*this->parametricModel->getInitialStates().begin()]) {
+                        hasSatPoint = true;
+                    } else {
+                        hasViolatedPoint = true;
+                    }
+                    ++vertexIt;
                 }
-                ++vertexIt;
             }
             
             if (hasSatPoint) {
@@ -0,0 +1,151 @@
+#include "storm-pars/utility/BatchEquationSystemInstantiator.h"
+
+#include <algorithm>
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename ParametricType, typename ConstantType>
+        BatchEquationSystemInstantiator<ParametricType, ConstantType>::BatchEquationSystemInstantiator(storm::storage::SparseMatrix<ParametricType> const& matrix, std::vector<ParametricType> const& vector) : batchSize(0) {
+            STORM_LOG_THROW(matrix.getRowCount() == vector.size(), storm::exceptions::InvalidArgumentException, "The vector has " << vector.size() << " entries but the matrix has " << matrix.getRowCount() << " rows.");
+            STORM_LOG_THROW(matrix.getRowGroupCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException, "The given matrix is not square w.r.t. its row groups.");
+
+            rowGroupIndices.assign(matrix.getRowGroupIndices().begin(), matrix.getRowGroupIndices().end());
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            columns.reserve(matrix.getEntryCount());
+            matrixFunctions.reserve(matrix.getEntryCount());
+            constantMatrixValues.reserve(matrix.getEntryCount());
+
+            rowIndications.push_back(0);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    columns.push_back(entry.getColumn());
+                    if (storm::utility::isConstant(entry.getValue())) {
+                        matrixFunctions.push_back(std::numeric_limits<uint64_t>::max());
+                        constantMatrixValues.push_back(storm::utility::convertNumber<ConstantType>(entry.getValue()));
+                    } else {
+                        matrixFunctions.push_back(program.addFunction(entry.getValue()));
+                        constantMatrixValues.push_back(storm::utility::zero<ConstantType>());
+                    }
+                }
+                rowIndications.push_back(columns.size());
+            }
+
+            vectorFunctions.reserve(vector.size());
+            constantVectorValues.reserve(vector.size());
+            for (auto const& value : vector) {
+                if (storm::utility::isConstant(value)) {
+                    vectorFunctions.push_back(std::numeric_limits<uint64_t>::max());
+                    constantVectorValues.push_back(storm::utility::convertNumber<ConstantType>(value));
+                } else {
+                    vectorFunctions.push_back(program.addFunction(value));
+                    constantVectorValues.push_back(storm::utility::zero<ConstantType>());
+                }
+            }
+            STORM_LOG_DEBUG("Compiled equation system with " << columns.size() << " entries into a program with " << program.getNumberOfFunctions() << " distinct functions.");
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        void BatchEquationSystemInstantiator<ParametricType, ConstantType>::instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+            batchSize = valuations.size();
+            std::vector<ConstantType> functionValues;
+            program.evaluate(valuations, functionValues);
+
+            auto instantiateEntries = [&] (std::vector<uint64_t> const& functions, std::vector<ConstantType> const& constantValues, std::vector<ConstantType>& values) {
+                values.resize(functions.size() * batchSize);
+                auto valueIt = values.begin();
+                for (uint64_t entry = 0; entry < functions.size(); ++entry) {
+                    if (functions[entry] == std::numeric_limits<uint64_t>::max()) {
+                        valueIt = std::fill_n(valueIt, batchSize, constantValues[entry]);
+                    } else {
+                        auto functionLanesIt = functionValues.begin() + functions[entry] * batchSize;
+                        valueIt = std::copy(functionLanesIt, functionLanesIt + batchSize, valueIt);
+                    }
+                }
+            };
+            instantiateEntries(matrixFunctions, constantMatrixValues, matrixValues);
+            instantiateEntries(vectorFunctions, constantVectorValues, vectorValues);
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        uint64_t BatchEquationSystemInstantiator<ParametricType, ConstantType>::getBatchSize() const {
+            return batchSize;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        std::vector<std::vector<ConstantType>> BatchEquationSystemInstantiator<ParametricType, ConstantType>::solveByValueIteration(boost::optional<storm::solver::OptimizationDirection> const& dir, ConstantType const& precision, bool relative, uint64_t maxIterations) const {
+            uint64_t const numberOfRowGroups = rowGroupIndices.size() - 1;
+            bool const hasTrivialRowGrouping = numberOfRowGroups + 1 == rowIndications.size();
+            STORM_LOG_THROW(hasTrivialRowGrouping || dir, storm::exceptions::InvalidArgumentException, "An optimization direction is required for equation systems with non-trivial row grouping.");
+            bool const minimize = dir && storm::solver::minimize(dir.get());
+
+            std::vector<ConstantType> currentValues(numberOfRowGroups * batchSize, storm::utility::zero<ConstantType>());
+            std::vector<ConstantType> newValues(currentValues.size());
+            std::vector<ConstantType> rowValues(batchSize);
+
+            uint64_t iterations = 0;
+            bool converged = false;
+            while (!converged && iterations < maxIterations) {
+                for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+                    ConstantType* groupLanes = newValues.data() + group * batchSize;
+                    for (uint64_t row = rowGroupIndices[group]; row < rowGroupIndices[group + 1]; ++row) {
+                        ConstantType* targetLanes = row == rowGroupIndices[group] ? groupLanes : rowValues.data();
+                        std::copy(vectorValues.begin() + row * batchSize, vectorValues.begin() + (row + 1) * batchSize, targetLanes);
+                        for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                            ConstantType const* entryLanes = matrixValues.data() + entry * batchSize;
+                            ConstantType const* successorLanes = currentValues.data() + columns[entry] * batchSize;
+                            for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                                targetLanes[lane] += entryLanes[lane] * successorLanes[lane];
+                            }
+                        }
+                        if (row != rowGroupIndices[group]) {
+                            for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                                if (minimize ? rowValues[lane] < groupLanes[lane] : rowValues[lane] > groupLanes[lane]) {
+                                    groupLanes[lane] = rowValues[lane];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                converged = true;
+                for (uint64_t index = 0; index < newValues.size(); ++index) {
+                    ConstantType difference = storm::utility::abs<ConstantType>(newValues[index] - currentValues[index]);
+                    if (relative && !storm::utility::isZero(newValues[index])) {
+                        difference /= storm::utility::abs<ConstantType>(newValues[index]);
+                    }
+                    if (difference > precision) {
+                        converged = false;
+                        break;
+                    }
+                }
+                std::swap(currentValues, newValues);
+                ++iterations;
+            }
+
+            if (converged) {
+                STORM_LOG_INFO("Batch value iteration for " << batchSize << " instantiations converged after " << iterations << " iterations.");
+            } else {
+                STORM_LOG_WARN("Batch value iteration for " << batchSize << " instantiations did not converge within " << iterations << " iterations.");
+            }
+
+            std::vector<std::vector<ConstantType>> result(batchSize, std::vector<ConstantType>(numberOfRowGroups));
+            for (uint64_t group = 0; group < numberOfRowGroups; ++group) {
+                for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                    result[lane][group] = currentValues[group * batchSize + lane];
+                }
+            }
+            return result;
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class BatchEquationSystemInstantiator<storm::RationalFunction, double>;
+        template class BatchEquationSystemInstantiator<storm::RationalFunction, storm::RationalNumber>;
+#endif
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm-pars/utility/FunctionEvaluationProgram.h"
+#include "storm-pars/utility/parametric.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * This class instantiates a parametric equation system of the form x = opt(A*x + b) for a batch of valuations at once.
+         * The structure of the system is compiled once. For each instantiation, only the (distinct) occurring functions are
+         * evaluated using a FunctionEvaluationProgram. The instantiated systems share the matrix structure and are solved
+         * jointly, i.e., a single sweep over the matrix updates the value vectors of all valuations.
+         */
+        template<typename ParametricType, typename ConstantType>
+        class BatchEquationSystemInstantiator {
+        public:
+
+            /*!
+             * Compiles the given equation system.
+             * @param matrix The (possibly row-grouped) parametric matrix A. The matrix has to be square w.r.t. the row groups.
+             * @param vector The parametric vector b with one entry per row of A.
+             */
+            BatchEquationSystemInstantiator(storm::storage::SparseMatrix<ParametricType> const& matrix, std::vector<ParametricType> const& vector);
+
+            /*!
+             * Instantiates the equation system for all given valuations.
+             */
+            void instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+
+            /*!
+             * Retrieves the number of valuations for which the system is currently instantiated.
+             */
+            uint64_t getBatchSize() const;
+
+            /*!
+             * Solves all instantiated systems via value iteration starting from zero. For row-grouped matrices,
+             * the value of each row group is the optimum over its rows (w.r.t. the given direction).
+             *
+             * @return the solution vector for each valuation (in the order of the valuations given on instantiation)
+             */
+            std::vector<std::vector<ConstantType>> solveByValueIteration(boost::optional<storm::solver::OptimizationDirection> const& dir, ConstantType const& precision, bool relative, uint64_t maxIterations) const;
+
+        private:
+            /// The structure of the matrix.
+            std::vector<uint64_t> rowGroupIndices;
+            std::vector<uint64_t> rowIndications;
+            std::vector<uint64_t> columns;
+
+            /// For each matrix and vector entry either the index of its function in the program or std::numeric_limits<uint64_t>::max() if the entry is constant.
+            std::vector<uint64_t> matrixFunctions;
+            std::vector<uint64_t> vectorFunctions;
+
+            /// The values of constant entries.
+            std::vector<ConstantType> constantMatrixValues;
+            std::vector<ConstantType> constantVectorValues;
+
+            FunctionEvaluationProgram<ParametricType, ConstantType> program;
+
+            /// The instantiated values. The value of entry e under valuation v is stored at position e * batchSize + v.
+            uint64_t batchSize;
+            std::vector<ConstantType> matrixValues;
+            std::vector<ConstantType> vectorValues;
+        };
+    }
+}
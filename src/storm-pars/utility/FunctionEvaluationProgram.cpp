@@ -0,0 +1,138 @@
+#include "storm-pars/utility/FunctionEvaluationProgram.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename FunctionType, typename ConstantType>
+        uint64_t FunctionEvaluationProgram<FunctionType, ConstantType>::addFunction(FunctionType const& function) {
+            auto findRes = functionIndices.find(function);
+            if (findRes != functionIndices.end()) {
+                return findRes->second;
+            }
+            uint64_t nominator = addPolynomial(function.nominatorAsPolynomial().polynomialWithCoefficient());
+            uint64_t denominator = addPolynomial(function.denominatorAsPolynomial().polynomialWithCoefficient());
+            uint64_t index = functions.size();
+            functions.emplace_back(nominator, denominator);
+            functionIndices.emplace(function, index);
+            return index;
+        }
+
+        template<typename FunctionType, typename ConstantType>
+        uint64_t FunctionEvaluationProgram<FunctionType, ConstantType>::getNumberOfFunctions() const {
+            return functions.size();
+        }
+
+        template<typename FunctionType, typename ConstantType>
+        std::vector<typename FunctionEvaluationProgram<FunctionType, ConstantType>::VariableType> const& FunctionEvaluationProgram<FunctionType, ConstantType>::getVariables() const {
+            return variables;
+        }
+
+        template<typename FunctionType, typename ConstantType>
+        uint64_t FunctionEvaluationProgram<FunctionType, ConstantType>::getVariableIndex(VariableType const& variable) {
+            auto insertionRes = variableIndices.emplace(variable, variables.size());
+            if (insertionRes.second) {
+                variables.push_back(variable);
+            }
+            return insertionRes.first->second;
+        }
+
+        template<typename FunctionType, typename ConstantType>
+        template<typename PolynomialType>
+        uint64_t FunctionEvaluationProgram<FunctionType, ConstantType>::addPolynomial(PolynomialType const& polynomial) {
+            for (auto const& term : polynomial) {
+                Term compiledTerm;
+                compiledTerm.coefficient = storm::utility::convertNumber<ConstantType>(term.coeff());
+                if (term.monomial()) {
+                    std::vector<std::pair<uint64_t, uint64_t>> factors;
+                    for (auto const& factor : *term.monomial()) {
+                        factors.emplace_back(getVariableIndex(factor.first), factor.second);
+                    }
+                    auto monomialIt = monomialIndices.find(factors);
+                    if (monomialIt == monomialIndices.end()) {
+                        monomialFactors.insert(monomialFactors.end(), factors.begin(), factors.end());
+                        monomialIndications.push_back(monomialFactors.size());
+                        monomialIt = monomialIndices.emplace(std::move(factors), monomialIndications.size() - 2).first;
+                    }
+                    compiledTerm.monomial = monomialIt->second;
+                } else {
+                    compiledTerm.monomial = std::numeric_limits<uint64_t>::max();
+                }
+                terms.push_back(std::move(compiledTerm));
+            }
+            polynomialIndications.push_back(terms.size());
+            return polynomialIndications.size() - 2;
+        }
+
+        template<typename FunctionType, typename ConstantType>
+        void FunctionEvaluationProgram<FunctionType, ConstantType>::evaluate(std::vector<storm::utility::parametric::Valuation<FunctionType>> const& valuations, std::vector<ConstantType>& result) const {
+            uint64_t const batchSize = valuations.size();
+
+            // Gather the values of the variables.
+            std::vector<ConstantType> variableValues(variables.size() * batchSize);
+            for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                auto const& valuation = valuations[lane];
+                for (uint64_t variableIndex = 0; variableIndex < variables.size(); ++variableIndex) {
+                    auto valueIt = valuation.find(variables[variableIndex]);
+                    STORM_LOG_THROW(valueIt != valuation.end(), storm::exceptions::InvalidArgumentException, "The given valuation does not assign a value to variable " << variables[variableIndex] << ".");
+                    variableValues[variableIndex * batchSize + lane] = storm::utility::convertNumber<ConstantType>(valueIt->second);
+                }
+            }
+
+            // Evaluate the monomials.
+            uint64_t const numberOfMonomials = monomialIndications.size() - 1;
+            std::vector<ConstantType> monomialValues(numberOfMonomials * batchSize, storm::utility::one<ConstantType>());
+            for (uint64_t monomial = 0; monomial < numberOfMonomials; ++monomial) {
+                ConstantType* monomialLanes = monomialValues.data() + monomial * batchSize;
+                for (uint64_t factorIndex = monomialIndications[monomial]; factorIndex < monomialIndications[monomial + 1]; ++factorIndex) {
+                    ConstantType const* variableLanes = variableValues.data() + monomialFactors[factorIndex].first * batchSize;
+                    for (uint64_t exponent = 0; exponent < monomialFactors[factorIndex].second; ++exponent) {
+                        for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                            monomialLanes[lane] *= variableLanes[lane];
+                        }
+                    }
+                }
+            }
+
+            // Evaluate the polynomials.
+            uint64_t const numberOfPolynomials = polynomialIndications.size() - 1;
+            std::vector<ConstantType> polynomialValues(numberOfPolynomials * batchSize, storm::utility::zero<ConstantType>());
+            for (uint64_t polynomial = 0; polynomial < numberOfPolynomials; ++polynomial) {
+                ConstantType* polynomialLanes = polynomialValues.data() + polynomial * batchSize;
+                for (uint64_t termIndex = polynomialIndications[polynomial]; termIndex < polynomialIndications[polynomial + 1]; ++termIndex) {
+                    Term const& term = terms[termIndex];
+                    if (term.monomial == std::numeric_limits<uint64_t>::max()) {
+                        for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                            polynomialLanes[lane] += term.coefficient;
+                        }
+                    } else {
+                        ConstantType const* monomialLanes = monomialValues.data() + term.monomial * batchSize;
+                        for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                            polynomialLanes[lane] += term.coefficient * monomialLanes[lane];
+                        }
+                    }
+                }
+            }
+
+            // Evaluate the functions.
+            result.resize(functions.size() * batchSize);
+            for (uint64_t function = 0; function < functions.size(); ++function) {
+                ConstantType* resultLanes = result.data() + function * batchSize;
+                ConstantType const* nominatorLanes = polynomialValues.data() + functions[function].first * batchSize;
+                ConstantType const* denominatorLanes = polynomialValues.data() + functions[function].second * batchSize;
+                for (uint64_t lane = 0; lane < batchSize; ++lane) {
+                    resultLanes[lane] = nominatorLanes[lane] / denominatorLanes[lane];
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class FunctionEvaluationProgram<storm::RationalFunction, double>;
+        template class FunctionEvaluationProgram<storm::RationalFunction, storm::RationalNumber>;
+#endif
+    }
+}
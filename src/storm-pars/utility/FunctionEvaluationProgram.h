@@ -0,0 +1,84 @@
+#pragma once
+
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * This class compiles a set of (rational) functions into a flat program that can be evaluated for a batch of
+         * valuations at once. Every distinct function and every distinct monomial is stored only once. During
+         * evaluation, the values for the different valuations are stored in consecutive memory cells (lanes) such
+         * that the inner loops run over the batch and can be vectorized by the compiler.
+         */
+        template<typename FunctionType, typename ConstantType>
+        class FunctionEvaluationProgram {
+        public:
+            typedef typename storm::utility::parametric::VariableType<FunctionType>::type VariableType;
+            typedef typename storm::utility::parametric::CoefficientType<FunctionType>::type CoefficientType;
+
+            FunctionEvaluationProgram() = default;
+
+            /*!
+             * Adds the given function to the program (if it was not added before).
+             * @return the index of the function that can be used to retrieve its values after evaluation.
+             */
+            uint64_t addFunction(FunctionType const& function);
+
+            /*!
+             * Retrieves the number of distinct functions of this program.
+             */
+            uint64_t getNumberOfFunctions() const;
+
+            /*!
+             * Retrieves the variables that occur in at least one of the functions.
+             */
+            std::vector<VariableType> const& getVariables() const;
+
+            /*!
+             * Evaluates all functions of the program for all given valuations.
+             *
+             * @param valuations The valuations. Each valuation has to assign a value to all occurring variables.
+             * @param result The function values. The value of function f at valuation v is written to position f * valuations.size() + v.
+             */
+            void evaluate(std::vector<storm::utility::parametric::Valuation<FunctionType>> const& valuations, std::vector<ConstantType>& result) const;
+
+        private:
+            /*!
+             * Adds the given polynomial to the program and returns its index.
+             */
+            template<typename PolynomialType>
+            uint64_t addPolynomial(PolynomialType const& polynomial);
+
+            uint64_t getVariableIndex(VariableType const& variable);
+
+            struct Term {
+                /// The index of the monomial or std::numeric_limits<uint64_t>::max() for constant terms
+                uint64_t monomial;
+                ConstantType coefficient;
+            };
+
+            /// The occurring variables together with their index.
+            std::vector<VariableType> variables;
+            std::map<VariableType, uint64_t> variableIndices;
+
+            /// The monomials. The factors (pairs of variable index and exponent) of monomial m are stored at positions monomialIndications[m] until monomialIndications[m+1]
+            std::vector<uint64_t> monomialIndications = {0};
+            std::vector<std::pair<uint64_t, uint64_t>> monomialFactors;
+            std::map<std::vector<std::pair<uint64_t, uint64_t>>, uint64_t> monomialIndices;
+
+            /// The polynomials. The terms of polynomial p are stored at positions polynomialIndications[p] until polynomialIndications[p+1]
+            std::vector<uint64_t> polynomialIndications = {0};
+            std::vector<Term> terms;
+
+            /// The functions, given by the indices of nominator and denominator polynomial.
+            std::vector<std::pair<uint64_t, uint64_t>> functions;
+            std::unordered_map<FunctionType, uint64_t> functionIndices;
+        };
+    }
+}
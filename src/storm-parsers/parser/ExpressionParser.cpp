@@ -222,9 +222,9 @@ namespace storm {
         }
 
         storm::expressions::Expression ExpressionParser::parseFromString(std::string const& expressionString, bool ignoreError) const {
-            PositionIteratorType first(expressionString.begin());
+            PositionIteratorType first(expressionString.data());
             PositionIteratorType iter = first;
-            PositionIteratorType last(expressionString.end());
+            PositionIteratorType last(expressionString.data() + expressionString.size());
 
             // Create empty result;
             storm::expressions::Expression result;
@@ -77,9 +77,9 @@ namespace storm {
         }
 
         std::vector<storm::jani::Property> FormulaParser::parseFromString(std::string const& formulaString) const {
-            PositionIteratorType first(formulaString.begin());
+            PositionIteratorType first(formulaString.data());
             PositionIteratorType iter = first;
-            PositionIteratorType last(formulaString.end());
+            PositionIteratorType last(formulaString.data() + formulaString.size());
 
             // Create empty result;
             std::vector<storm::jani::Property> result;
@@ -240,9 +240,9 @@ namespace storm {
         
             // Now try to parse the contents of the file.
             std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
-            PositionIteratorType first(fileContent.begin());
+            PositionIteratorType first(fileContent.data());
             PositionIteratorType iter = first;
-            PositionIteratorType last(fileContent.end());
+            PositionIteratorType last(fileContent.data() + fileContent.size());
 
             try {
                 // Start parsing.
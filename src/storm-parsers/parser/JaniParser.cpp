@@ -28,7 +28,7 @@
 #include "storm/storage/jani/ArrayVariable.h"
 
 #include "storm/utility/macros.h"
-#include "storm/io/file.h"
+#include "storm-parsers/parser/MappedFile.h"
 
 namespace storm {
     namespace parser {
@@ -79,7 +79,7 @@ namespace storm {
         template <typename ValueType>
         std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parse(std::string const& path, bool parseProperties) {
             JaniParser parser;
-            parser.readFile(path);
+            parser.readFile(path, parseProperties);
             return parser.parseModel(parseProperties);
         }
 
@@ -95,11 +95,16 @@ namespace storm {
         }
 
         template <typename ValueType>
-        void JaniParser<ValueType>::readFile(std::string const &path) {
-            std::ifstream file;
-            storm::utility::openFile(path, file);
-            parsedStructure << file;
-            storm::utility::closeFile(file);
+        void JaniParser<ValueType>::readFile(std::string const &path, bool parseProperties) {
+            // Parse directly from the mapped file to avoid buffering it in a stream.
+            storm::parser::MappedFile file(path.c_str());
+            typename Json::parser_callback_t discardUnusedMembers = [parseProperties] (int depth, typename Json::parse_event_t event, Json& parsed) {
+                if (depth == 1 && event == Json::parse_event_t::key) {
+                    return !(parsed == "metadata" || (!parseProperties && parsed == "properties"));
+                }
+                return true;
+            };
+            parsedStructure = Json::parse(file.getData(), file.getDataEnd(), discardUnusedMembers);
         }
 
         template <typename ValueType>
@@ -201,8 +206,10 @@ namespace storm {
             STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
             STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
             // Automatons can only be parsed after constants and variables.
-            for (auto const& automataEntry : parsedStructure.at("automata")) {
+            for (auto& automataEntry : parsedStructure.at("automata")) {
                 model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+                // The structure of the automaton is not needed anymore, so we release it right away to reduce the peak memory consumption.
+                automataEntry = Json();
             }
             STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
             storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
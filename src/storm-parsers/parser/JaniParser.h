@@ -45,7 +45,11 @@ namespace storm {
             static std::pair<storm::jani::Model, std::vector<storm::jani::Property>> parseFromString(std::string const& jsonstring, bool parseProperties = true);
 
         protected:
-            void readFile(std::string const& path);
+            /*!
+             * Reads the JSON structure of the given file. Parts of the file that are not needed for the conversion
+             * (the metadata and, if requested, the properties) are discarded while reading and never stored.
+             */
+            void readFile(std::string const& path, bool parseProperties = true);
             
             struct Scope {
                 Scope(std::string description = "global", ConstantsMap const* constants = nullptr, VariablesMap const* globalVars = nullptr, FunctionsMap const* globalFunctions = nullptr, VariablesMap const* localVars = nullptr, FunctionsMap const* localFunctions = nullptr) : description(description) , constants(constants), globalVars(globalVars), globalFunctions(globalFunctions), localVars(localVars), localFunctions(localFunctions) {};
@@ -7,7 +7,6 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidTypeException.h"
 #include "storm/utility/macros.h"
-#include "storm/io/file.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -16,40 +15,26 @@
 #include "storm/storage/BitVector.h"
 
 #include "storm-parsers/parser/ExpressionParser.h"
+#include "storm-parsers/parser/MappedFile.h"
 
 namespace storm {
     namespace parser {
         storm::prism::Program PrismParser::parse(std::string const& filename, bool prismCompatibility) {
-            // Open file and initialize result.
-            std::ifstream inputFileStream;
-            storm::utility::openFile(filename, inputFileStream);
-            storm::prism::Program result;
-
-            // Now try to parse the contents of the file.
-            try {
-                std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
-                result = parseFromString(fileContent, filename, prismCompatibility);
-            } catch(storm::exceptions::WrongFormatException& e) {
-                // In case of an exception properly close the file before passing exception.
-                storm::utility::closeFile(inputFileStream);
-                throw e;
-            } catch(std::exception& e) {
-                // In case of an exception properly close the file before passing exception.
-                storm::utility::closeFile(inputFileStream);
-                throw e;
-            }
-
-            // Close the stream in case everything went smoothly and return result.
-            storm::utility::closeFile(inputFileStream);
-            return result;
+            // Map the file to memory and parse it right from there (instead of reading it into a string first).
+            MappedFile file(filename.c_str());
+            return parseFromRange(file.getData(), file.getDataEnd(), filename, prismCompatibility);
         }
 
         storm::prism::Program PrismParser::parseFromString(std::string const& input, std::string const& filename, bool prismCompatibility) {
-            bool hasByteOrderMark = input.size() >= 3 && input[0] == '\xEF' && input[1] == '\xBB' && input[2] == '\xBF';
+            return parseFromRange(input.data(), input.data() + input.size(), filename, prismCompatibility);
+        }
+
+        storm::prism::Program PrismParser::parseFromRange(char const* begin, char const* end, std::string const& filename, bool prismCompatibility) {
+            bool hasByteOrderMark = end - begin >= 3 && begin[0] == '\xEF' && begin[1] == '\xBB' && begin[2] == '\xBF';
 
-            PositionIteratorType first(hasByteOrderMark ? input.begin() + 3 : input.begin());
+            PositionIteratorType first(hasByteOrderMark ? begin + 3 : begin);
             PositionIteratorType iter = first;
-            PositionIteratorType last(input.end());
+            PositionIteratorType last(end);
             STORM_LOG_ASSERT(first != last, "Illegal input to PRISM parser.");
 
             // Create empty result;
@@ -65,9 +50,9 @@ namespace storm {
                 STORM_LOG_DEBUG("First pass of parsing PRISM input finished.");
 
                 // Start second run.
-                first = PositionIteratorType(input.begin());
+                first = PositionIteratorType(hasByteOrderMark ? begin + 3 : begin);
                 iter = first;
-                last = PositionIteratorType(input.end());
+                last = PositionIteratorType(end);
                 grammar.moveToSecondRun();
                 succeeded = qi::phrase_parse(iter, last, grammar, space | qi::lit("//") >> *(qi::char_ - (qi::eol | qi::eoi)) >> (qi::eol | qi::eoi), result);
                 STORM_LOG_THROW(succeeded,  storm::exceptions::WrongFormatException, "Parsing failed in second pass.");
@@ -272,7 +257,7 @@ namespace storm {
             commandDefinition = (((qi::lit("[") > -identifier > qi::lit("]"))
                                   |
                                  (qi::lit("<") > -identifier > qi::lit(">")[qi::_a = true]))
-                                 > +(qi::char_ - (qi::lit(";") | qi::lit("endmodule")))
+                                 > qi::omit[+(qi::char_ - (qi::lit(";") | qi::lit("endmodule")))]
                                  > qi::lit(";"))[qi::_val = phoenix::bind(&PrismParser::createDummyCommand, phoenix::ref(*this), qi::_1, qi::_r1)];
             commandDefinition.name("command definition");
 
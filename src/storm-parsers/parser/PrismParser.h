@@ -98,6 +98,16 @@ namespace storm {
             static storm::prism::Program parseFromString(std::string const& input, std::string const& filename, bool prismCompatability = false);
 
         private:
+            /*!
+             * Parses the given range of characters into the PRISM storage classes assuming it complies with the PRISM syntax.
+             *
+             * @param begin The first character of the input.
+             * @param end The position behind the last character of the input.
+             * @param filename The name of the file from which the input was read.
+             * @return The resulting PRISM program.
+             */
+            static storm::prism::Program parseFromRange(char const* begin, char const* end, std::string const& filename, bool prismCompatability);
+
             struct modelTypeStruct : qi::symbols<char, storm::prism::Program::ModelType> {
                 modelTypeStruct() {
                     add
@@ -18,7 +18,8 @@
 namespace qi = boost::spirit::qi;
 namespace phoenix = boost::phoenix;
 
-typedef std::string::const_iterator BaseIteratorType;
+// Parsing works on plain character ranges, so input that is mapped to memory does not need to be copied into a string.
+typedef char const* BaseIteratorType;
 typedef boost::spirit::line_pos_iterator<BaseIteratorType> PositionIteratorType;
 typedef PositionIteratorType Iterator;
 
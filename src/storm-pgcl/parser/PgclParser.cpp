@@ -29,9 +29,9 @@ namespace storm {
         }
         
         storm::pgcl::PgclProgram PgclParser::parseFromString(std::string const& input, std::string const& filename) {
-            PositionIteratorType first(input.begin());
+            PositionIteratorType first(input.data());
             PositionIteratorType iter = first;
-            PositionIteratorType last(input.end());
+            PositionIteratorType last(input.data() + input.size());
 
             // Create empty program.
             storm::pgcl::PgclProgram result;
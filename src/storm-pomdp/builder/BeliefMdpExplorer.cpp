@@ -1,5 +1,7 @@
 #include "storm-pomdp/builder/BeliefMdpExplorer.h"
 
+#include <queue>
+
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 
@@ -7,8 +9,10 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.cpp"
+#include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/solver/OptimizationDirection.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
@@ -28,7 +32,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), status(Status::Uninitialized) {
+        BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefMdpExplorer(std::shared_ptr<BeliefManagerType> beliefManager,storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> const &pomdpValueBounds) : beliefManager(beliefManager), pomdpValueBounds(pomdpValueBounds), previousValuesAreComputed(false), status(Status::Uninitialized) {
             // Intentionally left empty
         }
 
@@ -56,9 +60,13 @@ namespace storm {
             targetStates.clear();
             truncatedStates.clear();
             delayedExplorationChoices.clear();
+            restoredChoices.clear();
+            modifiedMdpStates = boost::none;
+            previousValuesAreComputed = false;
             optimalChoices = boost::none;
             optimalChoicesReachableMdpStates = boost::none;
             exploredMdp = nullptr;
+            exploredMdpBackwardTransitions = boost::none;
             internalAddRowGroupIndex(); // Mark the start of the first row group
 
             // Add some states with special treatment (if requested)
@@ -96,6 +104,7 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType>
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::restartExploration() {
             STORM_LOG_ASSERT(status == Status::ModelChecked || status == Status::ModelFinished, "Method call is invalid in current status.");
+            previousValuesAreComputed = status == Status::ModelChecked;
             status = Status::Exploring;
             // We will not erase old states during the exploration phase, so most state-based data (like mappings between MDP and Belief states) remain valid.
             exploredBeliefIds.clear();
@@ -111,6 +120,7 @@ namespace storm {
             targetStates = storm::storage::BitVector(getCurrentNumberOfMdpStates(), false);
             truncatedStates = storm::storage::BitVector(getCurrentNumberOfMdpStates(), false);
             delayedExplorationChoices.clear();
+            restoredChoices = storm::storage::BitVector(exploredMdp->getNumberOfChoices(), false);
             mdpStatesToExplore.clear();
 
             // The extra states are not changed
@@ -300,9 +310,10 @@ namespace storm {
             uint64_t choiceIndex = exploredChoiceIndices[getCurrentMdpState()] + localActionIndex;
             STORM_LOG_ASSERT(choiceIndex < exploredChoiceIndices[getCurrentMdpState() + 1], "Invalid local action index.");
 
-            // Insert the transitions
+            // The transitions are taken over from the old MDP when finishing the exploration
+            STORM_LOG_ASSERT(exploredMdpTransitions[choiceIndex].empty(), "Restoring a choice that has already been explored.");
+            restoredChoices.set(choiceIndex, true);
             for (auto const &transition : exploredMdp->getTransitionMatrix().getRow(choiceIndex)) {
-                internalAddTransition(choiceIndex, transition.getColumn(), transition.getValue());
                 // Check whether exploration is needed
                 auto beliefId = getBeliefId(transition.getColumn());
                 if (beliefId != beliefManager->noId()) { // Not the extra target or bottom state
@@ -330,6 +341,7 @@ namespace storm {
             // Resize state- and choice based vectors to the correct size
             targetStates.resize(getCurrentNumberOfMdpStates(), false);
             truncatedStates.resize(getCurrentNumberOfMdpStates(), false);
+            restoredChoices.resize(getCurrentNumberOfMdpChoices(), false);
             if (!mdpActionRewards.empty()) {
                 mdpActionRewards.resize(getCurrentNumberOfMdpChoices(), storm::utility::zero<ValueType>());
             }
@@ -347,10 +359,26 @@ namespace storm {
             optimalChoices = boost::none;
             optimalChoicesReachableMdpStates = boost::none;
 
+            // Find the states whose behavior has changed. If the old values are available, only these states need to be updated.
+            if (exploredMdp && previousValuesAreComputed) {
+                modifiedMdpStates = storm::storage::BitVector(getCurrentNumberOfMdpStates(), false);
+                for (uint64_t groupIndex = 0; groupIndex < exploredChoiceIndices.size() - 1; ++groupIndex) {
+                    if (restoredChoices.getNextUnsetIndex(exploredChoiceIndices[groupIndex]) < exploredChoiceIndices[groupIndex + 1]) {
+                        modifiedMdpStates->set(groupIndex, true);
+                    }
+                }
+            } else {
+                modifiedMdpStates = boost::none;
+            }
+
             // Create the tranistion matrix
             uint64_t entryCount = 0;
-            for (auto const &row : exploredMdpTransitions) {
-                entryCount += row.size();
+            for (uint64_t rowIndex = 0; rowIndex < exploredMdpTransitions.size(); ++rowIndex) {
+                if (exploredMdpTransitions[rowIndex].empty() && restoredChoices.get(rowIndex)) {
+                    entryCount += exploredMdp->getTransitionMatrix().getRow(rowIndex).getNumberOfEntries();
+                } else {
+                    entryCount += exploredMdpTransitions[rowIndex].size();
+                }
             }
             storm::storage::SparseMatrixBuilder<ValueType> builder(getCurrentNumberOfMdpChoices(), getCurrentNumberOfMdpStates(), entryCount, true, true,
                                                                    getCurrentNumberOfMdpStates());
@@ -359,8 +387,15 @@ namespace storm {
                 uint64_t groupEnd = exploredChoiceIndices[groupIndex + 1];
                 builder.newRowGroup(rowIndex);
                 for (; rowIndex < groupEnd; ++rowIndex) {
-                    for (auto const &entry : exploredMdpTransitions[rowIndex]) {
-                        builder.addNextValue(rowIndex, entry.first, entry.second);
+                    if (exploredMdpTransitions[rowIndex].empty() && restoredChoices.get(rowIndex)) {
+                        // The row is unchanged, so we can copy it from the old MDP.
+                        for (auto const &entry : exploredMdp->getTransitionMatrix().getRow(rowIndex)) {
+                            builder.addNextValue(rowIndex, entry.getColumn(), entry.getValue());
+                        }
+                    } else {
+                        for (auto const &entry : exploredMdpTransitions[rowIndex]) {
+                            builder.addNextValue(rowIndex, entry.first, entry.second);
+                        }
                     }
                 }
             }
@@ -395,6 +430,7 @@ namespace storm {
 
             // Create the final model.
             exploredMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(modelComponents));
+            exploredMdpBackwardTransitions = boost::none;
             status = Status::ModelFinished;
             STORM_LOG_DEBUG(
                     "Explored Mdp with " << exploredMdp->getNumberOfStates() << " states (" << truncatedStates.getNumberOfSetBits() << " of which were flagged as truncated).");
@@ -415,7 +451,7 @@ namespace storm {
             for (uint64_t groupIndex = 0; groupIndex < exploredChoiceIndices.size() - 1; ++groupIndex) {
                 uint64_t rowIndex = exploredChoiceIndices[groupIndex];
                 // Check first row in group
-                if (exploredMdpTransitions[rowIndex].empty()) {
+                if (choiceIsEmpty(rowIndex)) {
                     relevantMdpChoices.set(rowIndex, false);
                     relevantMdpStates.set(groupIndex, false);
                 } else {
@@ -426,9 +462,9 @@ namespace storm {
                 // process remaining rows in group
                 for (++rowIndex; rowIndex < groupEnd; ++rowIndex) {
                     // Assert that all actions at the current state were consistently explored or unexplored.
-                    STORM_LOG_ASSERT(exploredMdpTransitions[rowIndex].empty() != relevantMdpStates.get(groupIndex),
+                    STORM_LOG_ASSERT(choiceIsEmpty(rowIndex) != relevantMdpStates.get(groupIndex),
                                      "Actions at 'old' MDP state " << groupIndex << " were only partly explored.");
-                    if (exploredMdpTransitions[rowIndex].empty()) {
+                    if (choiceIsEmpty(rowIndex)) {
                         relevantMdpChoices.set(rowIndex, false);
                     }
                 }
@@ -457,6 +493,15 @@ namespace storm {
                 }
             }
             { // exploredMdpTransitions
+                // The restored choices are copied explicitly as the row indices of the old MDP become invalid
+                for (auto const &choiceIndex : restoredChoices) {
+                    if (relevantMdpChoices.get(choiceIndex) && exploredMdpTransitions[choiceIndex].empty()) {
+                        for (auto const &transition : exploredMdp->getTransitionMatrix().getRow(choiceIndex)) {
+                            internalAddTransition(choiceIndex, transition.getColumn(), transition.getValue());
+                        }
+                    }
+                }
+                restoredChoices = restoredChoices % relevantMdpChoices;
                 storm::utility::vector::filterVectorInPlace(exploredMdpTransitions, relevantMdpChoices);
                 // Adjust column indices. Unfortunately, the fastest way seems to be to "rebuild" the map
                 // It might payoff to do this when building the matrix.
@@ -568,6 +613,10 @@ namespace storm {
         void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeValuesOfExploredMdp(storm::solver::OptimizationDirection const &dir) {
             STORM_LOG_ASSERT(status == Status::ModelFinished, "Method call is invalid in current status.");
             STORM_LOG_ASSERT(exploredMdp, "Tried to compute values but the MDP is not explored");
+            if (modifiedMdpStates) {
+                // Warm start from the values of the previous check
+                updateValuesOfModifiedStates(dir);
+            }
             auto property = createStandardProperty(dir, exploredMdp->hasRewardModel());
             auto task = createStandardCheckTask(property);
 
@@ -777,6 +826,80 @@ namespace storm {
             STORM_LOG_ASSERT(lowerValueBounds.size() == upperValueBounds.size() && values.size() == upperValueBounds.size(), "Value vectors have inconsistent size.");
         }
 
+        template<typename PomdpType, typename BeliefValueType>
+        bool BeliefMdpExplorer<PomdpType, BeliefValueType>::choiceIsEmpty(uint64_t const &choiceIndex) const {
+            return exploredMdpTransitions[choiceIndex].empty() && (choiceIndex >= restoredChoices.size() || !restoredChoices.get(choiceIndex));
+        }
+
+        template<typename PomdpType, typename BeliefValueType>
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::updateValuesOfModifiedStates(storm::solver::OptimizationDirection const &dir) {
+            STORM_LOG_ASSERT(modifiedMdpStates.is_initialized() && modifiedMdpStates->size() == exploredMdp->getNumberOfStates(), "Invalid information on modified states.");
+            auto const &transitions = exploredMdp->getTransitionMatrix();
+            auto const &choiceIndices = transitions.getRowGroupIndices();
+            auto const &targetStates = exploredMdp->getStates("target");
+            std::vector<ValueType> const *actionRewards = exploredMdp->hasRewardModel() ? &exploredMdp->getUniqueRewardModel().getStateActionRewardVector() : nullptr;
+            bool const minimize = storm::solver::minimize(dir);
+
+            auto bellmanUpdate = [&](uint64_t const &mdpState) {
+                ValueType result = transitions.multiplyRowWithVector(choiceIndices[mdpState], values);
+                if (actionRewards) {
+                    result += (*actionRewards)[choiceIndices[mdpState]];
+                }
+                for (uint64_t choice = choiceIndices[mdpState] + 1; choice < choiceIndices[mdpState + 1]; ++choice) {
+                    ValueType choiceValue = transitions.multiplyRowWithVector(choice, values);
+                    if (actionRewards) {
+                        choiceValue += (*actionRewards)[choice];
+                    }
+                    if (minimize ? choiceValue < result : choiceValue > result) {
+                        result = std::move(choiceValue);
+                    }
+                }
+                return result;
+            };
+
+            // The updates are only used to obtain a good hint for the subsequent check. We thus use a coarse precision and bound the number of updates.
+            ValueType const precision = storm::utility::convertNumber<ValueType>(1e-6);
+            uint64_t const maxNumberOfUpdates = 10 * exploredMdp->getNumberOfStates();
+            if (!exploredMdpBackwardTransitions) {
+                exploredMdpBackwardTransitions = transitions.transpose(true);
+            }
+            auto const &backwardTransitions = exploredMdpBackwardTransitions.get();
+
+            // Process the states with the largest change first. A state is queued at most once; its priority is the change that queued it.
+            std::priority_queue<std::pair<ValueType, uint64_t>> queue;
+            storm::storage::BitVector queuedStates(exploredMdp->getNumberOfStates(), false);
+            for (auto const &mdpState : modifiedMdpStates.get()) {
+                if (targetStates.get(mdpState)) {
+                    values[mdpState] = actionRewards ? storm::utility::zero<ValueType>() : storm::utility::one<ValueType>();
+                } else {
+                    queue.emplace(storm::utility::one<ValueType>(), mdpState);
+                    queuedStates.set(mdpState, true);
+                }
+            }
+            uint64_t numberOfUpdates = 0;
+            while (!queue.empty() && numberOfUpdates < maxNumberOfUpdates) {
+                uint64_t mdpState = queue.top().second;
+                queue.pop();
+                queuedStates.set(mdpState, false);
+                ValueType newValue = bellmanUpdate(mdpState);
+                ValueType difference = storm::utility::abs<ValueType>(newValue - values[mdpState]);
+                values[mdpState] = std::move(newValue);
+                ++numberOfUpdates;
+                if (difference > precision) {
+                    for (auto const &predecessor : backwardTransitions.getRow(mdpState)) {
+                        if (!targetStates.get(predecessor.getColumn()) && !queuedStates.get(predecessor.getColumn())) {
+                            queue.emplace(difference * predecessor.getValue(), predecessor.getColumn());
+                            queuedStates.set(predecessor.getColumn(), true);
+                        }
+                    }
+                }
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            }
+            STORM_LOG_DEBUG("Updated values of " << modifiedMdpStates->getNumberOfSetBits() << " modified MDP states (out of " << exploredMdp->getNumberOfStates() << ") using " << numberOfUpdates << " Bellman updates.");
+        }
+
         template<typename PomdpType, typename BeliefValueType>
         typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getOrAddMdpState(BeliefId const &beliefId) {
             exploredBeliefIds.grow(beliefId + 1, false);
@@ -8,6 +8,7 @@
 
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm-pomdp/storage/BeliefManager.h"
 #include "storm-pomdp/modelchecker/TrivialPomdpValueBoundsModelChecker.h"
 
@@ -51,6 +52,7 @@ namespace storm {
              * After calling this, the "currently explored" MDP has the same number of states and choices as the "old" one, but the choices are still empty
              * This method inserts the initial state of the MDP in the exploration queue.
              * While re-exploring, the reference to the old MDP remains valid.
+             * Choices whose old behavior is restored are not copied but taken over from the old MDP when finishing the exploration.
              */
             void restartExploration();
 
@@ -187,6 +189,17 @@ namespace storm {
 
             void insertValueHints(ValueType const &lowerBound, ValueType const &upperBound);
 
+            /*!
+             * Checks whether the given choice is neither explored nor restored from the old MDP.
+             */
+            bool choiceIsEmpty(uint64_t const &choiceIndex) const;
+
+            /*!
+             * Updates the values of the states whose behavior changed since the last check (and of their predecessors) by a prioritized sweep of Bellman updates.
+             * The values obtained from the last check serve as starting point so that the subsequent check (which uses the values as hint) only needs few iterations.
+             */
+            void updateValuesOfModifiedStates(storm::solver::OptimizationDirection const &dir);
+
             MdpStateType getOrAddMdpState(BeliefId const &beliefId);
             
             // Belief state related information
@@ -209,9 +222,15 @@ namespace storm {
             storm::storage::BitVector truncatedStates;
             MdpStateType initialMdpState;
             storm::storage::BitVector delayedExplorationChoices;
+            storm::storage::BitVector restoredChoices; // Choices of a restarted exploration that have the same behavior as in the old MDP
+
+            // States whose behavior changed since the last check. Only set if the values of the last check are available.
+            boost::optional<storm::storage::BitVector> modifiedMdpStates;
+            bool previousValuesAreComputed;
 
             // Final Mdp
             std::shared_ptr<storm::models::sparse::Mdp<ValueType>> exploredMdp;
+            boost::optional<storm::storage::SparseMatrix<ValueType>> exploredMdpBackwardTransitions; // Computed on demand, once per exploration
             
             // Value and scheduler related information
             storm::pomdp::modelchecker::TrivialPomdpValueBounds<ValueType> pomdpValueBounds;
@@ -1,5 +1,6 @@
 #include "BeliefExplorationPomdpModelChecker.h"
 
+#include <numeric>
 #include <tuple>
 
 #include <boost/algorithm/string.hpp>
@@ -285,6 +286,8 @@ namespace storm {
                     if (rewardModelName) {
                         overApproxBeliefManager->setRewardModel(rewardModelName);
                     }
+                    // Beliefs are re-expanded in each refinement step, so we can keep the expansions of beliefs whose successor resolutions did not change
+                    overApproxBeliefManager->setUseExpansionCache(options.cacheBeliefExpansions, options.beliefExpansionCacheSize);
                     overApproximation = std::make_shared<ExplorerType>(overApproxBeliefManager, pomdpValueBounds);
                     overApproxHeuristicPar.gapThreshold = options.gapThresholdInit;
                     overApproxHeuristicPar.observationThreshold = options.obsThresholdInit;
@@ -640,7 +643,15 @@ namespace storm {
                             }
                         }
                         bool expandedAtLeastOneAction = false;
-                        for (uint64 action = 0, numActions = beliefManager->getBeliefNumberOfChoices(currId); action < numActions; ++action) {
+                        uint64_t const numActions = beliefManager->getBeliefNumberOfChoices(currId);
+                        // If all actions are expanded anyway, we compute the successors of all actions at once (potentially in parallel)
+                        std::vector<std::vector<std::pair<typename BeliefManagerType::BeliefId, ValueType>>> allSuccessorGridPoints;
+                        if (exploreAllActions || truncateAllActions) {
+                            std::vector<uint64_t> actions(numActions);
+                            std::iota(actions.begin(), actions.end(), 0);
+                            allSuccessorGridPoints = beliefManager->expandAndTriangulateMultiple(currId, actions, observationResolutionVector);
+                        }
+                        for (uint64 action = 0; action < numActions; ++action) {
                             bool expandCurrentAction = exploreAllActions || truncateAllActions;
                             if (checkRewireForAllActions) {
                                 assert(refine);
@@ -674,7 +685,7 @@ namespace storm {
                                 expandedAtLeastOneAction = true;
                                 if (!truncateAllActions) {
                                     // Cases 1.1, 2.1, or 3.1
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    auto successorGridPoints = allSuccessorGridPoints.empty() ? beliefManager->expandAndTriangulate(currId, action, observationResolutionVector) : std::move(allSuccessorGridPoints[action]);
                                     for (auto const& successor : successorGridPoints) {
                                         overApproximation->addTransitionToBelief(action, successor.first, successor.second, false);
                                     }
@@ -685,7 +696,7 @@ namespace storm {
                                     // Cases 1.2 or 2.2
                                     ValueType truncationProbability = storm::utility::zero<ValueType>();
                                     ValueType truncationValueBound = storm::utility::zero<ValueType>();
-                                    auto successorGridPoints = beliefManager->expandAndTriangulate(currId, action, observationResolutionVector);
+                                    auto successorGridPoints = allSuccessorGridPoints.empty() ? beliefManager->expandAndTriangulate(currId, action, observationResolutionVector) : std::move(allSuccessorGridPoints[action]);
                                     for (auto const& successor : successorGridPoints) {
                                         bool added = overApproximation->addTransitionToBelief(action, successor.first, successor.second, true);
                                         if (!added) {
@@ -39,6 +39,8 @@ namespace storm {
                 
                 ValueType numericPrecision = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(1e-9); /// Used to decide whether two beliefs are equal
                 bool dynamicTriangulation = true; // Sets whether the triangulation is done in a dynamic way (yielding more precise triangulations)
+                bool cacheBeliefExpansions = false; // Sets whether the triangulated successors of beliefs are cached across refinement steps
+                uint64_t beliefExpansionCacheSize = 100000; // The maximal number of cached belief expansions. The cache is cleared once it is full.
             };
         }
     }
@@ -4,6 +4,12 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "storm/adapters/IntelTbbAdapter.h"
+#endif
 
 namespace storm {
     namespace storage {
@@ -41,7 +47,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
-                : pomdp(pomdp), triangulationMode(triangulationMode) {
+                : pomdp(pomdp), triangulationMode(triangulationMode), useExpansionCache(false), expansionCacheSizeLimit(0) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
             beliefToIdMap.resize(pomdp.getNrObservations());
             initialBeliefId = computeInitialBelief();
@@ -138,7 +144,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         template<typename DistributionType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const {
             auto insertionRes = distr.emplace(state, value);
             if (!insertionRes.second) {
                 insertionRes.first->second += value;
@@ -264,12 +270,12 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+        bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, GridPointTriangulation const &triangulation) const {
             if (triangulation.weights.size() != triangulation.gridPoints.size()) {
                 STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
                 return false;
             }
-            if (triangulation.size() == 0) {
+            if (triangulation.weights.empty()) {
                 STORM_LOG_ERROR("Empty triangulation.");
                 return false;
             }
@@ -288,7 +294,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+                BeliefType const &gridPoint = triangulation.gridPoints[i];
                 for (auto const &pointEntry : gridPoint) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -309,14 +315,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const {
             STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             StateType numEntries = belief.size();
@@ -365,14 +371,14 @@ namespace storm {
                             gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                         }
                     }
-                    result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+                    result.gridPoints.push_back(std::move(gridPoint));
                 }
                 previousSortedDiff = currentSortedDiff++;
             }
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result) {
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const {
             // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is minimal
             STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
             BeliefValueType finalResolution = resolution;
@@ -409,14 +415,14 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
-        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::GridPointTriangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-            Triangulation result;
+            GridPointTriangulation result;
             // Quickly triangulate Dirac beliefs
             if (belief.size() == 1u) {
                 result.weights.push_back(storm::utility::one<BeliefValueType>());
-                result.gridPoints.push_back(getOrAddBeliefId(belief));
+                result.gridPoints.push_back(belief);
             } else {
                 auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
                 switch (triangulationMode) {
@@ -430,58 +436,191 @@ namespace storm {
                         STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
                 }
             }
-            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
+            STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation.");
             return result;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
-        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
-                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
-            std::vector<std::pair<BeliefId, ValueType>> destinations;
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
+        BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution) {
+            GridPointTriangulation gridPointTriangulation = computeTriangulation(belief, resolution);
+            Triangulation result;
+            result.weights = std::move(gridPointTriangulation.weights);
+            result.gridPoints.reserve(gridPointTriangulation.gridPoints.size());
+            for (auto const &gridPoint : gridPointTriangulation.gridPoints) {
+                result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            }
+            return result;
+        }
 
-            BeliefType belief = getBelief(beliefId);
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::Expansion
+        BeliefManager<PomdpType, BeliefValueType, StateType>::computeExpansion(BeliefType const &belief, uint64_t actionIndex,
+                                                                               boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            Expansion result;
 
-            // Find the probability we go to each observation
+            // Collect the (unnormalized) successor distribution for each successor observation in a single pass.
+            // The contributions are stored in the order they are encountered so that the normalized successor beliefs are accumulated exactly as before.
             BeliefType successorObs; // This is actually not a belief but has the same type
+            boost::container::flat_map<uint32_t, std::vector<std::pair<StateType, BeliefValueType>>> successorContributions;
             for (auto const &pointEntry : belief) {
                 uint64_t state = pointEntry.first;
                 for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
                     if (!storm::utility::isZero(pomdpTransition.getValue())) {
                         auto obs = pomdp.getObservation(pomdpTransition.getColumn());
-                        addToDistribution(successorObs, obs, pointEntry.second * pomdpTransition.getValue());
+                        BeliefValueType prob = pointEntry.second * pomdpTransition.getValue();
+                        addToDistribution(successorObs, obs, prob);
+                        successorContributions[obs].emplace_back(pomdpTransition.getColumn(), std::move(prob));
                     }
                 }
             }
 
             // Now for each successor observation we find and potentially triangulate the successor belief
+            result.successorObservations.reserve(successorObs.size());
+            auto contributionsIt = successorContributions.begin();
             for (auto const &successor : successorObs) {
+                STORM_LOG_ASSERT(contributionsIt != successorContributions.end() && contributionsIt->first == successor.first, "Unexpected successor observation.");
                 BeliefType successorBelief;
-                for (auto const &pointEntry : belief) {
-                    uint64_t state = pointEntry.first;
-                    for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
-                        if (pomdp.getObservation(pomdpTransition.getColumn()) == successor.first) {
-                            ValueType prob = pointEntry.second * pomdpTransition.getValue() / successor.second;
-                            addToDistribution(successorBelief, pomdpTransition.getColumn(), prob);
-                        }
-                    }
+                successorBelief.reserve(contributionsIt->second.size());
+                for (auto const &contribution : contributionsIt->second) {
+                    addToDistribution(successorBelief, contribution.first, contribution.second / successor.second);
                 }
+                ++contributionsIt;
                 STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+                result.successorObservations.push_back(successor.first);
 
                 // Insert the destination. We know that destinations have to be disjoined since they have different observations
                 if (observationTriangulationResolutions) {
-                    Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.get()[successor.first]);
-                    for (size_t j = 0; j < triangulation.size(); ++j) {
+                    GridPointTriangulation triangulation = computeTriangulation(successorBelief, observationTriangulationResolutions.get()[successor.first]);
+                    for (size_t j = 0; j < triangulation.weights.size(); ++j) {
                         // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                        destinations.emplace_back(triangulation.gridPoints[j], triangulation.weights[j] * successor.second);
+                        result.destinations.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
                     }
                 } else {
-                    destinations.emplace_back(getOrAddBeliefId(successorBelief), successor.second);
+                    result.destinations.emplace_back(std::move(successorBelief), successor.second);
                 }
             }
+            return result;
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::insertExpansion(BeliefId const &beliefId, uint64_t actionIndex, Expansion const &expansion,
+                                                                              boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            std::vector<std::pair<BeliefId, ValueType>> destinations;
+            destinations.reserve(expansion.destinations.size());
+            for (auto const &destination : expansion.destinations) {
+                destinations.emplace_back(getOrAddBeliefId(destination.first), destination.second);
+            }
+            if (useExpansionCache) {
+                auto key = std::make_pair(beliefId, actionIndex);
+                if (expansionCache.size() >= expansionCacheSizeLimit && expansionCache.count(key) == 0) {
+                    // Bound the memory consumption. The expansions of the current refinement step will be cached again when they are needed.
+                    STORM_LOG_TRACE("Clearing the belief expansion cache as it reached its size limit of " << expansionCacheSizeLimit << " entries.");
+                    expansionCache.clear();
+                }
+                CachedExpansion &cached = expansionCache[key];
+                cached.triangulated = observationTriangulationResolutions.is_initialized();
+                cached.successorObservationResolutions.clear();
+                for (auto const &obs : expansion.successorObservations) {
+                    cached.successorObservationResolutions.emplace_back(obs, cached.triangulated ? observationTriangulationResolutions.get()[obs] : storm::utility::zero<BeliefValueType>());
+                }
+                cached.destinations = destinations;
+            }
             return destinations;
+        }
 
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::CachedExpansion const*
+        BeliefManager<PomdpType, BeliefValueType, StateType>::getCachedExpansion(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                                 boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const {
+            if (!useExpansionCache) {
+                return nullptr;
+            }
+            auto findRes = expansionCache.find(std::make_pair(beliefId, actionIndex));
+            if (findRes == expansionCache.end()) {
+                return nullptr;
+            }
+            CachedExpansion const &cached = findRes->second;
+            if (cached.triangulated != observationTriangulationResolutions.is_initialized()) {
+                return nullptr;
+            }
+            if (cached.triangulated) {
+                // The triangulation of a successor only depends on the resolution of its observation.
+                for (auto const &obsResolution : cached.successorObservationResolutions) {
+                    if (obsResolution.second != observationTriangulationResolutions.get()[obsResolution.first]) {
+                        return nullptr;
+                    }
+                }
+            }
+            return &cached;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId const &beliefId, uint64_t actionIndex,
+                                                                             boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
+            if (CachedExpansion const* cached = getCachedExpansion(beliefId, actionIndex, observationTriangulationResolutions)) {
+                return cached->destinations;
+            }
+            return insertExpansion(beliefId, actionIndex, computeExpansion(getBelief(beliefId), actionIndex, observationTriangulationResolutions), observationTriangulationResolutions);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        std::vector<std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId, typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>>
+        BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulateMultiple(BeliefId const &beliefId, std::vector<uint64_t> const &actionIndices,
+                                                                                           std::vector<BeliefValueType> const &observationResolutions) {
+            boost::optional<std::vector<BeliefValueType>> resolutions(observationResolutions);
+            std::vector<std::vector<std::pair<BeliefId, ValueType>>> result(actionIndices.size());
+
+            // Gather the actions that need to be expanded
+            std::vector<uint64_t> missingActions;
+            for (uint64_t i = 0; i < actionIndices.size(); ++i) {
+                if (CachedExpansion const* cached = getCachedExpansion(beliefId, actionIndices[i], resolutions)) {
+                    result[i] = cached->destinations;
+                } else {
+                    missingActions.push_back(i);
+                }
+            }
+
+            // Compute the expansions. This does not modify the belief storage, so it can be done concurrently.
+            BeliefType const &belief = getBelief(beliefId);
+            std::vector<Expansion> expansions(missingActions.size());
+#ifdef STORM_HAVE_INTELTBB
+            if (missingActions.size() > 1 && storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, missingActions.size()), [&](tbb::blocked_range<uint64_t> const &range) {
+                    for (uint64_t i = range.begin(); i < range.end(); ++i) {
+                        expansions[i] = computeExpansion(belief, actionIndices[missingActions[i]], resolutions);
+                    }
+                });
+            } else {
+#endif
+                for (uint64_t i = 0; i < missingActions.size(); ++i) {
+                    expansions[i] = computeExpansion(belief, actionIndices[missingActions[i]], resolutions);
+                }
+#ifdef STORM_HAVE_INTELTBB
+            }
+#endif
+
+            // Insert the new beliefs sequentially (in the order of the actions) to obtain deterministic belief ids.
+            for (uint64_t i = 0; i < missingActions.size(); ++i) {
+                result[missingActions[i]] = insertExpansion(beliefId, actionIndices[missingActions[i]], expansions[i], resolutions);
+            }
+            return result;
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::setUseExpansionCache(bool value, uint64_t sizeLimit) {
+            useExpansionCache = value && sizeLimit > 0;
+            expansionCacheSizeLimit = sizeLimit;
+            if (!useExpansionCache) {
+                clearExpansionCache();
+            }
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        void BeliefManager<PomdpType, BeliefValueType, StateType>::clearExpansionCache() {
+            expansionCache.clear();
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -5,6 +5,7 @@
 #include <boost/optional.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <boost/functional/hash.hpp>
 
 #include "storm/utility/ConstantsComparator.h"
 
@@ -58,7 +59,7 @@ namespace storm {
             Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
             template<typename DistributionType>
-            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+            void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
             void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -69,6 +70,24 @@ namespace storm {
 
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
+            /*!
+             * Expands and triangulates the given belief for each of the given actions.
+             * The successor beliefs and their triangulations are computed in parallel (if enabled) and only inserted into the belief storage afterwards.
+             * @return for each given action, the resulting grid points together with their probabilities (same as expandAndTriangulate)
+             */
+            std::vector<std::vector<std::pair<BeliefId, ValueType>>>
+            expandAndTriangulateMultiple(BeliefId const &beliefId, std::vector<uint64_t> const &actionIndices, std::vector<BeliefValueType> const &observationResolutions);
+
+            /*!
+             * If set, the results of expanding a belief-action pair are cached. A cached result is reused as long as the
+             * resolutions of the successor observations do not change, which avoids re-triangulating beliefs in subsequent refinement steps.
+             * The cache is disabled by default.
+             * @param sizeLimit the maximal number of cached expansions. If a new expansion would exceed it, the cache is cleared first. A limit of 0 disables the cache.
+             */
+            void setUseExpansionCache(bool value, uint64_t sizeLimit);
+
+            void clearExpansionCache();
+
         private:
 
             struct BeliefHash {
@@ -83,6 +102,28 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
+            /*!
+             * A triangulation whose grid points are not (yet) inserted into the belief storage.
+             */
+            struct GridPointTriangulation {
+                std::vector<BeliefType> gridPoints;
+                std::vector<BeliefValueType> weights;
+            };
+
+            /*!
+             * The result of expanding a belief-action pair before the destinations are inserted into the belief storage.
+             */
+            struct Expansion {
+                std::vector<uint32_t> successorObservations;
+                std::vector<std::pair<BeliefType, ValueType>> destinations;
+            };
+
+            struct CachedExpansion {
+                bool triangulated;
+                std::vector<std::pair<uint32_t, BeliefValueType>> successorObservationResolutions;
+                std::vector<std::pair<BeliefId, ValueType>> destinations;
+            };
+
             BeliefType const &getBelief(BeliefId const &id) const;
 
             BeliefId getId(BeliefType const &belief) const;
@@ -93,16 +134,37 @@ namespace storm {
 
             bool assertBelief(BeliefType const &belief) const;
 
-            bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+            bool assertTriangulation(BeliefType const &belief, GridPointTriangulation const &triangulation) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            uint32_t getBeliefObservation(BeliefType const &belief) const;
 
-            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const;
 
-            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+            void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, GridPointTriangulation &result) const;
+
+            /*!
+             * Computes the triangulation of the given belief without modifying the belief storage.
+             */
+            GridPointTriangulation computeTriangulation(BeliefType const &belief, BeliefValueType const &resolution) const;
 
             Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
 
+            /*!
+             * Computes the successor beliefs (and potentially their triangulations) without modifying the belief storage.
+             * As this only reads existing beliefs, it can be invoked concurrently as long as no new beliefs are inserted.
+             */
+            Expansion computeExpansion(BeliefType const &belief, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
+            /*!
+             * Inserts the destinations of the given expansion into the belief storage (and into the expansion cache, if enabled).
+             */
+            std::vector<std::pair<BeliefId, ValueType>> insertExpansion(BeliefId const &beliefId, uint64_t actionIndex, Expansion const &expansion, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions);
+
+            /*!
+             * Retrieves the cached expansion for the given belief-action pair if it is still valid for the given resolutions.
+             */
+            CachedExpansion const* getCachedExpansion(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) const;
+
             std::vector<std::pair<BeliefId, ValueType>>
             expandInternal(BeliefId const &beliefId, uint64_t actionIndex, boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = boost::none);
 
@@ -120,6 +182,10 @@ namespace storm {
             storm::utility::ConstantsComparator<ValueType> cc;
             
             TriangulationMode triangulationMode;
+
+            bool useExpansionCache;
+            uint64_t expansionCacheSizeLimit;
+            std::unordered_map<std::pair<BeliefId, uint64_t>, CachedExpansion, boost::hash<std::pair<BeliefId, uint64_t>>> expansionCache;
             
         };
     }
@@ -66,16 +66,30 @@ namespace storm {
 
         template <typename ValueType, typename IndexType>
         void exportShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::shared_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> const& shield, std::string const& filename) {
+            std::string jsonFileExtension = ".json";
+            bool exportAsJson = filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin());
+            // The json format refers to the choices of the model, so it can not be written without one.
+            STORM_LOG_THROW(!exportAsJson || model, storm::exceptions::NotSupportedException, "Exporting a shield to json requires the model, which is not available for shield '" << filename << "'. Please use another file format.");
             std::ofstream stream;
             storm::utility::openFile(filename, stream);
-            std::string jsonFileExtension = ".json";
-            if (filename.size() > 4 && std::equal(jsonFileExtension.rbegin(), jsonFileExtension.rend(), filename.rbegin())) {
+            if (exportAsJson) {
                 shield->printJsonToStream(stream, model);
             } else {
                 shield->printToStream(stream, model);
             }
             storm::utility::closeFile(stream);
         }
+
+        /*!
+         * Exports the shield to each of the given files (the format is chosen per file as above). The shield is only
+         * constructed once for all files.
+         */
+        template <typename ValueType, typename IndexType>
+        void exportShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::shared_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> const& shield, std::vector<std::string> const& filenames) {
+            for (auto const& filename : filenames) {
+                exportShield(model, shield, filename);
+            }
+        }
         
         template <typename ValueType>
         inline void exportCheckResultToJson(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::unique_ptr<storm::modelchecker::CheckResult> const& checkResult, std::string const& filename) {
@@ -139,6 +139,11 @@ namespace storm {
                 if (checker.canHandle(task)) {
                     result = checker.check(env, task);
                 }
+            } else if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+                storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Smg<ValueType>> checker(program);
+                if (checker.canHandle(task)) {
+                    result = checker.check(env, task);
+                }
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << program.getModelType() << " is not supported by the exploration engine.");
             }
@@ -21,18 +21,25 @@ namespace storm {
     namespace automata {
 
 
-        std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
 #ifdef STORM_HAVE_SPOT
-            std::string prefixLtl = f.toPrefixString();
-
-            spot::parsed_formula spotPrefixLtl = spot::parse_prefix_ltl(prefixLtl);
-            if(!spotPrefixLtl.errors.empty()){
-                std::ostringstream errorMsg;
-                spotPrefixLtl.format_errors(errorMsg);
-                STORM_LOG_THROW(false, storm::exceptions::ExpressionEvaluationException, "Spot could not parse formula: " << prefixLtl << ": " << errorMsg.str());
+        namespace {
+            spot::formula toSpotFormula(storm::logic::Formula const& f) {
+                std::string prefixLtl = f.toPrefixString();
+
+                spot::parsed_formula spotPrefixLtl = spot::parse_prefix_ltl(prefixLtl);
+                if(!spotPrefixLtl.errors.empty()){
+                    std::ostringstream errorMsg;
+                    spotPrefixLtl.format_errors(errorMsg);
+                    STORM_LOG_THROW(false, storm::exceptions::ExpressionEvaluationException, "Spot could not parse formula: " << prefixLtl << ": " << errorMsg.str());
+                }
+                return spotPrefixLtl.f;
             }
-            spot::formula spotFormula = spotPrefixLtl.f;
+        }
+#endif
 
+        std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(storm::logic::Formula const& f, bool dnf) {
+#ifdef STORM_HAVE_SPOT
+            spot::formula spotFormula = toSpotFormula(f);
 
             // Request a deterministic, complete automaton with state-based acceptance
             spot::translator trans = spot::translator();
@@ -64,6 +71,29 @@ namespace storm {
 #endif
         }
 
+        std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2dpaSpot(storm::logic::Formula const& f) {
+#ifdef STORM_HAVE_SPOT
+            spot::formula spotFormula = toSpotFormula(f);
+
+            // Request a deterministic, complete parity automaton with state-based acceptance in which every state belongs to exactly one acceptance set
+            spot::translator trans = spot::translator();
+            trans.set_type(spot::postprocessor::ParityMinEven);
+            trans.set_pref(spot::postprocessor::Deterministic | spot::postprocessor::SBAcc | spot::postprocessor::Complete | spot::postprocessor::Colored);
+            STORM_LOG_INFO("Construct deterministic parity automaton for "<< spotFormula);
+            auto aut = trans.run(spotFormula);
+
+            STORM_LOG_INFO("The deterministic parity automaton has " << aut->num_states() << " states and acceptance condition:  "<< aut->get_acceptance());
+
+            std::stringstream autStream;
+            // Print reachable states in HOA format, implicit edges (i), state-based acceptance (s)
+            spot::print_hoa(autStream, aut, "is");
+
+            return DeterministicAutomaton::parse(autStream);
+#else
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Storm is compiled without Spot support.");
+#endif
+        }
+
         std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
             std::string prefixLtl = f.toPrefixString();
 
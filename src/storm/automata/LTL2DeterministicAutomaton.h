@@ -26,6 +26,16 @@ namespace storm {
              */
             static std::shared_ptr<DeterministicAutomaton> ltl2daSpot(storm::logic::Formula const& f, bool dnf);
 
+            /*!
+             * Converts an LTL formula into a deterministic parity automaton using the internal LTL2DA tool "Spot".
+             * The resulting DA uses state-based "parity min even" acceptance and every state belongs to exactly one
+             * acceptance set, i.e., the index of this set is the priority of the state.
+             *
+             * @param f The LTL formula.
+             * @return A parity automaton equivalent to the formula.
+             */
+            static std::shared_ptr<DeterministicAutomaton> ltl2dpaSpot(storm::logic::Formula const& f);
+
             /*!
              * Converts an LTL formula into a deterministic omega-automaton using an external LTL2DA tool.
              * The external tool must guarantee transition-based acceptance.
@@ -3,6 +3,8 @@
 #include "storm/builder/TerminalStatesGetter.h"
 
 #include "storm/logic/Formulas.h"
+#include "storm/logic/CloneVisitor.h"
+#include "storm/logic/FragmentSpecification.h"
 #include "storm/logic/LiftableTransitionRewardsVisitor.h"
 
 #include "storm/settings/SettingsManager.h"
@@ -14,6 +16,36 @@
 namespace storm {
     namespace builder {
         
+        namespace {
+            /*!
+             * The formulas whose satisfaction does not depend on the number of steps in which invisible transitions
+             * are taken and that are thus preserved by partial-order reduction.
+             */
+            storm::logic::FragmentSpecification stutterInvariant() {
+                storm::logic::FragmentSpecification result = storm::logic::propositional();
+                result.setProbabilityOperatorsAllowed(true);
+                result.setGameFormulasAllowed(true);
+                result.setUntilFormulasAllowed(true);
+                result.setReachabilityProbabilityFormulasAllowed(true);
+                result.setGloballyFormulasAllowed(true);
+                return result;
+            }
+
+            /*!
+             * Collects the coalitions of all (possibly nested) game formulas. The coalitions are gathered in the vector
+             * that is passed (as a pointer) as the data of the visitor.
+             */
+            class CoalitionCollector : public storm::logic::CloneVisitor {
+            public:
+                virtual boost::any visit(storm::logic::GameFormula const& f, boost::any const& data) const override {
+                    boost::any_cast<std::vector<storm::logic::PlayerCoalition>*>(data)->push_back(f.getCoalition());
+                    return storm::logic::CloneVisitor::visit(f, data);
+                }
+
+                using storm::logic::CloneVisitor::visit;
+            };
+        }
+
         LabelOrExpression::LabelOrExpression(storm::expressions::Expression const& expression) : labelOrExpression(expression) {
             // Intentionally left empty.
         }
@@ -39,7 +71,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0), partialOrderReduction(false), partialOrderReductionAdmissible(true) {
             // Intentionally left empty.
         }
         
@@ -92,6 +124,8 @@ namespace storm {
             }
             
             scaleAndLiftTransitionRewards = scaleAndLiftTransitionRewards && storm::logic::LiftableTransitionRewardsVisitor(modelDescription).areTransitionRewardsLiftable(formula);
+            partialOrderReductionAdmissible = partialOrderReductionAdmissible && formula.isInFragment(stutterInvariant());
+            formula.accept(CoalitionCollector(), &coalitions);
         }
         
         void BuilderOptions::setTerminalStatesFromFormula(storm::logic::Formula const& formula) {
@@ -171,6 +205,26 @@ namespace storm {
             return addOverlappingGuardsLabel;
         }
 
+        std::vector<std::vector<std::string>> const& BuilderOptions::getSymmetricModules() const {
+            return symmetricModules;
+        }
+
+        bool BuilderOptions::isSymmetryReductionSet() const {
+            return !symmetricModules.empty();
+        }
+
+        bool BuilderOptions::isPartialOrderReductionSet() const {
+            return partialOrderReduction;
+        }
+
+        bool BuilderOptions::isPartialOrderReductionAdmissible() const {
+            return partialOrderReductionAdmissible;
+        }
+
+        std::vector<storm::logic::PlayerCoalition> const& BuilderOptions::getCoalitions() const {
+            return coalitions;
+        }
+
         BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
             buildAllRewardModels = newValue;
             return *this;
@@ -272,6 +326,16 @@ namespace storm {
             return *this;
         }
 
+        BuilderOptions& BuilderOptions::addSymmetricModules(std::vector<std::string> const& moduleOrPlayerNames) {
+            symmetricModules.push_back(moduleOrPlayerNames);
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+            partialOrderReduction = newValue;
+            return *this;
+        }
+
         BuilderOptions& BuilderOptions::substituteExpressions(std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
             for (auto& e : expressionLabels) {
                 e.second = substitutionFunction(e.second);
@@ -9,6 +9,7 @@
 
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/SymbolicModelDescription.h"
+#include "storm/logic/PlayerCoalition.h"
 
 namespace storm {
     namespace expressions {
@@ -118,6 +119,20 @@ namespace storm {
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
             uint64_t getShowProgressDelay() const;
+            std::vector<std::vector<std::string>> const& getSymmetricModules() const;
+            bool isSymmetryReductionSet() const;
+            bool isPartialOrderReductionSet() const;
+
+            /*!
+             * Retrieves whether all formulas that are to be preserved are invariant under stuttering (i.e. contain
+             * neither next nor bounded operators nor rewards) such that partial-order reduction may be applied.
+             */
+            bool isPartialOrderReductionAdmissible() const;
+
+            /*!
+             * Retrieves the coalitions of the game formulas that are to be preserved.
+             */
+            std::vector<storm::logic::PlayerCoalition> const& getCoalitions() const;
 
             /**
              * Should all reward models be built? If not set, only required reward models are build.
@@ -210,6 +225,22 @@ namespace storm {
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
             BuilderOptions& setReservedBitsForUnboundedVariables(uint64_t value);
+
+            /**
+             * Declares a group of symmetric modules (or players) whose permutations are identified during the exploration.
+             * This is only supported for PRISM programs, see storm::generator::SymmetryReduction for the requirements.
+             * @param moduleOrPlayerNames The names of the symmetric modules (or players)
+             * @return this
+             */
+            BuilderOptions& addSymmetricModules(std::vector<std::string> const& moduleOrPlayerNames);
+
+            /**
+             * Should the exploration of PRISM MDPs and SMGs apply partial-order reduction? The reduction is only applied
+             * if the preserved formulas admit it.
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setPartialOrderReduction(bool newValue = true);
             
             /**
              * Substitutes all expressions occurring in these options.
@@ -276,6 +307,18 @@ namespace storm {
 
             /// The delay for printing progress information.
             uint64_t showProgressDelay;
+
+            /// The groups of symmetric modules (or players) whose permutations are identified during exploration.
+            std::vector<std::vector<std::string>> symmetricModules;
+
+            /// A flag indicating whether partial-order reduction is to be applied.
+            bool partialOrderReduction;
+
+            /// A flag that stores whether all preserved formulas are invariant under stuttering.
+            bool partialOrderReductionAdmissible;
+
+            /// The coalitions of the game formulas that are to be preserved.
+            std::vector<storm::logic::PlayerCoalition> coalitions;
             
         };
         
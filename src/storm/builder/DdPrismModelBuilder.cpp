@@ -593,11 +593,13 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         struct DdPrismModelBuilder<Type, ValueType>::SystemResult {
-            SystemResult(storm::dd::Add<Type, ValueType> const& allTransitionsDd, DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram const& globalModule, boost::optional<storm::dd::Add<Type, ValueType>> const& stateActionDd) : allTransitionsDd(allTransitionsDd), globalModule(globalModule), stateActionDd(stateActionDd) {
+            SystemResult(storm::dd::Add<Type, ValueType> const& allTransitionsDd, std::vector<storm::dd::Bdd<Type>> const& actionTransitionsBdds, DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram const& globalModule, boost::optional<storm::dd::Add<Type, ValueType>> const& stateActionDd) : allTransitionsDd(allTransitionsDd), actionTransitionsBdds(actionTransitionsBdds), globalModule(globalModule), stateActionDd(stateActionDd) {
                 // Intentionally left empty.
             }
             
             storm::dd::Add<Type, ValueType> allTransitionsDd;
+            // The transitions of the actions of the system, whose union forms the transitions of the system.
+            std::vector<storm::dd::Bdd<Type>> actionTransitionsBdds;
             typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram globalModule;
             boost::optional<storm::dd::Add<Type, ValueType>> stateActionDd;
         };
@@ -1032,7 +1034,7 @@ namespace storm {
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module) {
+        storm::dd::Add<Type, ValueType> DdPrismModelBuilder<Type, ValueType>::createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module, std::vector<storm::dd::Bdd<Type>>& actionTransitionsBdds) {
             storm::dd::Add<Type, ValueType> result;
             
             // Make sure all actions contain all necessary meta variables.
@@ -1090,9 +1092,11 @@ namespace storm {
                 
                 // Add variables for synchronization.
                 result *= getSynchronizationDecisionDiagram(generationInfo);
+                actionTransitionsBdds.push_back(result.notZero());
                 
                 for (auto& synchronizingAction : synchronizingActionToDdMap) {
                     synchronizingAction.second *= getSynchronizationDecisionDiagram(generationInfo, synchronizingAction.first);
+                    actionTransitionsBdds.push_back(synchronizingAction.second.notZero());
                 }
                 
                 // Now, we can simply add all synchronizing actions to the result.
@@ -1112,6 +1116,7 @@ namespace storm {
                 }
 
                 result = identityEncoding * module.independentAction.transitionsDd;
+                actionTransitionsBdds.push_back(result.notZero());
                 for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
                     // Compute missing global variable identities in synchronizing actions.
                     missingIdentities = std::set<storm::expressions::Variable>();
@@ -1122,7 +1127,9 @@ namespace storm {
                         identityEncoding *= generationInfo.variableToIdentityMap.at(variable);
                     }
                     
-                    result += identityEncoding * synchronizingAction.second.transitionsDd;
+                    storm::dd::Add<Type, ValueType> actionTransitionsDd = identityEncoding * synchronizingAction.second.transitionsDd;
+                    actionTransitionsBdds.push_back(actionTransitionsDd.notZero());
+                    result += actionTransitionsDd;
                 }
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Illegal model type.");
@@ -1130,12 +1137,34 @@ namespace storm {
             return result;
         }
         
+        template <storm::dd::DdType Type, typename ValueType>
+        std::shared_ptr<storm::prism::Composition> DdPrismModelBuilder<Type, ValueType>::createBalancedDefaultSystemComposition(storm::prism::Program const& program) {
+            std::vector<std::shared_ptr<storm::prism::Composition>> compositions;
+            for (auto const& module : program.getModules()) {
+                compositions.push_back(std::make_shared<storm::prism::ModuleComposition>(module.getName()));
+            }
+            
+            // Synchronizing over the common actions is associative, so we may compose neighbouring subsystems level by level.
+            while (compositions.size() > 1) {
+                std::vector<std::shared_ptr<storm::prism::Composition>> nextLevel;
+                for (uint_fast64_t index = 0; index + 1 < compositions.size(); index += 2) {
+                    nextLevel.push_back(std::make_shared<storm::prism::SynchronizingParallelComposition>(compositions[index], compositions[index + 1]));
+                }
+                if (compositions.size() % 2 == 1) {
+                    nextLevel.push_back(compositions.back());
+                }
+                compositions = std::move(nextLevel);
+            }
+            return compositions.front();
+        }
+        
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(GenerationInformation& generationInfo) {
             ModuleComposer<Type, ValueType> composer(generationInfo);
-            ModuleDecisionDiagram system = composer.compose(generationInfo.program.specifiesSystemComposition() ? generationInfo.program.getSystemCompositionConstruct().getSystemComposition() : *generationInfo.program.getDefaultSystemComposition());
+            ModuleDecisionDiagram system = composer.compose(generationInfo.program.specifiesSystemComposition() ? generationInfo.program.getSystemCompositionConstruct().getSystemComposition() : *createBalancedDefaultSystemComposition(generationInfo.program));
 
-            storm::dd::Add<Type, ValueType> result = createSystemFromModule(generationInfo, system);
+            std::vector<storm::dd::Bdd<Type>> actionTransitionsBdds;
+            storm::dd::Add<Type, ValueType> result = createSystemFromModule(generationInfo, system, actionTransitionsBdds);
 
             // Create an auxiliary DD that is used later during the construction of reward models.
             boost::optional<storm::dd::Add<Type, ValueType>> stateActionDd;
@@ -1153,7 +1182,7 @@ namespace storm {
                 generationInfo.nondeterminismMetaVariables.resize(system.numberOfUsedNondeterminismVariables);
             }
             
-            return SystemResult(result, system, stateActionDd);
+            return SystemResult(result, actionTransitionsBdds, system, stateActionDd);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1349,7 +1378,14 @@ namespace storm {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
             }
             
-            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables).first;
+            // The exploration chains the transitions of the individual actions, which are much smaller than the union of all transitions.
+            for (auto& actionTransitionsBdd : system.actionTransitionsBdds) {
+                actionTransitionsBdd &= !terminalStatesBdd;
+                if (program.getModelType() == storm::prism::Program::ModelType::MDP) {
+                    actionTransitionsBdd = actionTransitionsBdd.existsAbstract(generationInfo.allNondeterminismVariables);
+                }
+            }
+            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStatesByChaining<Type>(initialStates, system.actionTransitionsBdds, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables).first;
             storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
             transitionMatrix *= reachableStatesAdd;
             if (system.stateActionDd) {
@@ -10,6 +10,8 @@
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
 
+#include "storm/utility/profiling.h"
+
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/generator/JaniNextStateGenerator.h"
 
@@ -99,6 +101,7 @@ namespace storm {
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+            STORM_PROFILE_SCOPE("builder.state-lookup");
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
 
             // Check, if the state was already registered.
@@ -107,6 +110,7 @@ namespace storm {
             StateType actualIndex = actualIndexBucketPair.first;
 
             if (actualIndex == newIndex) {
+                STORM_PROFILE_COUNT("builder.new-states", 1);
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
                     statesToExplore.emplace_front(state, actualIndex);
 
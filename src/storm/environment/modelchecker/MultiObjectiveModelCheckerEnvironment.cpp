@@ -42,6 +42,7 @@ namespace storm {
         }
         
         printResults = multiobjectiveSettings.isPrintResultsSet();
+        weightVectorBatchSize = multiobjectiveSettings.getWeightVectorBatchSize();
     }
     
     MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -159,4 +160,13 @@ namespace storm {
     void MultiObjectiveModelCheckerEnvironment::setPrintResults(bool value) {
         printResults = value;
     }
+    
+    uint64_t const& MultiObjectiveModelCheckerEnvironment::getWeightVectorBatchSize() const {
+        return weightVectorBatchSize;
+    }
+    
+    void MultiObjectiveModelCheckerEnvironment::setWeightVectorBatchSize(uint64_t const& value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The number of concurrently checked weight vectors has to be positive.");
+        weightVectorBatchSize = value;
+    }
 }
\ No newline at end of file
@@ -61,6 +61,9 @@ namespace storm {
         bool isPrintResultsSet() const;
         void setPrintResults(bool value);
         
+        uint64_t const& getWeightVectorBatchSize() const;
+        void setWeightVectorBatchSize(uint64_t const& value);
+        
     private:
         storm::modelchecker::multiobjective::MultiObjectiveMethod method;
         boost::optional<std::string> plotPathUnderApprox, plotPathOverApprox, plotPathParetoPoints;
@@ -70,6 +73,7 @@ namespace storm {
         boost::optional<uint64_t> maxSteps;
         boost::optional<storm::storage::SchedulerClass> schedulerRestriction;
         bool printResults;
+        uint64_t weightVectorBatchSize;
     };
 }
 
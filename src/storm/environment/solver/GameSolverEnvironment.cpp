@@ -20,6 +20,7 @@ namespace storm {
         precision = storm::utility::convertNumber<storm::RationalNumber>(gameSettings.getPrecision());
         considerRelativeTerminationCriterion = gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Relative;
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
+        valuePrecision = gameSettings.getValuePrecision();
     }
 
     GameSolverEnvironment::~GameSolverEnvironment() {
@@ -63,6 +64,12 @@ namespace storm {
     void GameSolverEnvironment::setRelativeTerminationCriterion(bool value) {
         considerRelativeTerminationCriterion = value;
     }
-
-
+    
+    storm::solver::ValuePrecision const& GameSolverEnvironment::getValuePrecision() const {
+        return valuePrecision;
+    }
+    
+    void GameSolverEnvironment::setValuePrecision(storm::solver::ValuePrecision value) {
+        valuePrecision = value;
+    }
 }
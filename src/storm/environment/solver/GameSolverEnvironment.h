@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/ValuePrecision.h"
 
 namespace storm {
     
@@ -25,6 +26,8 @@ namespace storm {
         void setRelativeTerminationCriterion(bool value);
         storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
+        storm::solver::ValuePrecision const& getValuePrecision() const;
+        void setValuePrecision(storm::solver::ValuePrecision value);
         
     private:
         storm::solver::GameMethod gameMethod;
@@ -32,6 +35,7 @@ namespace storm {
         uint64_t maxIterationCount;
         storm::RationalNumber precision;
         bool considerRelativeTerminationCriterion;
+        storm::solver::ValuePrecision valuePrecision;
     };
 }
 
@@ -20,6 +20,7 @@ namespace storm {
         precision = storm::utility::convertNumber<storm::RationalNumber>(minMaxSettings.getPrecision());
         considerRelativeTerminationCriterion = minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Relative;
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || minMaxSettings.getConvergenceCriterion() == storm::settings::modules::MinMaxEquationSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
+        valuePrecision = minMaxSettings.getValuePrecision();
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
     }
@@ -81,4 +82,11 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    storm::solver::ValuePrecision const& MinMaxSolverEnvironment::getValuePrecision() const {
+        return valuePrecision;
+    }
+    
+    void MinMaxSolverEnvironment::setValuePrecision(storm::solver::ValuePrecision value) {
+        valuePrecision = value;
+    }
 }
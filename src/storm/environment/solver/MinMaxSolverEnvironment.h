@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/ValuePrecision.h"
 
 namespace storm {
     
@@ -25,6 +26,8 @@ namespace storm {
         void setRelativeTerminationCriterion(bool value);
         storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
+        storm::solver::ValuePrecision const& getValuePrecision() const;
+        void setValuePrecision(storm::solver::ValuePrecision value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
         
@@ -34,6 +37,7 @@ namespace storm {
         uint64_t maxIterationCount;
         storm::RationalNumber precision;
         bool considerRelativeTerminationCriterion;
+        storm::solver::ValuePrecision valuePrecision;
         storm::solver::MultiplicationStyle multiplicationStyle;
         bool symmetricUpdates;
     };
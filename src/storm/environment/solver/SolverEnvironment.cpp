@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -19,6 +20,10 @@ namespace storm {
         forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
         linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
         linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+        auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+        if (resourceSettings.isMemoryBudgetSet()) {
+            memoryBudget = static_cast<uint64_t>(resourceSettings.getMemoryBudgetInMegabytes()) * 1024 * 1024;
+        }
     }
     
     SolverEnvironment::~SolverEnvironment() {
@@ -121,6 +126,14 @@ namespace storm {
         SolverEnvironment::forceExact = value;
     }
     
+    boost::optional<uint64_t> const& SolverEnvironment::getMemoryBudget() const {
+        return memoryBudget;
+    }
+    
+    void SolverEnvironment::setMemoryBudget(boost::optional<uint64_t> const& value) {
+        memoryBudget = value;
+    }
+    
     storm::solver::EquationSolverType const& SolverEnvironment::getLinearEquationSolverType() const {
         return linearEquationSolverType;
     }
@@ -54,6 +54,12 @@ namespace storm {
         bool isForceExact() const;
         void setForceExact(bool value);
         
+        /*!
+         * The memory budget (in bytes) the solvers should stay within, if any.
+         */
+        boost::optional<uint64_t> const& getMemoryBudget() const;
+        void setMemoryBudget(boost::optional<uint64_t> const& value);
+        
         storm::solver::EquationSolverType const& getLinearEquationSolverType() const;
         void setLinearEquationSolverType(storm::solver::EquationSolverType const& value, bool isSetFromDefault = false);
         bool isLinearEquationSolverTypeSetFromDefaultValue() const;
@@ -77,6 +83,7 @@ namespace storm {
         bool linearEquationSolverTypeSetFromDefault;
         bool forceSoundness;
         bool forceExact;
+        boost::optional<uint64_t> memoryBudget;
     };
 }
 
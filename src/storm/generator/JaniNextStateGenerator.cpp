@@ -23,6 +23,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/combinatorics.h"
 #include "storm/exceptions/InvalidSettingsException.h"
@@ -42,6 +43,7 @@ namespace storm {
         template<typename ValueType, typename StateType>
         JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani::Model const& model, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(model.getExpressionManager(), options), model(model), rewardExpressions(), hasStateActionRewards(false), evaluateRewardExpressionsAtEdges(false), evaluateRewardExpressionsAtDestinations(false) {
             STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::InvalidSettingsException, "JANI next-state generator cannot generate choice labels.");
+            STORM_LOG_WARN_COND(!this->options.isSymmetryReductionSet() && !this->options.isPartialOrderReductionSet(), "Symmetry and partial-order reduction are only supported for PRISM programs and are therefore not applied.");
 
             auto features = this->model.getModelFeatures();
             features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -549,6 +551,7 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         StateBehavior<ValueType, StateType> JaniNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+            STORM_PROFILE_SCOPE("generator.expand");
             // The evaluator should have the default values of the transient variables right now.
             
             // Prepare the result, in case we return early.
@@ -1,5 +1,9 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+#include <limits>
+#include <set>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
@@ -14,6 +18,7 @@
 
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/UnexpectedException.h"
@@ -85,6 +90,29 @@ namespace storm {
                 moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
                 actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
             }
+
+            if (this->options.isSymmetryReductionSet()) {
+                symmetryReduction = std::make_unique<SymmetryReduction>(this->program, this->variableInformation, this->options.getSymmetricModules(), this->options.getCoalitions());
+
+                // The reduction is only sound if everything that is observed in the states is invariant under the permutations.
+                for (auto const& label : this->program.getLabels()) {
+                    if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().count(label.getName()) > 0) {
+                        symmetryReduction->checkInvariance(label.getStatePredicateExpression(), "Label '" + label.getName() + "'");
+                    }
+                }
+                for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                    symmetryReduction->checkInvariance(expressionLabel.second, "Expression label '" + expressionLabel.first + "'");
+                }
+                for (auto const& expressionBoolPair : this->terminalStates) {
+                    symmetryReduction->checkInvariance(expressionBoolPair.first, "The expression for terminal states");
+                }
+                for (auto const& rewardModel : rewardModels) {
+                    symmetryReduction->checkInvariance(rewardModel.get());
+                }
+            }
+            if (this->options.isPartialOrderReductionSet()) {
+                initializePartialOrderReduction();
+            }
         }
 
         template<typename ValueType, typename StateType>
@@ -154,8 +182,9 @@ namespace storm {
         }
 
         template<typename ValueType, typename StateType>
-        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& unreducedStateToIdCallback) {
             std::vector<StateType> initialStateIndices;
+            StateToIdCallback stateToIdCallback = getReducedStateToIdCallback(unreducedStateToIdCallback);
 
             // If all states are initial, we can simplify the enumeration substantially.
             if (program.hasInitialConstruct() && program.getInitialConstruct().getInitialStatesExpression().isTrue()) {
@@ -259,11 +288,19 @@ namespace storm {
                 STORM_LOG_DEBUG("Enumerated " << initialStateIndices.size() << " initial states using SMT solving.");
             }
 
+            if (symmetryReduction) {
+                // Several initial states may have the same representative.
+                std::sort(initialStateIndices.begin(), initialStateIndices.end());
+                initialStateIndices.erase(std::unique(initialStateIndices.begin(), initialStateIndices.end()), initialStateIndices.end());
+            }
+
             return initialStateIndices;
         }
 
         template<typename ValueType, typename StateType>
-        StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+        StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& unreducedStateToIdCallback) {
+            STORM_PROFILE_SCOPE("generator.expand");
+            StateToIdCallback stateToIdCallback = getReducedStateToIdCallback(unreducedStateToIdCallback);
             // Prepare the result, in case we return early.
             StateBehavior<ValueType, StateType> result;
 
@@ -294,7 +331,14 @@ namespace storm {
             result.setExpanded();
 
             std::vector<Choice<ValueType>> allChoices;
-            if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
+            boost::optional<std::pair<uint_fast64_t, uint_fast64_t>> ampleCommand;
+            if (!partialOrderReducibleModules.empty()) {
+                ampleCommand = getAmpleCommand();
+            }
+            if (ampleCommand) {
+                // The ample command is independent of all other commands and invisible, so it suffices to explore it.
+                addAsynchronousChoice(allChoices, ampleCommand->first, program.getModule(ampleCommand->first).getCommand(ampleCommand->second), *this->state, stateToIdCallback);
+            } else if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
                 // First explore only edges without a rate
                 allChoices = getAsynchronousChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
                 addSynchronousChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
@@ -568,71 +612,76 @@ namespace storm {
                         continue;
                     }
 
-                    result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-                    Choice<ValueType>& choice = result.back();
-
-                    // Remember the choice origin only if we were asked to.
-                    if (this->options.isBuildChoiceOriginsSet()) {
-                        CommandSet commandIndex { command.getGlobalIndex() };
-                        choice.addOriginData(boost::any(std::move(commandIndex)));
-                    }
+                    addAsynchronousChoice(result, i, command, state, stateToIdCallback);
+                }
+            }
 
-                    // Iterate over all updates of the current command.
-                    ValueType probabilitySum = storm::utility::zero<ValueType>();
-                    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                        storm::prism::Update const& update = command.getUpdate(k);
+            return result;
+        }
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                        if (probability != storm::utility::zero<ValueType>()) {
-                            // Obtain target state index and add it to the list of known states. If it has not yet been
-                            // seen, we also add it to the set of states that have yet to be explored.
-                            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::addAsynchronousChoice(std::vector<Choice<ValueType>>& choices, uint_fast64_t moduleIndex, storm::prism::Command const& command, CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            choices.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
+            Choice<ValueType>& choice = choices.back();
+
+            // Remember the choice origin only if we were asked to.
+            if (this->options.isBuildChoiceOriginsSet()) {
+                CommandSet commandIndex { command.getGlobalIndex() };
+                choice.addOriginData(boost::any(std::move(commandIndex)));
+            }
 
-                            // Update the choice by adding the probability/target state to it.
-                            choice.addProbability(stateIndex, probability);
-                            if (this->options.isExplorationChecksSet()) {
-                                probabilitySum += probability;
-                            }
-                        }
-                    }
+            // Iterate over all updates of the current command.
+            ValueType probabilitySum = storm::utility::zero<ValueType>();
+            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+                storm::prism::Update const& update = command.getUpdate(k);
 
-                    // Create the state-action reward for the newly created choice.
-                    for (auto const& rewardModel : rewardModels) {
-                        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                        if (rewardModel.get().hasStateActionRewards()) {
-                            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                                }
-                            }
-                        }
-                        choice.addReward(stateActionRewardValue);
-                    }
+                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                if (probability != storm::utility::zero<ValueType>()) {
+                    // Obtain target state index and add it to the list of known states. If it has not yet been
+                    // seen, we also add it to the set of states that have yet to be explored.
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
 
-                    if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
-                        choice.addLabel(program.getActionName(command.getActionIndex()));
+                    // Update the choice by adding the probability/target state to it.
+                    choice.addProbability(stateIndex, probability);
+                    if (this->options.isExplorationChecksSet()) {
+                        probabilitySum += probability;
                     }
+                }
+            }
 
-                    if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
-                        if(command.getActionName() != "") {
-                            storm::storage::PlayerIndex const& playerOfAction = actionIndexToPlayerIndexMap.at(command.getActionIndex());
-                            STORM_LOG_THROW(playerOfAction != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException, "Command " << command.getActionName() << " is not owned by any player.");
-                            choice.setPlayerIndex(playerOfAction);
-                        } else {
-                            storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(i);
-                            STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException, "Module " << module.getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
-                            choice.setPlayerIndex(playerOfModule);
+            // Create the state-action reward for the newly created choice.
+            for (auto const& rewardModel : rewardModels) {
+                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+                if (rewardModel.get().hasStateActionRewards()) {
+                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                        if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
                         }
                     }
+                }
+                choice.addReward(stateActionRewardValue);
+            }
 
-                    if (this->options.isExplorationChecksSet()) {
-                        // Check that the resulting distribution is in fact a distribution.
-                        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
-                    }
+            if (this->options.isBuildChoiceLabelsSet() && command.isLabeled()) {
+                choice.addLabel(program.getActionName(command.getActionIndex()));
+            }
+
+            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+                if(command.getActionName() != "") {
+                    storm::storage::PlayerIndex const& playerOfAction = actionIndexToPlayerIndexMap.at(command.getActionIndex());
+                    STORM_LOG_THROW(playerOfAction != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException, "Command " << command.getActionName() << " is not owned by any player.");
+                    choice.setPlayerIndex(playerOfAction);
+                } else {
+                    storm::storage::PlayerIndex const& playerOfModule = moduleIndexToPlayerIndexMap.at(moduleIndex);
+                    STORM_LOG_THROW(playerOfModule != storm::storage::INVALID_PLAYER_INDEX, storm::exceptions::WrongFormatException, "Module " << program.getModule(moduleIndex).getName() << " is not owned by any player but has at least one enabled, unlabeled command.");
+                    choice.setPlayerIndex(playerOfModule);
                 }
             }
 
-            return result;
+            if (this->options.isExplorationChecksSet()) {
+                // Check that the resulting distribution is in fact a distribution.
+                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+            }
         }
 
         template<typename ValueType, typename StateType>
@@ -856,6 +905,213 @@ namespace storm {
         }
 
 
+        template<typename ValueType, typename StateType>
+        typename PrismNextStateGenerator<ValueType, StateType>::StateToIdCallback PrismNextStateGenerator<ValueType, StateType>::getReducedStateToIdCallback(StateToIdCallback const& stateToIdCallback) const {
+            if (!symmetryReduction) {
+                return stateToIdCallback;
+            }
+            SymmetryReduction const& reduction = *symmetryReduction;
+            return [&reduction, &stateToIdCallback] (CompressedState const& state) {
+                CompressedState representative(state);
+                reduction.canonicalize(representative);
+                return stateToIdCallback(representative);
+            };
+        }
+
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::initializePartialOrderReduction() {
+            if (program.getModelType() != storm::prism::Program::ModelType::MDP && program.getModelType() != storm::prism::Program::ModelType::SMG) {
+                STORM_LOG_WARN("Partial-order reduction is only supported for MDPs and SMGs and is therefore not applied.");
+                return;
+            }
+            if (!this->options.isPartialOrderReductionAdmissible()) {
+                STORM_LOG_WARN("Partial-order reduction is not applied, because it does not preserve all of the given properties.");
+                return;
+            }
+            if (!rewardModels.empty()) {
+                STORM_LOG_WARN("Partial-order reduction is not applied, because it does not preserve reward models.");
+                return;
+            }
+            if (this->actionMask != nullptr) {
+                STORM_LOG_WARN("Partial-order reduction is not applied in combination with action masks.");
+                return;
+            }
+
+            // Collect the variables accessed by the individual modules and those observed by labels and terminal states.
+            std::vector<std::set<storm::expressions::Variable>> accessedVariables(program.getNumberOfModules());
+            for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+                for (auto const& command : program.getModule(i).getCommands()) {
+                    auto guardVariables = command.getGuardExpression().getVariables();
+                    accessedVariables[i].insert(guardVariables.begin(), guardVariables.end());
+                    for (auto const& update : command.getUpdates()) {
+                        auto likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                        accessedVariables[i].insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                        for (auto const& assignment : update.getAssignments()) {
+                            auto assignmentVariables = assignment.getExpression().getVariables();
+                            accessedVariables[i].insert(assignmentVariables.begin(), assignmentVariables.end());
+                            accessedVariables[i].insert(assignment.getVariable());
+                        }
+                    }
+                }
+            }
+            std::set<storm::expressions::Variable> observedVariables;
+            for (auto const& label : program.getLabels()) {
+                auto labelVariables = label.getStatePredicateExpression().getVariables();
+                observedVariables.insert(labelVariables.begin(), labelVariables.end());
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                auto labelVariables = expressionLabel.second.getVariables();
+                observedVariables.insert(labelVariables.begin(), labelVariables.end());
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                auto terminalVariables = expressionBool.first.getVariables();
+                observedVariables.insert(terminalVariables.begin(), terminalVariables.end());
+            }
+
+            partialOrderReducibleModules = storm::storage::BitVector(program.getNumberOfModules());
+            for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+                storm::prism::Module const& module = program.getModule(i);
+                if (symmetryReduction && symmetryReduction->getSymmetricModules().get(i)) {
+                    continue;
+                }
+                if (std::any_of(module.getCommands().begin(), module.getCommands().end(), [] (storm::prism::Command const& command) { return command.isLabeled(); })) {
+                    continue;
+                }
+                std::set<storm::expressions::Variable> localVariables = module.getAllExpressionVariables();
+                if (!std::includes(localVariables.begin(), localVariables.end(), accessedVariables[i].begin(), accessedVariables[i].end())) {
+                    continue;
+                }
+                bool visible = false;
+                for (auto const& variable : localVariables) {
+                    visible |= observedVariables.count(variable) > 0;
+                    for (uint_fast64_t j = 0; j < program.getNumberOfModules(); ++j) {
+                        visible |= j != i && accessedVariables[j].count(variable) > 0;
+                    }
+                }
+                if (!visible && isAmpleStepGraphAcyclic(module)) {
+                    partialOrderReducibleModules.set(i);
+                    STORM_LOG_INFO("Applying partial-order reduction to the commands of module '" << module.getName() << "'.");
+                }
+            }
+            STORM_LOG_WARN_COND(!partialOrderReducibleModules.empty(), "Partial-order reduction is enabled, but no module is independent of the remaining program.");
+        }
+
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isAmpleStepGraphAcyclic(storm::prism::Module const& module) {
+            // The valuations of the local variables are encoded in a mixed-radix system.
+            std::vector<storm::expressions::Variable> variables;
+            std::vector<int_fast64_t> lowerBounds;
+            std::vector<uint_fast64_t> radices;
+            for (auto const& variable : module.getBooleanVariables()) {
+                variables.push_back(variable.getExpressionVariable());
+                lowerBounds.push_back(0);
+                radices.push_back(2);
+            }
+            for (auto const& variable : module.getIntegerVariables()) {
+                variables.push_back(variable.getExpressionVariable());
+                lowerBounds.push_back(variable.getLowerBoundExpression().evaluateAsInt());
+                radices.push_back(variable.getUpperBoundExpression().evaluateAsInt() - lowerBounds.back() + 1);
+            }
+            uint_fast64_t const maximalNumberOfValuations = 1ull << 16;
+            uint_fast64_t numberOfValuations = 1;
+            for (auto const& radix : radices) {
+                numberOfValuations *= radix;
+                if (numberOfValuations > maximalNumberOfValuations) {
+                    STORM_LOG_INFO("Module '" << module.getName() << "' has too many local valuations to be considered for partial-order reduction.");
+                    return false;
+                }
+            }
+
+            // Compute the (unique) ample step of each valuation.
+            uint_fast64_t const noSuccessor = std::numeric_limits<uint_fast64_t>::max();
+            std::vector<uint_fast64_t> successors(numberOfValuations, noSuccessor);
+            std::vector<int_fast64_t> values(variables.size());
+            for (uint_fast64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                for (uint_fast64_t remainder = valuation, variable = 0; variable < variables.size(); remainder /= radices[variable], ++variable) {
+                    values[variable] = lowerBounds[variable] + static_cast<int_fast64_t>(remainder % radices[variable]);
+                    if (variables[variable].hasBooleanType()) {
+                        this->evaluator->setBooleanValue(variables[variable], values[variable] != 0);
+                    } else {
+                        this->evaluator->setIntegerValue(variables[variable], values[variable]);
+                    }
+                }
+
+                storm::prism::Command const* enabledCommand = nullptr;
+                bool uniqueEnabledCommand = true;
+                for (auto const& command : module.getCommands()) {
+                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                        uniqueEnabledCommand = enabledCommand == nullptr;
+                        enabledCommand = &command;
+                        if (!uniqueEnabledCommand) {
+                            break;
+                        }
+                    }
+                }
+                if (enabledCommand == nullptr || !uniqueEnabledCommand || enabledCommand->getNumberOfUpdates() != 1) {
+                    continue;
+                }
+
+                uint_fast64_t successor = 0;
+                std::vector<int_fast64_t> successorValues(values);
+                for (auto const& assignment : enabledCommand->getUpdate(0).getAssignments()) {
+                    uint_fast64_t variable = std::distance(variables.begin(), std::find(variables.begin(), variables.end(), assignment.getVariable()));
+                    successorValues[variable] = assignment.getVariable().hasBooleanType() ? static_cast<int_fast64_t>(this->evaluator->asBool(assignment.getExpression())) : this->evaluator->asInt(assignment.getExpression());
+                    if (successorValues[variable] < lowerBounds[variable] || successorValues[variable] >= lowerBounds[variable] + static_cast<int_fast64_t>(radices[variable])) {
+                        // Out-of-bounds values are reported during the exploration, so we do not reduce this module.
+                        return false;
+                    }
+                }
+                for (uint_fast64_t variable = variables.size(); variable > 0; --variable) {
+                    successor = successor * radices[variable - 1] + static_cast<uint_fast64_t>(successorValues[variable - 1] - lowerBounds[variable - 1]);
+                }
+                successors[valuation] = successor;
+            }
+
+            // Every valuation has at most one ample step, so we can detect cycles by following the steps.
+            enum class Status { Unvisited, OnPath, Done };
+            std::vector<Status> status(numberOfValuations, Status::Unvisited);
+            std::vector<uint_fast64_t> path;
+            for (uint_fast64_t valuation = 0; valuation < numberOfValuations; ++valuation) {
+                uint_fast64_t current = valuation;
+                while (current != noSuccessor && status[current] == Status::Unvisited) {
+                    status[current] = Status::OnPath;
+                    path.push_back(current);
+                    current = successors[current];
+                }
+                if (current != noSuccessor && status[current] == Status::OnPath) {
+                    STORM_LOG_INFO("Module '" << module.getName() << "' is not considered for partial-order reduction as its ample steps may form a cycle.");
+                    return false;
+                }
+                for (auto const& visited : path) {
+                    status[visited] = Status::Done;
+                }
+                path.clear();
+            }
+            return true;
+        }
+
+        template<typename ValueType, typename StateType>
+        boost::optional<std::pair<uint_fast64_t, uint_fast64_t>> PrismNextStateGenerator<ValueType, StateType>::getAmpleCommand() {
+            for (auto moduleIndex : partialOrderReducibleModules) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                boost::optional<uint_fast64_t> enabledCommandIndex;
+                bool uniqueEnabledCommand = true;
+                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
+                    if (this->evaluator->asBool(module.getCommand(j).getGuardExpression())) {
+                        uniqueEnabledCommand = !enabledCommandIndex;
+                        enabledCommandIndex = j;
+                        if (!uniqueEnabledCommand) {
+                            break;
+                        }
+                    }
+                }
+                if (enabledCommandIndex && uniqueEnabledCommand && module.getCommand(enabledCommandIndex.get()).getNumberOfUpdates() == 1) {
+                    return std::make_pair(moduleIndex, enabledCommandIndex.get());
+                }
+            }
+            return boost::none;
+        }
+
         template class PrismNextStateGenerator<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -2,6 +2,7 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/SymmetryReduction.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -92,6 +93,16 @@ namespace storm {
              * @return The asynchronous choices of the state.
              */
             std::vector<Choice<ValueType>> getAsynchronousChoices(CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter = CommandFilter::All);
+
+            /*!
+             * Adds the choice resulting from the given (enabled and asynchronous) command to the given choices.
+             *
+             * @param choices The vector to which the choice is added.
+             * @param moduleIndex The index of the module containing the command.
+             * @param command The command.
+             * @param state The state in which the command is executed.
+             */
+            void addAsynchronousChoice(std::vector<Choice<ValueType>>& choices, uint_fast64_t moduleIndex, storm::prism::Command const& command, CompressedState const& state, StateToIdCallback stateToIdCallback);
             
             /*!
              * Retrieves all (potentially) synchronous choices possible from the given state. 
@@ -120,6 +131,34 @@ namespace storm {
 
             bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+            /*!
+             * If symmetry reduction is enabled, wraps the given callback such that states are replaced by their canonical
+             * representatives before they are registered. Otherwise, the given callback is returned.
+             */
+            StateToIdCallback getReducedStateToIdCallback(StateToIdCallback const& stateToIdCallback) const;
+
+            /*!
+             * Determines the modules whose commands can form ample sets for partial-order reduction. These are the modules
+             * whose commands are unlabeled and only access the module's local variables, whose local variables are not
+             * accessed by any other module, label or terminal state expression and in which no cycle consists of commands
+             * that are the only enabled command of the module.
+             */
+            void initializePartialOrderReduction();
+
+            /*!
+             * Checks whether the steps of the given module that may be taken as ample sets, i.e., the steps of commands
+             * that are deterministic and the only enabled command of the module, cannot form a cycle. This is done by
+             * enumerating the valuations of the local variables of the module, so the result is false for modules with
+             * too many local valuations.
+             */
+            bool isAmpleStepGraphAcyclic(storm::prism::Module const& module);
+
+            /*!
+             * Retrieves the module and command index of a command that forms an ample set in the state currently loaded
+             * into the evaluator, i.e., the only enabled command of a reducible module if that command is deterministic.
+             */
+            boost::optional<std::pair<uint_fast64_t, uint_fast64_t>> getAmpleCommand();
+
             // The program used for the generation of next states.
             storm::prism::Program program;
 
@@ -132,6 +171,12 @@ namespace storm {
             // Mappings from module/action indices to the programs players
             std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
             std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+            // If set, the reduction used to identify states that only differ by a permutation of symmetric modules.
+            std::unique_ptr<SymmetryReduction> symmetryReduction;
+
+            // The modules whose commands can form ample sets (empty if partial-order reduction is disabled).
+            storm::storage::BitVector partialOrderReducibleModules;
         };
 
     }
@@ -0,0 +1,369 @@
+#include "storm/generator/SymmetryReduction.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/SimpleValuation.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            /*!
+             * Retrieves for each module the set of players owning at least one of its commands.
+             */
+            std::vector<std::set<storm::storage::PlayerIndex>> getOwnersOfModules(storm::prism::Program const& program) {
+                std::vector<std::set<storm::storage::PlayerIndex>> result(program.getNumberOfModules());
+                if (program.getModelType() != storm::prism::Program::ModelType::SMG) {
+                    return result;
+                }
+                std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
+                std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
+                for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                        result[moduleIndex].insert(command.isLabeled() ? actionIndexToPlayerIndexMap.at(command.getActionIndex()) : moduleIndexToPlayerIndexMap[moduleIndex]);
+                    }
+                }
+                return result;
+            }
+
+            /*!
+             * The maximal number of valuations for which expressions are evaluated when checking their invariance.
+             */
+            uint64_t const maximalNumberOfValuations = 1ull << 20;
+        }
+
+        SymmetryReduction::SymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<std::vector<std::string>> const& symmetricGroups, std::vector<storm::logic::PlayerCoalition> const& coalitions) : symmetricModules(program.getNumberOfModules()), program(program) {
+            std::map<std::string, uint64_t> moduleNameToIndexMap;
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                moduleNameToIndexMap[program.getModule(moduleIndex).getName()] = moduleIndex;
+            }
+            std::vector<std::set<storm::storage::PlayerIndex>> ownersOfModules = getOwnersOfModules(program);
+            std::map<storm::expressions::Variable, BooleanVariableInformation const*> booleanVariables;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                booleanVariables[booleanVariable.variable] = &booleanVariable;
+            }
+            std::map<storm::expressions::Variable, IntegerVariableInformation const*> integerVariables;
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                integerVariables[integerVariable.variable] = &integerVariable;
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableRanges[booleanVariable.variable] = std::make_pair(0, 1);
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableRanges[integerVariable.variable] = std::make_pair(integerVariable.lowerBound, integerVariable.upperBound);
+            }
+
+            for (auto const& group : symmetricGroups) {
+                STORM_LOG_THROW(group.size() > 1, storm::exceptions::InvalidArgumentException, "A group of symmetric modules needs to consist of at least two modules.");
+
+                // Resolve the names to module indices.
+                bool groupOfPlayers = moduleNameToIndexMap.count(group.front()) == 0;
+                std::vector<uint64_t> moduleIndices;
+                std::set<storm::storage::PlayerIndex> players;
+                for (auto const& name : group) {
+                    auto moduleIt = moduleNameToIndexMap.find(name);
+                    if (!groupOfPlayers) {
+                        STORM_LOG_THROW(moduleIt != moduleNameToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Unknown module '" << name << "' in group of symmetric modules.");
+                        moduleIndices.push_back(moduleIt->second);
+                    } else {
+                        STORM_LOG_THROW(moduleIt == moduleNameToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Group of symmetric modules mixes player and module names.");
+                        auto const& playerNameToIndexMap = program.getPlayerNameToIndexMapping();
+                        auto playerIt = playerNameToIndexMap.find(name);
+                        STORM_LOG_THROW(playerIt != playerNameToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Unknown module or player '" << name << "' in group of symmetric modules.");
+                        std::set<storm::storage::PlayerIndex> const onlyThisPlayer = {playerIt->second};
+                        auto ownedModuleIt = std::find(ownersOfModules.begin(), ownersOfModules.end(), onlyThisPlayer);
+                        STORM_LOG_THROW(ownedModuleIt != ownersOfModules.end() && std::find(ownedModuleIt + 1, ownersOfModules.end(), onlyThisPlayer) == ownersOfModules.end(), storm::exceptions::InvalidArgumentException, "Player '" << name << "' does not own exactly one module.");
+                        moduleIndices.push_back(std::distance(ownersOfModules.begin(), ownedModuleIt));
+                        players.insert(playerIt->second);
+                    }
+                }
+
+                // Permuting the modules of players changes the player owning a state, which is only sound if all these players are on the same side of each coalition.
+                for (auto const& coalition : coalitions) {
+                    uint64_t numberOfPlayersInCoalition = 0;
+                    for (auto const& player : coalition.getPlayers()) {
+                        storm::storage::PlayerIndex playerIndex;
+                        if (player.type() == typeid(std::string)) {
+                            auto playerIt = program.getPlayerNameToIndexMapping().find(boost::get<std::string>(player));
+                            STORM_LOG_THROW(playerIt != program.getPlayerNameToIndexMapping().end(), storm::exceptions::InvalidArgumentException, "Unknown player '" << boost::get<std::string>(player) << "' in coalition.");
+                            playerIndex = playerIt->second;
+                        } else {
+                            playerIndex = boost::get<storm::storage::PlayerIndex>(player);
+                        }
+                        numberOfPlayersInCoalition += players.count(playerIndex);
+                    }
+                    STORM_LOG_THROW(numberOfPlayersInCoalition == 0 || numberOfPlayersInCoalition == players.size(), storm::exceptions::InvalidArgumentException, "The players in the group of symmetric player '" << group.front() << "' are not all on the same side of the coalition " << coalition << ".");
+                }
+
+                for (auto moduleIndex : moduleIndices) {
+                    STORM_LOG_THROW(!symmetricModules.get(moduleIndex), storm::exceptions::InvalidArgumentException, "Module '" << program.getModule(moduleIndex).getName() << "' appears in more than one group of symmetric modules.");
+                    symmetricModules.set(moduleIndex);
+                    STORM_LOG_THROW(groupOfPlayers || ownersOfModules[moduleIndex] == ownersOfModules[moduleIndices.front()], storm::exceptions::InvalidArgumentException, "The symmetric modules '" << program.getModule(moduleIndices.front()).getName() << "' and '" << program.getModule(moduleIndex).getName() << "' are owned by different players.");
+                }
+
+                // Collect the slots of the variables (booleans first, then integers, each in the order of declaration).
+                std::vector<VariableSlot> slots;
+                std::vector<std::vector<storm::expressions::Variable>> variables;
+                storm::prism::Module const& firstModule = program.getModule(moduleIndices.front());
+                uint64_t numberOfVariables = firstModule.getNumberOfBooleanVariables() + firstModule.getNumberOfIntegerVariables();
+                for (auto moduleIndex : moduleIndices) {
+                    storm::prism::Module const& module = program.getModule(moduleIndex);
+                    STORM_LOG_THROW(module.getNumberOfBooleanVariables() == firstModule.getNumberOfBooleanVariables() && module.getNumberOfIntegerVariables() == firstModule.getNumberOfIntegerVariables(), storm::exceptions::InvalidArgumentException, "The symmetric modules '" << firstModule.getName() << "' and '" << module.getName() << "' declare different variables.");
+                    variables.emplace_back();
+                    for (auto const& variable : module.getBooleanVariables()) {
+                        slots.push_back({booleanVariables.at(variable.getExpressionVariable())->bitOffset, 1});
+                        variables.back().push_back(variable.getExpressionVariable());
+                    }
+                    for (uint64_t variableIndex = 0; variableIndex < module.getNumberOfIntegerVariables(); ++variableIndex) {
+                        auto const& integerVariable = *integerVariables.at(module.getIntegerVariables()[variableIndex].getExpressionVariable());
+                        auto const& correspondingVariable = *integerVariables.at(firstModule.getIntegerVariables()[variableIndex].getExpressionVariable());
+                        STORM_LOG_THROW(integerVariable.lowerBound == correspondingVariable.lowerBound && integerVariable.upperBound == correspondingVariable.upperBound, storm::exceptions::InvalidArgumentException, "The symmetric modules '" << firstModule.getName() << "' and '" << module.getName() << "' declare variables with different ranges.");
+                        slots.push_back({integerVariable.bitOffset, integerVariable.bitWidth});
+                        variables.back().push_back(integerVariable.variable);
+                    }
+                }
+                groupSlots.push_back(std::move(slots));
+                variablesPerModule.push_back(numberOfVariables);
+                groupVariables.push_back(std::move(variables));
+                groupModules.push_back(std::move(moduleIndices));
+            }
+
+            // As the transpositions of neighbouring modules generate all permutations of a group, it suffices to check that they preserve the commands.
+            for (uint64_t group = 0; group < groupModules.size(); ++group) {
+                for (uint64_t module = 0; module + 1 < groupModules[group].size(); ++module) {
+                    checkCommandSymmetry(group, module);
+                }
+            }
+        }
+
+        void SymmetryReduction::canonicalize(CompressedState& state) const {
+            std::vector<uint64_t> values;
+            std::vector<uint64_t> order;
+            for (uint64_t group = 0; group < groupSlots.size(); ++group) {
+                auto const& slots = groupSlots[group];
+                uint64_t const numberOfVariables = variablesPerModule[group];
+                uint64_t const numberOfModules = numberOfVariables == 0 ? 0 : slots.size() / numberOfVariables;
+
+                values.resize(slots.size());
+                for (uint64_t slot = 0; slot < slots.size(); ++slot) {
+                    values[slot] = state.getAsInt(slots[slot].bitOffset, slots[slot].bitWidth);
+                }
+
+                order.resize(numberOfModules);
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [&values, numberOfVariables] (uint64_t const& first, uint64_t const& second) {
+                    return std::lexicographical_compare(values.begin() + first * numberOfVariables, values.begin() + (first + 1) * numberOfVariables, values.begin() + second * numberOfVariables, values.begin() + (second + 1) * numberOfVariables);
+                });
+
+                for (uint64_t module = 0; module < numberOfModules; ++module) {
+                    for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                        VariableSlot const& slot = slots[module * numberOfVariables + variable];
+                        state.setFromInt(slot.bitOffset, slot.bitWidth, values[order[module] * numberOfVariables + variable]);
+                    }
+                }
+            }
+        }
+
+        storm::storage::BitVector const& SymmetryReduction::getSymmetricModules() const {
+            return symmetricModules;
+        }
+
+        void SymmetryReduction::checkInvariance(storm::expressions::Expression const& expression, std::string const& description) const {
+            std::set<storm::expressions::Variable> variables = expression.getVariables();
+            for (uint64_t group = 0; group < groupVariables.size(); ++group) {
+                // The transpositions of neighbouring modules generate all permutations of the group.
+                for (uint64_t module = 0; module + 1 < groupVariables[group].size(); ++module) {
+                    std::map<storm::expressions::Variable, storm::expressions::Expression> transposition;
+                    bool isAffected = false;
+                    for (uint64_t variable = 0; variable < groupVariables[group][module].size(); ++variable) {
+                        storm::expressions::Variable const& first = groupVariables[group][module][variable];
+                        storm::expressions::Variable const& second = groupVariables[group][module + 1][variable];
+                        transposition.emplace(first, second.getExpression());
+                        transposition.emplace(second, first.getExpression());
+                        isAffected |= variables.count(first) > 0 || variables.count(second) > 0;
+                    }
+                    if (isAffected) {
+                        STORM_LOG_THROW(areEquivalent(expression, expression.substitute(transposition)), storm::exceptions::InvalidArgumentException, description << " is not invariant under swapping the symmetric modules '" << program.getModule(groupModules[group][module]).getName() << "' and '" << program.getModule(groupModules[group][module + 1]).getName() << "'.");
+                    }
+                }
+            }
+        }
+
+        void SymmetryReduction::checkInvariance(storm::prism::RewardModel const& rewardModel) const {
+            std::string const description = "Reward model '" + rewardModel.getName() + "'";
+            auto checkAction = [&](uint64_t actionIndex) {
+                for (auto const& modules : groupModules) {
+                    uint64_t numberOfModulesWithAction = std::count_if(modules.begin(), modules.end(), [&](uint64_t moduleIndex) { return program.getModule(moduleIndex).hasActionIndex(actionIndex); });
+                    STORM_LOG_THROW(numberOfModulesWithAction == 0 || numberOfModulesWithAction == modules.size(), storm::exceptions::InvalidArgumentException, description << " refers to action '" << program.getActionName(actionIndex) << "', which only appears in some of the symmetric modules including '" << program.getModule(modules.front()).getName() << "'.");
+                }
+            };
+            for (auto const& reward : rewardModel.getStateRewards()) {
+                checkInvariance(reward.getStatePredicateExpression(), description);
+                checkInvariance(reward.getRewardValueExpression(), description);
+            }
+            for (auto const& reward : rewardModel.getStateActionRewards()) {
+                checkInvariance(reward.getStatePredicateExpression(), description);
+                checkInvariance(reward.getRewardValueExpression(), description);
+                if (reward.isLabeled()) {
+                    checkAction(reward.getActionIndex());
+                }
+            }
+            for (auto const& reward : rewardModel.getTransitionRewards()) {
+                checkInvariance(reward.getSourceStatePredicateExpression(), description);
+                checkInvariance(reward.getTargetStatePredicateExpression(), description);
+                checkInvariance(reward.getRewardValueExpression(), description);
+                if (reward.isLabeled()) {
+                    checkAction(reward.getActionIndex());
+                }
+            }
+        }
+
+        void SymmetryReduction::checkCommandSymmetry(uint64_t group, uint64_t module) const {
+            std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+            std::map<storm::expressions::Variable, storm::expressions::Variable> transposition;
+            for (uint64_t variable = 0; variable < groupVariables[group][module].size(); ++variable) {
+                storm::expressions::Variable const& first = groupVariables[group][module][variable];
+                storm::expressions::Variable const& second = groupVariables[group][module + 1][variable];
+                substitution.emplace(first, second.getExpression());
+                substitution.emplace(second, first.getExpression());
+                transposition.emplace(first, second);
+                transposition.emplace(second, first);
+            }
+            uint64_t const firstModuleIndex = groupModules[group][module];
+            uint64_t const secondModuleIndex = groupModules[group][module + 1];
+
+            // Swapping the two modules needs to map the commands of either of them to the ones of the other and the commands of every other module to the ones of the same module.
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                uint64_t const targetModuleIndex = moduleIndex == firstModuleIndex ? secondModuleIndex : (moduleIndex == secondModuleIndex ? firstModuleIndex : moduleIndex);
+                std::vector<storm::prism::Command> const& commands = program.getModule(moduleIndex).getCommands();
+                std::vector<storm::prism::Command> const& targetCommands = program.getModule(targetModuleIndex).getCommands();
+                STORM_LOG_THROW(commands.size() == targetCommands.size(), storm::exceptions::InvalidArgumentException, "The symmetric modules '" << program.getModule(firstModuleIndex).getName() << "' and '" << program.getModule(secondModuleIndex).getName() << "' have different numbers of commands.");
+                std::vector<bool> matched(targetCommands.size(), false);
+                for (uint64_t commandIndex = 0; commandIndex < commands.size(); ++commandIndex) {
+                    // The command at the same position is tried first, as it is the match for commands that are obtained via renaming or not affected at all.
+                    bool found = false;
+                    for (uint64_t offset = 0; !found && offset < targetCommands.size(); ++offset) {
+                        uint64_t const candidate = (commandIndex + offset) % targetCommands.size();
+                        if (!matched[candidate] && areSymmetric(commands[commandIndex], targetCommands[candidate], substitution, transposition)) {
+                            matched[candidate] = true;
+                            found = true;
+                        }
+                    }
+                    STORM_LOG_THROW(found, storm::exceptions::InvalidArgumentException, "The command '" << commands[commandIndex] << "' of module '" << program.getModule(moduleIndex).getName() << "' has no counterpart in module '" << program.getModule(targetModuleIndex).getName() << "' when swapping the symmetric modules '" << program.getModule(firstModuleIndex).getName() << "' and '" << program.getModule(secondModuleIndex).getName() << "'.");
+                }
+            }
+        }
+
+        bool SymmetryReduction::areSymmetric(storm::prism::Command const& first, storm::prism::Command const& second, std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution, std::map<storm::expressions::Variable, storm::expressions::Variable> const& transposition) const {
+            if (first.isLabeled() != second.isLabeled() || first.isMarkovian() != second.isMarkovian() || first.getNumberOfUpdates() != second.getNumberOfUpdates()) {
+                return false;
+            }
+            // Actions that (possibly) synchronize need to be the same, whereas actions local to a single module may be renamed.
+            if (first.isLabeled() && first.getActionIndex() != second.getActionIndex() && (program.getModuleIndicesByActionIndex(first.getActionIndex()).size() > 1 || program.getModuleIndicesByActionIndex(second.getActionIndex()).size() > 1)) {
+                return false;
+            }
+            if (!areEquivalent(first.getGuardExpression().substitute(substitution), second.getGuardExpression())) {
+                return false;
+            }
+
+            // Retrieves the non-identity assignments of the given update, possibly after applying the transposition.
+            auto getAssignments = [&](storm::prism::Update const& update, bool transpose) {
+                std::map<storm::expressions::Variable, storm::expressions::Expression> result;
+                for (auto const& assignment : update.getAssignments()) {
+                    if (assignment.isIdentity()) {
+                        continue;
+                    }
+                    if (transpose) {
+                        auto variableIt = transposition.find(assignment.getVariable());
+                        result.emplace(variableIt == transposition.end() ? assignment.getVariable() : variableIt->second, assignment.getExpression().substitute(substitution));
+                    } else {
+                        result.emplace(assignment.getVariable(), assignment.getExpression());
+                    }
+                }
+                return result;
+            };
+
+            std::vector<bool> matched(second.getNumberOfUpdates(), false);
+            for (auto const& update : first.getUpdates()) {
+                storm::expressions::Expression likelihood = update.getLikelihoodExpression().substitute(substitution);
+                std::map<storm::expressions::Variable, storm::expressions::Expression> assignments = getAssignments(update, true);
+                bool found = false;
+                for (uint64_t updateIndex = 0; !found && updateIndex < second.getNumberOfUpdates(); ++updateIndex) {
+                    if (matched[updateIndex] || !areEquivalent(likelihood, second.getUpdate(updateIndex).getLikelihoodExpression())) {
+                        continue;
+                    }
+                    std::map<storm::expressions::Variable, storm::expressions::Expression> candidateAssignments = getAssignments(second.getUpdate(updateIndex), false);
+                    found = assignments.size() == candidateAssignments.size() && std::equal(assignments.begin(), assignments.end(), candidateAssignments.begin(), [this] (auto const& firstAssignment, auto const& secondAssignment) {
+                        return firstAssignment.first == secondAssignment.first && areEquivalent(firstAssignment.second, secondAssignment.second);
+                    });
+                    matched[updateIndex] = found;
+                }
+                if (!found) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool SymmetryReduction::areEquivalent(storm::expressions::Expression const& first, storm::expressions::Expression const& second) const {
+            if (first.isSyntacticallyEqual(second)) {
+                return true;
+            }
+            std::set<storm::expressions::Variable> variableSet = first.getVariables();
+            std::set<storm::expressions::Variable> secondVariables = second.getVariables();
+            variableSet.insert(secondVariables.begin(), secondVariables.end());
+            std::vector<storm::expressions::Variable> variables(variableSet.begin(), variableSet.end());
+
+            uint64_t numberOfValuations = 1;
+            for (auto const& variable : variables) {
+                auto rangeIt = variableRanges.find(variable);
+                STORM_LOG_THROW(rangeIt != variableRanges.end(), storm::exceptions::NotSupportedException, "Can not check the invariance under symmetry reduction for expressions over variable '" << variable.getName() << "'.");
+                numberOfValuations *= static_cast<uint64_t>(rangeIt->second.second - rangeIt->second.first + 1);
+                STORM_LOG_THROW(numberOfValuations <= maximalNumberOfValuations, storm::exceptions::NotSupportedException, "Can not check the invariance under symmetry reduction for expression " << first << ", as it refers to too many variables.");
+            }
+
+            // Enumerate all valuations of the variables.
+            storm::expressions::SimpleValuation valuation(program.getManager().getSharedPointer());
+            std::vector<int64_t> values;
+            auto setValue = [&](uint64_t index) {
+                if (variables[index].hasBooleanType()) {
+                    valuation.setBooleanValue(variables[index], values[index] != 0);
+                } else {
+                    valuation.setIntegerValue(variables[index], values[index]);
+                }
+            };
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                values.push_back(variableRanges.at(variables[index]).first);
+                setValue(index);
+            }
+            while (true) {
+                bool equal = first.hasBooleanType() ? first.evaluateAsBool(&valuation) == second.evaluateAsBool(&valuation) : first.evaluateAsDouble(&valuation) == second.evaluateAsDouble(&valuation);
+                if (!equal) {
+                    return false;
+                }
+                uint64_t index = 0;
+                while (index < variables.size() && values[index] == variableRanges.at(variables[index]).second) {
+                    values[index] = variableRanges.at(variables[index]).first;
+                    setValue(index);
+                    ++index;
+                }
+                if (index == variables.size()) {
+                    return true;
+                }
+                ++values[index];
+                setValue(index);
+            }
+        }
+
+    }
+}
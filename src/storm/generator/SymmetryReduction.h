@@ -0,0 +1,135 @@
+#ifndef STORM_GENERATOR_SYMMETRYREDUCTION_H_
+#define STORM_GENERATOR_SYMMETRYREDUCTION_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/logic/PlayerCoalition.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace prism {
+        class Command;
+        class Program;
+        class RewardModel;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+
+        /*!
+         * Maps the states of a PRISM program with groups of symmetric modules to canonical representatives. Two states
+         * are mapped to the same representative iff they only differ by a permutation of the valuations of the modules
+         * within the symmetric groups.
+         *
+         * Note that the reduction is only sound if the remainder of the program (in particular the labels and reward
+         * models) as well as the considered properties are invariant under these permutations. The expressions that
+         * are evaluated on the reduced state space can be checked for this via checkInvariance.
+         */
+        class SymmetryReduction {
+        public:
+            /*!
+             * Creates the reduction for the given groups of symmetric modules.
+             *
+             * The entries of a group either all name modules or (for SMGs) all name players. A player stands for the
+             * unique module whose commands are all owned by this player. The modules of a group need to declare boolean
+             * and integer variables with the same ranges in the same order (as is the case for modules obtained from the
+             * same module via renaming) and swapping the valuations of two modules of a group needs to map the commands of
+             * the program to equivalent commands, where only actions local to a single module may be renamed. Moreover, in a group of modules, all modules need to be owned by the same
+             * players such that the reduction preserves the player owning a state. As the reduction of a group of players
+             * changes the player owning a state, all players of such a group need to be either contained in or excluded
+             * from each of the given coalitions.
+             *
+             * @param program The (preprocessed) program.
+             * @param variableInformation The information about how the variables are packed within the states.
+             * @param symmetricGroups The groups of names of symmetric modules or players.
+             * @param coalitions The coalitions of the properties that are to be checked on the reduced model.
+             */
+            SymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation, std::vector<std::vector<std::string>> const& symmetricGroups, std::vector<storm::logic::PlayerCoalition> const& coalitions = {});
+
+            /*!
+             * Replaces the given state by its canonical representative, i.e., sorts the valuations of the modules
+             * within every group lexicographically.
+             *
+             * @param state The state to canonicalize.
+             */
+            void canonicalize(CompressedState& state) const;
+
+            /*!
+             * Retrieves the indices of the modules that are part of some symmetric group.
+             */
+            storm::storage::BitVector const& getSymmetricModules() const;
+
+            /*!
+             * Checks that the value of the given expression does not change if the valuations of two modules of a group
+             * are swapped (which implies invariance under all permutations of the group). As this is done by evaluating
+             * the expression for all valuations of the variables it refers to, an exception is raised if there are too
+             * many of them.
+             *
+             * @param expression The expression (over the variables of the program) to check.
+             * @param description A description of the expression that is used in the error message.
+             */
+            void checkInvariance(storm::expressions::Expression const& expression, std::string const& description) const;
+
+            /*!
+             * Checks that the given reward model is invariant under the permutations of the groups, i.e., that its
+             * expressions are invariant and that the actions it refers to appear in all or none of the modules of a group.
+             */
+            void checkInvariance(storm::prism::RewardModel const& rewardModel) const;
+
+        private:
+            /*!
+             * Checks that swapping the given module of the group with its successor maps the commands of the program to
+             * equivalent commands and throws otherwise.
+             */
+            void checkCommandSymmetry(uint64_t group, uint64_t module) const;
+
+            /*!
+             * Checks whether the first command is equivalent to the second one after swapping the variables of two
+             * symmetric modules in it, where the substitution and the transposition both describe this swap.
+             */
+            bool areSymmetric(storm::prism::Command const& first, storm::prism::Command const& second, std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution, std::map<storm::expressions::Variable, storm::expressions::Variable> const& transposition) const;
+
+            /*!
+             * Checks whether the two expressions evaluate to the same value for all valuations of their variables.
+             */
+            bool areEquivalent(storm::expressions::Expression const& first, storm::expressions::Expression const& second) const;
+
+            struct VariableSlot {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+            };
+
+            // For each group, the slots of the variables of its modules. The slots of the modules of a group are stored
+            // consecutively, i.e., the i-th module of the group occupies the slots [i * k, (i+1) * k) where k is the
+            // number of variables per module.
+            std::vector<std::vector<VariableSlot>> groupSlots;
+
+            // For each group, the number of variables of each of its modules.
+            std::vector<uint64_t> variablesPerModule;
+
+            // The indices of the modules that are part of some group.
+            storm::storage::BitVector symmetricModules;
+
+            // For each group, the variables of each of its modules in the order of the slots.
+            std::vector<std::vector<std::vector<storm::expressions::Variable>>> groupVariables;
+
+            // For each group, the indices of its modules.
+            std::vector<std::vector<uint64_t>> groupModules;
+
+            // The ranges of the (bounded) variables of the program, where booleans range over 0 and 1.
+            std::map<storm::expressions::Variable, std::pair<int64_t, int64_t>> variableRanges;
+
+            // The program whose states are reduced.
+            storm::prism::Program const& program;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_SYMMETRYREDUCTION_H_ */
@@ -7,6 +7,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
@@ -14,6 +15,7 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
@@ -34,7 +36,40 @@
 namespace storm {
     namespace modelchecker {
         namespace helper {
-            
+
+            namespace {
+                /*!
+                 * Multiplies the given rows of the matrix with several vectors at once. The vectors are stored interleaved, i.e., the
+                 * value of the j-th vector at state s is stored at position s * numberOfVectors + j.
+                 */
+                template<typename ValueType>
+                void multiplyInterleavedRows(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* addVector, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType>& result, uint64_t firstRow, uint64_t endRow) {
+                    for (uint64_t row = firstRow; row < endRow; ++row) {
+                        auto resultIt = result.begin() + row * numberOfVectors;
+                        std::fill(resultIt, resultIt + numberOfVectors, addVector ? (*addVector)[row] : storm::utility::zero<ValueType>());
+                        for (auto const& entry : matrix.getRow(row)) {
+                            auto xIt = x.begin() + entry.getColumn() * numberOfVectors;
+                            for (uint64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+                                resultIt[vectorIndex] += entry.getValue() * xIt[vectorIndex];
+                            }
+                        }
+                    }
+                }
+
+                template<typename ValueType>
+                void multiplyInterleaved(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const* addVector, uint64_t numberOfVectors, std::vector<ValueType> const& x, std::vector<ValueType>& result, bool parallelize) {
+#ifdef STORM_HAVE_INTELTBB
+                    if (parallelize) {
+                        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, matrix.getRowCount()), [&](tbb::blocked_range<uint64_t> const& range) {
+                            multiplyInterleavedRows(matrix, addVector, numberOfVectors, x, result, range.begin(), range.end());
+                        });
+                        return;
+                    }
+#endif
+                    multiplyInterleavedRows(matrix, addVector, numberOfVectors, x, result, 0, matrix.getRowCount());
+                }
+            }
+
             template <typename ValueType>
             bool SparseCtmcCslHelper::checkAndUpdateTransientProbabilityEpsilon(storm::Environment const& env, ValueType& epsilon, std::vector<ValueType> const& resultVector, storm::storage::BitVector const& relevantPositions) {
                 // Check if the check is necessary for the provided settings
@@ -136,9 +171,9 @@ namespace storm {
                                     }
                                     
                                     // Finally compute the transient probabilities.
-                                    std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>());
-                                    std::vector<ValueType> subresult = computeTransientProbabilities(env, uniformizedMatrix, &b, upperBound, uniformizationRate, values, epsilon);
-                                    storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresult);
+                                    std::vector<std::vector<ValueType>> values(1, std::vector<ValueType>(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>()));
+                                    std::vector<std::vector<ValueType>> subresult = computeTransientProbabilitiesForTimeBounds(env, uniformizedMatrix, &b, {storm::utility::convertNumber<ValueType>(upperBound)}, uniformizationRate, values, epsilon);
+                                    storm::utility::vector::setVectorValues(result, statesWithProbabilityGreater0NonPsi, subresult.front());
                                 }
                             } else if (upperBound == storm::utility::infinity<ValueType>()) {
                                 // In this case, the interval is of the form [t, inf] with t != 0.
@@ -258,6 +293,64 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::InvalidOperationException, "Computing bounded until probabilities is unsupported for this value type.");
             }
 
+            template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds) {
+                STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException, "Exact computations not possible for bounded until probabilities.");
+                for (auto const& upperBound : upperBounds) {
+                    STORM_LOG_THROW(upperBound >= 0.0 && upperBound != storm::utility::infinity<double>(), storm::exceptions::InvalidPropertyException, "Time bounds must be finite and non-negative.");
+                }
+
+                uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+
+                // Set the possible (absolute) error allowed for truncation (epsilon for fox-glynn)
+                ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+
+                storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+                storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+                STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+                std::vector<ValueType> initialResult(numberOfStates, storm::utility::zero<ValueType>());
+                storm::utility::vector::setVectorValues<ValueType>(initialResult, psiStates, storm::utility::one<ValueType>());
+                std::vector<std::vector<ValueType>> result(upperBounds.size(), initialResult);
+                if (statesWithProbabilityGreater0NonPsi.empty()) {
+                    return result;
+                }
+
+                // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+                ValueType uniformizationRate = 0;
+                for (auto state : statesWithProbabilityGreater0NonPsi) {
+                    uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+                }
+                uniformizationRate *= 1.02;
+                STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+                storm::storage::SparseMatrix<ValueType> uniformizedMatrix = computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+
+                // Compute the vector that is to be added as a compensation for removing the absorbing states.
+                std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+                for (auto& element : b) {
+                    element /= uniformizationRate;
+                }
+
+                std::vector<ValueType> timeBounds;
+                timeBounds.reserve(upperBounds.size());
+                for (auto const& upperBound : upperBounds) {
+                    timeBounds.push_back(storm::utility::convertNumber<ValueType>(upperBound));
+                }
+                std::vector<std::vector<ValueType>> values(1, std::vector<ValueType>(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(), storm::utility::zero<ValueType>()));
+
+                bool refine;
+                do { // Iterate until the desired precision is reached (only relevant for relative precision criterion)
+                    std::vector<std::vector<ValueType>> subresults = computeTransientProbabilitiesForTimeBounds(env, uniformizedMatrix, &b, timeBounds, uniformizationRate, values, epsilon);
+                    refine = false;
+                    for (uint64_t boundIndex = 0; boundIndex < upperBounds.size(); ++boundIndex) {
+                        storm::utility::vector::setVectorValues(result[boundIndex], statesWithProbabilityGreater0NonPsi, subresults[boundIndex]);
+                        refine |= checkAndUpdateTransientProbabilityEpsilon(env, epsilon, result[boundIndex], statesWithProbabilityGreater0);
+                    }
+                } while (refine);
+                return result;
+            }
+
             template <typename ValueType>
             std::vector<ValueType> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative) {
                 return SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(env, std::move(goal), computeProbabilityMatrix(rateMatrix, exitRateVector), backwardTransitions, phiStates, psiStates, qualitative);
@@ -659,6 +752,105 @@ namespace storm {
                 return result;
             }
             
+            template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<std::vector<ValueType>> const& values, ValueType epsilon) {
+                STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+                uint64_t numberOfVectors = values.size();
+                uint64_t numberOfStates = uniformizedMatrix.getRowCount();
+                std::vector<std::vector<ValueType>> result(timeBounds.size() * numberOfVectors);
+                if (result.empty()) {
+                    return result;
+                }
+
+                // Use Fox-Glynn to get the truncation points and the weights for each time bound.
+                // If no time can pass, the initial values are the result, which corresponds to the single weight one at step zero.
+                std::vector<storm::utility::numerical::FoxGlynnResult<ValueType>> foxGlynnResults(timeBounds.size());
+                uint64_t lastStep = 0;
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    ValueType lambda = timeBounds[boundIndex] * uniformizationRate;
+                    auto& foxGlynnResult = foxGlynnResults[boundIndex];
+                    if (storm::utility::isZero(lambda)) {
+                        foxGlynnResult.left = 0;
+                        foxGlynnResult.right = 0;
+                        foxGlynnResult.totalWeight = storm::utility::one<ValueType>();
+                        foxGlynnResult.weights = {storm::utility::one<ValueType>()};
+                    } else {
+                        foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+                        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[boundIndex] << ": left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
+                    }
+                    lastStep = std::max(lastStep, foxGlynnResult.right);
+                }
+
+                // Store the vectors interleaved.
+                std::vector<ValueType> currentValues(numberOfStates * numberOfVectors);
+                for (uint64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+                    STORM_LOG_ASSERT(values[vectorIndex].size() == numberOfStates, "Unexpected size of initial vector.");
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        currentValues[state * numberOfVectors + vectorIndex] = values[vectorIndex][state];
+                    }
+                }
+                std::vector<ValueType> nextValues(currentValues.size());
+                std::vector<std::vector<ValueType>> interleavedResults(timeBounds.size(), std::vector<ValueType>(currentValues.size(), storm::utility::zero<ValueType>()));
+
+                bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+                parallelize = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+                // The early truncation relies on floating point differences of the iterates, so it is only done if no sound results are requested.
+                bool const allowEarlyTruncation = !env.solver().isForceSoundness();
+
+                STORM_LOG_DEBUG("Starting " << lastStep << " iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix and " << numberOfVectors << " vectors.");
+                for (uint64_t step = 0; step <= lastStep; ++step) {
+                    ValueType maximalChange = storm::utility::zero<ValueType>();
+                    if (step > 0) {
+                        multiplyInterleaved(uniformizedMatrix, addVector, numberOfVectors, currentValues, nextValues, parallelize);
+                        if (allowEarlyTruncation) {
+                            for (uint64_t index = 0; index < currentValues.size(); ++index) {
+                                maximalChange = std::max(maximalChange, storm::utility::abs<ValueType>(nextValues[index] - currentValues[index]));
+                            }
+                        }
+                        std::swap(currentValues, nextValues);
+                    }
+
+                    for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                        auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                        if (step >= foxGlynnResult.left && step <= foxGlynnResult.right) {
+                            storm::utility::vector::addScaledVector(interleavedResults[boundIndex], currentValues, foxGlynnResult.weights[step - foxGlynnResult.left]);
+                        }
+                    }
+
+                    // Since the uniformized matrix is substochastic, the change between two consecutive iterates never increases. Hence, if the
+                    // values can change by at most epsilon/2 in all remaining steps, we use the current values for all remaining weights.
+                    if (allowEarlyTruncation && step > 0 && step < lastStep && maximalChange * storm::utility::convertNumber<ValueType>(lastStep - step) <= epsilon / storm::utility::convertNumber<ValueType>(2.0)) {
+                        STORM_LOG_INFO("Detected steady state after " << step << " of " << lastStep << " uniformization steps.");
+                        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                            auto const& foxGlynnResult = foxGlynnResults[boundIndex];
+                            ValueType remainingWeight = storm::utility::zero<ValueType>();
+                            for (uint64_t remainingStep = std::max(step + 1, foxGlynnResult.left); remainingStep <= foxGlynnResult.right; ++remainingStep) {
+                                remainingWeight += foxGlynnResult.weights[remainingStep - foxGlynnResult.left];
+                            }
+                            if (!storm::utility::isZero(remainingWeight)) {
+                                storm::utility::vector::addScaledVector(interleavedResults[boundIndex], currentValues, remainingWeight);
+                            }
+                        }
+                        break;
+                    }
+                }
+
+                // Finally, divide the results by the total weights and undo the interleaving.
+                for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                    ValueType scalingFactor = storm::utility::one<ValueType>() / foxGlynnResults[boundIndex].totalWeight;
+                    for (uint64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+                        auto& resultVector = result[boundIndex * numberOfVectors + vectorIndex];
+                        resultVector.reserve(numberOfStates);
+                        for (uint64_t state = 0; state < numberOfStates; ++state) {
+                            resultVector.push_back(interleavedResults[boundIndex][state * numberOfVectors + vectorIndex] * scalingFactor);
+                        }
+                    }
+                }
+                return result;
+            }
+
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -712,6 +904,10 @@ namespace storm {
             
             template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon);
 
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, std::vector<double> const& upperBounds);
+
+            template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds, double uniformizationRate, std::vector<std::vector<double>> const& values, double epsilon);
+
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
             template std::vector<storm::RationalFunction> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalFunction>&& goal, storm::storage::SparseMatrix<storm::RationalFunction> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalFunction> const& exitRates, bool qualitative, double lowerBound, double upperBound);
@@ -28,6 +28,16 @@ namespace storm {
                 template <typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound, double upperBound);
                 
+                /*!
+                 * Computes the probabilities of satisfying phi U<=t psi for each of the given time bounds t. In contrast to computing them one
+                 * after another, the transient probabilities for all time bounds are obtained in a single uniformization sweep.
+                 *
+                 * @param upperBounds The (finite) time bounds.
+                 * @return For each time bound, the probabilities of all states.
+                 */
+                template <typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates, std::vector<double> const& upperBounds);
+
                 template <typename ValueType>
                 static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative);
 
@@ -91,6 +101,24 @@ namespace storm {
                  */
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
                 static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
+                /*!
+                 * Computes the transient probabilities for several time bounds and several initial vectors in a single sweep over the
+                 * uniformized matrix. The vectors are stored interleaved, i.e., the values of all vectors for one state are adjacent, such that
+                 * each matrix entry is only loaded once per step. If Intel TBB is enabled, the rows are processed in parallel. Unless sound
+                 * results are requested (see SolverEnvironment::isForceSoundness), the iteration is truncated early as soon as the iterates become stationary.
+                 *
+                 * @param uniformizedMatrix The uniformized transition matrix.
+                 * @param addVector A vector that is added in each step (see above). If this is not supposed to be used, it can be set to nullptr.
+                 * @param timeBounds The time bounds to use.
+                 * @param uniformizationRate The used uniformization rate.
+                 * @param values The initial vectors, each mapping each state to an initial probability.
+                 * @param epsilon The precision used for computing the truncation points.
+                 * @return The vectors of transient probabilities, where the vector at position i * values.size() + j belongs to the i-th time
+                 * bound and the j-th initial vector.
+                 */
+                template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<std::vector<ValueType>> computeTransientProbabilitiesForTimeBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds, ValueType uniformizationRate, std::vector<std::vector<ValueType>> const& values, ValueType epsilon);
                 
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
@@ -221,6 +221,42 @@ namespace storm {
                 optimizationDirection = direction;
             }
             
+            template<typename StateType, typename ValueType>
+            void ExplorationInformation<StateType, ValueType>::setPlayersOfCoalition(std::set<storm::storage::PlayerIndex> const& players) {
+                playersOfCoalition = players;
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::isGame() const {
+                return static_cast<bool>(playersOfCoalition);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::isPlayerOfCoalition(storm::storage::PlayerIndex const& player) const {
+                STORM_LOG_ASSERT(isGame(), "Players are only defined for games.");
+                return playersOfCoalition.get().find(player) != playersOfCoalition.get().end();
+            }
+            
+            template<typename StateType, typename ValueType>
+            void ExplorationInformation<StateType, ValueType>::addOpponentRowGroup(StateType const& group) {
+                opponentRowGroups.insert(group);
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::isOpponentRowGroup(StateType const& group) const {
+                return opponentRowGroups.find(group) != opponentRowGroups.end();
+            }
+            
+            template<typename StateType, typename ValueType>
+            storm::OptimizationDirection ExplorationInformation<StateType, ValueType>::getOptimizationDirectionOfRowGroup(StateType const& group) const {
+                return isOpponentRowGroup(group) ? storm::solver::invert(optimizationDirection) : optimizationDirection;
+            }
+            
+            template<typename StateType, typename ValueType>
+            bool ExplorationInformation<StateType, ValueType>::maximizeInRowGroup(StateType const& group) const {
+                return getOptimizationDirectionOfRowGroup(group) == storm::OptimizationDirection::Maximize;
+            }
+            
             template class ExplorationInformation<uint32_t, double>;
         }
     }
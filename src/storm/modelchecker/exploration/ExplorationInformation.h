@@ -4,6 +4,7 @@
 #include <vector>
 #include <limits>
 #include <unordered_map>
+#include <set>
 
 #include <boost/optional.hpp>
 
@@ -13,6 +14,7 @@
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BoostTypes.h"
+#include "storm/storage/PlayerIndex.h"
 
 #include "storm/settings/modules/ExplorationSettings.h"
 
@@ -104,6 +106,31 @@ namespace storm {
                 
                 void setOptimizationDirection(storm::OptimizationDirection const& direction);
                 
+                /*!
+                 * Declares the explored model to be a game in which the given players form the coalition, i.e., optimize
+                 * in the direction of the property. All other players optimize in the opposite direction.
+                 */
+                void setPlayersOfCoalition(std::set<storm::storage::PlayerIndex> const& players);
+                
+                bool isGame() const;
+                
+                bool isPlayerOfCoalition(storm::storage::PlayerIndex const& player) const;
+                
+                /*!
+                 * Marks the given row group as being controlled by a player that is not part of the coalition.
+                 */
+                void addOpponentRowGroup(StateType const& group);
+                
+                bool isOpponentRowGroup(StateType const& group) const;
+                
+                /*!
+                 * Retrieves the direction in which the choices of the given row group are resolved. For games, this is
+                 * the opposite of the property's direction if the row group belongs to an opponent of the coalition.
+                 */
+                storm::OptimizationDirection getOptimizationDirectionOfRowGroup(StateType const& group) const;
+                
+                bool maximizeInRowGroup(StateType const& group) const;
+                
             private:
                 MatrixType matrix;
                 std::vector<StateType> rowGroupIndices;
@@ -115,6 +142,12 @@ namespace storm {
                 storm::OptimizationDirection optimizationDirection;
                 StateSet terminalStates;
                 
+                // If the explored model is a game, these are the players that optimize in the direction of the property.
+                boost::optional<std::set<storm::storage::PlayerIndex>> playersOfCoalition;
+                
+                // The row groups whose choices are resolved by opponents of the coalition.
+                StateSet opponentRowGroups;
+                
                 bool localPrecomputation;
                 std::size_t numberOfExplorationStepsUntilPrecomputation;
                 boost::optional<std::size_t> numberOfSampledPathsUntilPrecomputation;
@@ -1,5 +1,9 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
 #include "storm/modelchecker/exploration/Bounds.h"
@@ -19,6 +23,9 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
+
+#include "storm/shields/PreShield.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -36,6 +43,23 @@
 namespace storm {
     namespace modelchecker {
         
+        namespace {
+            /*!
+             * Checks that all bounded until formulas below the given (operator) formula have a single upper step bound, as
+             * other bounds can not be handled by the exploration.
+             */
+            bool hasOnlyUpperStepBounds(storm::logic::Formula const& formula) {
+                if (formula.isOperatorFormula()) {
+                    return hasOnlyUpperStepBounds(formula.asOperatorFormula().getSubformula());
+                }
+                if (formula.isBoundedUntilFormula()) {
+                    storm::logic::BoundedUntilFormula const& boundedUntilFormula = formula.asBoundedUntilFormula();
+                    return !boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isStepBound() && !boundedUntilFormula.hasLowerBound() && boundedUntilFormula.hasUpperBound();
+                }
+                return true;
+            }
+        }
+        
         template<typename ModelType, typename StateType>
         SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
             // Intentionally left empty.
@@ -44,8 +68,23 @@ namespace storm {
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
             storm::logic::Formula const& formula = checkTask.getFormula();
-            storm::logic::FragmentSpecification fragment = storm::logic::reachability();
-            return formula.isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+            storm::logic::FragmentSpecification fragment = storm::logic::reachability().setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true);
+            if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+                // For games, the coalition needs to be given by a game formula around the reachability property.
+                return formula.isGameFormula() && formula.asGameFormula().getSubformula().isInFragment(fragment) && hasOnlyUpperStepBounds(formula.asGameFormula().getSubformula()) && checkTask.isOnlyInitialStatesRelevantSet();
+            }
+            return formula.isInFragment(fragment) && hasOnlyUpperStepBounds(formula) && checkTask.isOnlyInitialStatesRelevantSet();
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>::checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, ValueType> const& checkTask) {
+            storm::logic::GameFormula const& gameFormula = checkTask.getFormula();
+            STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::SMG, storm::exceptions::InvalidPropertyException, "Game formulas can only be checked on games.");
+            STORM_LOG_THROW(gameFormula.getSubformula().isProbabilityOperatorFormula(), storm::exceptions::NotSupportedException, "The exploration engine only supports probability operators within game formulas.");
+            
+            auto subTask = checkTask.substituteFormula(gameFormula.getSubformula().asProbabilityOperatorFormula());
+            subTask.setPlayerCoalition(gameFormula.getCoalition());
+            return this->checkProbabilityOperatorFormula(env, subTask);
         }
         
         template<typename ModelType, typename StateType>
@@ -54,9 +93,15 @@ namespace storm {
             storm::logic::Formula const& conditionFormula = untilFormula.getLeftSubformula();
             storm::logic::Formula const& targetFormula = untilFormula.getRightSubformula();
             STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
+            STORM_LOG_THROW(program.getModelType() != storm::prism::Program::ModelType::SMG || checkTask.isPlayerCoalitionSet(), storm::exceptions::InvalidPropertyException, "For games, the coalition must be given in the property.");
             
             ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection() : storm::OptimizationDirection::Maximize);
             
+            if (checkTask.isPlayerCoalitionSet()) {
+                // Resolve the players of the coalition, so we can determine the direction of each explored state.
+                explorationInformation.setPlayersOfCoalition(getPlayersOfCoalition(checkTask.getPlayerCoalition()));
+            }
+            
             // The first row group starts at action 0.
             explorationInformation.newRowGroup(0);
             
@@ -64,20 +109,87 @@ namespace storm {
             StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, conditionFormula.toExpression(program.getManager(), labelToExpressionMapping), targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
             
             
+            // Create a structure that holds the bounds for the states and actions.
+            Bounds<StateType, ValueType> bounds;
+            
             // Compute and return result.
-            std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation);
-            return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
+            std::tuple<StateType, ValueType, ValueType> boundsForInitialState = performExploration(stateGeneration, explorationInformation, bounds);
+            std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(std::get<0>(boundsForInitialState), std::get<1>(boundsForInitialState));
+            if (checkTask.isShieldingTask()) {
+                result->asExplicitQuantitativeCheckResult<ValueType>().setShield(createShieldForExploredStates(checkTask.getShieldingExpression(), explorationInformation, bounds));
+            }
+            return result;
         }
         
         template<typename ModelType, typename StateType>
-        std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation) const {
-            // Generate the initial state so we know where to start the simulation.
+        std::unique_ptr<CheckResult> SparseExplorationModelChecker<ModelType, StateType>::computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+            storm::logic::BoundedUntilFormula const& boundedUntilFormula = checkTask.getFormula();
+            STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && boundedUntilFormula.getTimeBoundReference().isStepBound() && !boundedUntilFormula.hasLowerBound() && boundedUntilFormula.hasUpperBound(), storm::exceptions::NotSupportedException, "The exploration engine only supports step-bounded until formulas with an upper bound.");
+            STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
+            STORM_LOG_THROW(program.getModelType() != storm::prism::Program::ModelType::SMG || checkTask.isPlayerCoalitionSet(), storm::exceptions::InvalidPropertyException, "For games, the coalition must be given in the property.");
+            uint64_t stepBound = boundedUntilFormula.getNonStrictUpperBound<uint64_t>();
+            
+            ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection() : storm::OptimizationDirection::Maximize);
+            if (checkTask.isPlayerCoalitionSet()) {
+                explorationInformation.setPlayersOfCoalition(getPlayersOfCoalition(checkTask.getPlayerCoalition()));
+            }
+            explorationInformation.newRowGroup(0);
+            
+            std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+            StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, boundedUntilFormula.getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping), boundedUntilFormula.getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping));
+            
+            // The bounds are only used to store the values of terminal states.
+            Bounds<StateType, ValueType> bounds;
+            Statistics<StateType, ValueType> stats;
+            
             stateGeneration.computeInitialStates();
             STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
             StateType initialStateIndex = stateGeneration.getFirstInitialState();
             
-            // Create a structure that holds the bounds for the states and actions.
-            Bounds<StateType, ValueType> bounds;
+            // Instead of sampling paths, we compute the values of the states within the step bound of the initial state.
+            // If the shield is emitted via the callback, we need to keep the representations of the explored states.
+            std::vector<std::vector<ValueType>> stepBoundedValues(explorationInformation.getNumberOfDiscoveredStates());
+            std::unordered_map<StateType, storm::generator::CompressedState> compressedStates;
+            std::unordered_map<StateType, storm::generator::CompressedState>* compressedStatesPtr = checkTask.isShieldingTask() && shieldCallback ? &compressedStates : nullptr;
+            computeStepBoundedValues(stateGeneration, initialStateIndex, stepBound, explorationInformation, bounds, stats, stepBoundedValues, compressedStatesPtr);
+            std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(initialStateIndex, stepBoundedValues[initialStateIndex][stepBound]);
+            if (checkTask.isShieldingTask()) {
+                result->asExplicitQuantitativeCheckResult<ValueType>().setShield(createShieldForStepBoundedProperty(checkTask.getShieldingExpression(), stepBound, initialStateIndex, stateGeneration, explorationInformation, bounds, stats, stepBoundedValues, compressedStatesPtr));
+            }
+            
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                stats.printToStream(std::cout, explorationInformation);
+            }
+            return result;
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::setShieldCallback(ShieldCallback const& callback) {
+            shieldCallback = callback;
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::set<storm::storage::PlayerIndex> SparseExplorationModelChecker<ModelType, StateType>::getPlayersOfCoalition(storm::logic::PlayerCoalition const& coalition) const {
+            std::map<std::string, storm::storage::PlayerIndex> const& playerNameToIndexMap = program.getPlayerNameToIndexMapping();
+            std::set<storm::storage::PlayerIndex> playersOfCoalition;
+            for (auto const& player : coalition.getPlayers()) {
+                if (player.type() == typeid(std::string)) {
+                    auto playerIt = playerNameToIndexMap.find(boost::get<std::string>(player));
+                    STORM_LOG_THROW(playerIt != playerNameToIndexMap.end(), storm::exceptions::InvalidPropertyException, "Unknown player '" << boost::get<std::string>(player) << "' in coalition.");
+                    playersOfCoalition.insert(playerIt->second);
+                } else {
+                    playersOfCoalition.insert(boost::get<storm::storage::PlayerIndex>(player));
+                }
+            }
+            return playersOfCoalition;
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, typename ModelType::ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+            // Generate the initial state so we know where to start the simulation.
+            stateGeneration.computeInitialStates();
+            STORM_LOG_THROW(stateGeneration.getNumberOfInitialStates() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
+            StateType initialStateIndex = stateGeneration.getFirstInitialState();
             
             // Create a stack that is used to track the path we sampled.
             StateActionStack stack;
@@ -228,14 +340,25 @@ namespace storm {
                 // If the state was neither a trivial (non-accepting) terminal state nor a target state, we
                 // need to store its behavior.
                 if (!isTerminalState) {
+                    // In games, the choices of states that are controlled by an opponent of the coalition are resolved
+                    // in the direction opposite to the one of the property.
+                    StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
+                    if (explorationInformation.isGame()) {
+                        auto const& firstChoice = *behavior.begin();
+                        if (firstChoice.hasPlayerIndex() && !explorationInformation.isPlayerOfCoalition(firstChoice.getPlayerIndex())) {
+                            explorationInformation.addOpponentRowGroup(rowGroup);
+                        }
+                    }
+                    storm::OptimizationDirection direction = explorationInformation.getOptimizationDirectionOfRowGroup(rowGroup);
+                    
                     // Next, we insert the behavior into our matrix structure.
                     StateType startAction = explorationInformation.getActionCount();
                     explorationInformation.addActionsToMatrix(behavior.getNumberOfChoices());
                     
                     ActionType localAction = 0;
                     
-                    // Retrieve the lowest state bounds (wrt. to the current optimization direction).
-                    std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
+                    // Retrieve the lowest state bounds (wrt. to the optimization direction of the state).
+                    std::pair<ValueType, ValueType> stateBounds = getLowestBounds(direction);
                     
                     for (auto const& choice : behavior) {
                         for (auto const& entry : choice) {
@@ -245,7 +368,7 @@ namespace storm {
                         
                         std::pair<ValueType, ValueType> actionBounds = computeBoundsOfAction(startAction + localAction, explorationInformation, bounds);
                         bounds.initializeBoundsForNextAction(actionBounds);
-                        stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
+                        stateBounds = combineBounds(direction, stateBounds, actionBounds);
                         
                         STORM_LOG_TRACE("Initializing bounds of action " << (startAction + localAction) << " to " << bounds.getLowerBoundForAction(startAction + localAction) << " and " << bounds.getUpperBoundForAction(startAction + localAction) << ".");
                         
@@ -301,13 +424,13 @@ namespace storm {
             STORM_LOG_TRACE("Sampling from actions leaving the state.");
             
             for (uint32_t row = explorationInformation.getStartRowOfGroup(rowGroup); row < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++row) {
-                actionValues.push_back(std::make_pair(row, bounds.getBoundForAction(explorationInformation.getOptimizationDirection(), row)));
+                actionValues.push_back(std::make_pair(row, bounds.getBoundForAction(explorationInformation.getOptimizationDirectionOfRowGroup(rowGroup), row)));
             }
             
             STORM_LOG_ASSERT(!actionValues.empty(), "Values for actions must not be empty.");
             
             // Sort the actions wrt. to the optimization direction.
-            if (explorationInformation.maximize()) {
+            if (explorationInformation.maximizeInRowGroup(rowGroup)) {
                 std::sort(actionValues.begin(), actionValues.end(), [] (std::pair<ActionType, ValueType> const& a, std::pair<ActionType, ValueType> const& b) { return a.second > b.second; } );
             } else {
                 std::sort(actionValues.begin(), actionValues.end(), [] (std::pair<ActionType, ValueType> const& a, std::pair<ActionType, ValueType> const& b) { return a.second < b.second; } );
@@ -363,6 +486,7 @@ namespace storm {
             // Outline:
             // 1. construct a sparse transition matrix of the relevant part of the state space.
             // 2. use this matrix to compute states with probability 0/1 and an MEC decomposition (in the max case).
+            //    For games, the MEC decomposition is restricted to the states of the player maximizing the probability.
             // 3. use MEC decomposition to collapse MECs.
             STORM_LOG_TRACE("Starting " << (explorationInformation.useLocalPrecomputation() ? "local" : "global") << " precomputation.");
             
@@ -373,7 +497,7 @@ namespace storm {
             std::vector<StateType> relevantStates;
             if (explorationInformation.useLocalPrecomputation()) {
                 for (auto const& stateActionPair : stack) {
-                    if (explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
+                    if (explorationInformation.isGame() || explorationInformation.maximize() || !storm::utility::isOne(bounds.getLowerBoundForState(stateActionPair.first, explorationInformation))) {
                         relevantStates.push_back(stateActionPair.first);
                     }
                 }
@@ -434,7 +558,46 @@ namespace storm {
             storm::storage::BitVector allStates(sink + 1, true);
             storm::storage::BitVector statesWithProbability0;
             storm::storage::BitVector statesWithProbability1;
-            if (explorationInformation.maximize()) {
+            if (explorationInformation.isGame()) {
+                // In games, the states of the fragment are partitioned into the states of the player that maximizes the
+                // probability to reach the target and the ones of the player that minimizes it. The sink is treated
+                // like a state of the maximizing player, as it only has a single choice anyway.
+                storm::storage::BitVector maximizerStates(sink + 1);
+                for (StateType index = 0; index < relevantStates.size(); ++index) {
+                    maximizerStates.set(index, explorationInformation.maximizeInRowGroup(explorationInformation.getRowGroup(relevantStates[index])));
+                }
+                maximizerStates.set(sink);
+                
+                targetStates.set(sink, true);
+                statesWithProbability0 = computeGameProb0States(relevantStatesMatrix, transposedMatrix, maximizerStates, targetStates);
+                targetStates.set(sink, false);
+                statesWithProbability1 = computeGameProb1States(relevantStatesMatrix, maximizerStates, targetStates);
+                
+                // In end components that contain states of both players, the minimizing player can keep the play
+                // inside, so the upper bounds of these states would never decrease. We deflate them before collapsing
+                // any end components, as collapsing changes the row groups the fragment refers to.
+                deflateEndComponents(relevantStates, relevantStatesMatrix, transposedMatrix, maximizerStates, targetStates, explorationInformation, bounds);
+                
+                // End components can only be used to stay forever by the player that maximizes the probability if
+                // all states of the end component belong to this player. Hence, only those are collapsed. End
+                // components in which the minimizing player can stay forever are covered by the probability 0 states.
+                storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(relevantStatesMatrix, transposedMatrix, maximizerStates);
+                ++stats.ecDetections;
+                STORM_LOG_TRACE("Successfully computed MEC decomposition of the maximizer states. Found " << (mecDecomposition.size() > 1 ? (mecDecomposition.size() - 1) : 0) << " MEC(s).");
+                
+                STORM_LOG_ASSERT(mecDecomposition.size() > 0, "Expected at least one MEC (the trivial sink MEC).");
+                if (mecDecomposition.size() == 1) {
+                    ++stats.failedEcDetections;
+                } else {
+                    stats.totalNumberOfEcDetected += mecDecomposition.size() - 1;
+                    for (auto const& mec : mecDecomposition) {
+                        if (mec.containsState(sink)) {
+                            continue;
+                        }
+                        collapseMec(mec, relevantStates, relevantStatesMatrix, explorationInformation, bounds);
+                    }
+                }
+            } else if (explorationInformation.maximize()) {
                 // If we are computing maximal probabilities, we first perform a detection of states that have
                 // probability 01 and then additionally perform an MEC decomposition. The reason for this somewhat
                 // duplicate work is the following. Optimally, we would only do the MEC decomposition, because we need
@@ -502,6 +665,76 @@ namespace storm {
             return true;
         }
         
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::deflateEndComponents(std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, storm::storage::SparseMatrix<ValueType> const& transposedMatrix, storm::storage::BitVector const& maximizerStates, storm::storage::BitVector const& targetStates, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+            StateType sink = relevantStates.size();
+            std::vector<uint_fast64_t> const& rowGroupIndices = relevantStatesMatrix.getRowGroupIndices();
+            
+            // Restrict the minimizing player to the choices that are optimal with respect to the lower bounds. The end
+            // components of the restricted game are the ones in which the minimizing player (presumably) wants to stay.
+            storm::storage::BitVector choices(relevantStatesMatrix.getRowCount(), true);
+            for (StateType index = 0; index < relevantStates.size(); ++index) {
+                if (maximizerStates.get(index)) {
+                    continue;
+                }
+                ActionType startAction = explorationInformation.getStartRowOfGroup(explorationInformation.getRowGroup(relevantStates[index]));
+                std::vector<ValueType> lowerBounds;
+                for (auto row = rowGroupIndices[index]; row < rowGroupIndices[index + 1]; ++row) {
+                    lowerBounds.push_back(computeLowerBoundOfAction(startAction + (row - rowGroupIndices[index]), explorationInformation, bounds));
+                }
+                ValueType minimalLowerBound = *std::min_element(lowerBounds.begin(), lowerBounds.end());
+                for (auto row = rowGroupIndices[index]; row < rowGroupIndices[index + 1]; ++row) {
+                    choices.set(row, comparator.isEqual(lowerBounds[row - rowGroupIndices[index]], minimalLowerBound));
+                }
+            }
+            
+            storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(relevantStatesMatrix, transposedMatrix, storm::storage::BitVector(sink + 1, true), choices);
+            for (auto const& mec : mecDecomposition) {
+                if (mec.containsState(sink)) {
+                    continue;
+                }
+                
+                // The value of the end component is at most the best value of the choices of the maximizing player
+                // that leave it, because the minimizing player can stay in it otherwise. End components that contain
+                // a target state need no deflation.
+                bool containsTargetState = false;
+                ValueType bestExitValue = storm::utility::zero<ValueType>();
+                for (auto const& stateAndChoices : mec) {
+                    if (targetStates.get(stateAndChoices.first)) {
+                        containsTargetState = true;
+                        break;
+                    }
+                    if (!maximizerStates.get(stateAndChoices.first)) {
+                        continue;
+                    }
+                    ActionType startAction = explorationInformation.getStartRowOfGroup(explorationInformation.getRowGroup(relevantStates[stateAndChoices.first]));
+                    for (auto row = rowGroupIndices[stateAndChoices.first]; row < rowGroupIndices[stateAndChoices.first + 1]; ++row) {
+                        if (!mec.containsChoice(stateAndChoices.first, row)) {
+                            bestExitValue = std::max(bestExitValue, computeUpperBoundOfAction(startAction + (row - rowGroupIndices[stateAndChoices.first]), explorationInformation, bounds));
+                        }
+                    }
+                }
+                if (containsTargetState) {
+                    continue;
+                }
+                
+                bool deflated = false;
+                for (auto const& stateAndChoices : mec) {
+                    deflated |= bounds.setUpperBoundOfStateIfLessThanOld(relevantStates[stateAndChoices.first], explorationInformation, bestExitValue);
+                }
+                if (deflated) {
+                    STORM_LOG_TRACE("Deflated the upper bounds of an end component with " << mec.size() << " states to " << bestExitValue << ".");
+                    // The actions are sampled according to their bounds, so they need to reflect the new state bounds.
+                    for (auto const& stateAndChoices : mec) {
+                        StateType rowGroup = explorationInformation.getRowGroup(relevantStates[stateAndChoices.first]);
+                        for (auto action = explorationInformation.getStartRowOfGroup(rowGroup); action < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++action) {
+                            bounds.setBoundsForAction(action, computeBoundsOfAction(action, explorationInformation, bounds));
+                        }
+                    }
+                }
+            }
+        }
+        
         template<typename ModelType, typename StateType>
         void SparseExplorationModelChecker<ModelType, StateType>::collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
             bool containsTargetState = false;
@@ -550,19 +783,25 @@ namespace storm {
                 // Remap all contained states to the new row group.
                 StateType nextRowGroup = explorationInformation.getNextRowGroup();
                 for (auto const& stateAndChoices : mec) {
-                    explorationInformation.assignStateToRowGroup(stateAndChoices.first, nextRowGroup);
+                    explorationInformation.assignStateToRowGroup(relevantStates[stateAndChoices.first], nextRowGroup);
+                }
+                
+                // Collapsed MECs consist of states of the player maximizing the probability only, so the new state
+                // maximizes as well. In games where the property is minimized, this is an opponent of the coalition.
+                if (explorationInformation.isGame() && explorationInformation.minimize()) {
+                    explorationInformation.addOpponentRowGroup(nextRowGroup);
                 }
                 
                 bounds.initializeBoundsForNextState();
                 
                 // Add to the new row group all leaving actions of contained states and set the appropriate bounds for
                 // the actions and the new state.
-                std::pair<ValueType, ValueType> stateBounds = getLowestBounds(explorationInformation.getOptimizationDirection());
+                std::pair<ValueType, ValueType> stateBounds = getLowestBounds(storm::OptimizationDirection::Maximize);
                 for (auto const& action : leavingActions) {
                     explorationInformation.moveActionToBackOfMatrix(action);
                     std::pair<ValueType, ValueType> const& actionBounds = bounds.getBoundsForAction(action);
                     bounds.initializeBoundsForNextAction(actionBounds);
-                    stateBounds = combineBounds(explorationInformation.getOptimizationDirection(), stateBounds, actionBounds);
+                    stateBounds = combineBounds(storm::OptimizationDirection::Maximize, stateBounds, actionBounds);
                 }
                 bounds.setBoundsForRowGroup(nextRowGroup, stateBounds);
                 
@@ -571,6 +810,321 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename StateType>
+        storm::storage::BitVector SparseExplorationModelChecker<ModelType, StateType>::computeGameProb0States(storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maximizerStates, storm::storage::BitVector const& targetStates) const {
+            // Compute the states from which the maximizing player can enforce reaching a target state with positive
+            // probability: a state of the maximizer needs one such choice, a state of the minimizer needs all choices to be such.
+            auto const& rowGroupIndices = relevantStatesMatrix.getRowGroupIndices();
+            storm::storage::BitVector statesWithPositiveProbability(targetStates);
+            std::vector<uint_fast64_t> stack(targetStates.begin(), targetStates.end());
+            while (!stack.empty()) {
+                uint_fast64_t currentState = stack.back();
+                stack.pop_back();
+                
+                for (auto const& predecessorEntry : backwardTransitions.getRow(currentState)) {
+                    uint_fast64_t predecessor = predecessorEntry.getColumn();
+                    if (statesWithPositiveProbability.get(predecessor)) {
+                        continue;
+                    }
+                    
+                    bool maximizer = maximizerStates.get(predecessor);
+                    bool addPredecessor = !maximizer;
+                    for (auto row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1]; ++row) {
+                        bool rowReachesSet = false;
+                        for (auto const& entry : relevantStatesMatrix.getRow(row)) {
+                            if (statesWithPositiveProbability.get(entry.getColumn())) {
+                                rowReachesSet = true;
+                                break;
+                            }
+                        }
+                        if (maximizer == rowReachesSet) {
+                            addPredecessor = maximizer;
+                            break;
+                        }
+                    }
+                    
+                    if (addPredecessor) {
+                        statesWithPositiveProbability.set(predecessor);
+                        stack.push_back(predecessor);
+                    }
+                }
+            }
+            return ~statesWithPositiveProbability;
+        }
+        
+        template<typename ModelType, typename StateType>
+        storm::storage::BitVector SparseExplorationModelChecker<ModelType, StateType>::computeGameProb1States(storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, storm::storage::BitVector const& maximizerStates, storm::storage::BitVector const& targetStates) const {
+            // We compute the greatest set of states in which the maximizing player can keep the play while making
+            // progress towards the target states with positive probability (nested fixpoint).
+            auto const& rowGroupIndices = relevantStatesMatrix.getRowGroupIndices();
+            storm::storage::BitVector candidates(relevantStatesMatrix.getRowGroupCount(), true);
+            bool done = false;
+            while (!done) {
+                storm::storage::BitVector winningStates(targetStates);
+                bool changed = true;
+                while (changed) {
+                    changed = false;
+                    for (auto state : candidates) {
+                        if (winningStates.get(state)) {
+                            continue;
+                        }
+                        
+                        // A choice is good if it stays within the candidates and reaches a winning state with positive probability.
+                        bool maximizer = maximizerStates.get(state);
+                        bool addState = !maximizer;
+                        for (auto row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                            bool staysInCandidates = true;
+                            bool reachesWinningState = false;
+                            for (auto const& entry : relevantStatesMatrix.getRow(row)) {
+                                if (!candidates.get(entry.getColumn())) {
+                                    staysInCandidates = false;
+                                    break;
+                                }
+                                reachesWinningState |= winningStates.get(entry.getColumn());
+                            }
+                            if (maximizer == (staysInCandidates && reachesWinningState)) {
+                                addState = maximizer;
+                                break;
+                            }
+                        }
+                        
+                        if (addState) {
+                            winningStates.set(state);
+                            changed = true;
+                        }
+                    }
+                }
+                
+                done = winningStates == candidates;
+                candidates = std::move(winningStates);
+            }
+            return candidates;
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::unique_ptr<tempest::shields::AbstractShield<typename ModelType::ValueType, typename storm::storage::SparseMatrix<typename ModelType::ValueType>::index_type>> SparseExplorationModelChecker<ModelType, StateType>::createShieldForExploredStates(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+            STORM_LOG_THROW(shieldingExpression->isPreSafetyShield(), storm::exceptions::NotSupportedException, "The exploration engine only supports the creation of pre-safety shields.");
+            
+            // Determine the states that were merged into a common row group while collapsing end components.
+            std::size_t numberOfStates = explorationInformation.getNumberOfDiscoveredStates();
+            std::unordered_map<StateType, uint_fast64_t> statesPerRowGroup;
+            for (StateType state = 0; state < numberOfStates; ++state) {
+                if (!explorationInformation.isUnexplored(state)) {
+                    ++statesPerRowGroup[explorationInformation.getRowGroup(state)];
+                }
+            }
+            
+            // The choices are rated by their pessimistic bound, i.e., the lower bound if the probability is maximized
+            // and the upper bound otherwise, because only these bounds are guaranteed for the actual values.
+            storm::OptimizationDirection direction = explorationInformation.getOptimizationDirection();
+            std::vector<IndexType> rowGroupIndices = {0};
+            std::vector<ValueType> choiceValues;
+            storm::storage::BitVector relevantStates(numberOfStates);
+            storm::storage::BitVector opponentStates(numberOfStates);
+            for (StateType state = 0; state < numberOfStates; ++state) {
+                if (!explorationInformation.isUnexplored(state)) {
+                    StateType rowGroup = explorationInformation.getRowGroup(state);
+                    bool hasOwnActions = statesPerRowGroup[rowGroup] == 1 && !explorationInformation.getRowOfMatrix(explorationInformation.getStartRowOfGroup(rowGroup)).empty();
+                    if (hasOwnActions) {
+                        for (ActionType action = explorationInformation.getStartRowOfGroup(rowGroup); action < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++action) {
+                            choiceValues.push_back(bounds.getBoundForAction(storm::solver::invert(direction), action));
+                        }
+                        relevantStates.set(state);
+                        opponentStates.set(state, explorationInformation.isOpponentRowGroup(rowGroup));
+                    }
+                }
+                rowGroupIndices.push_back(choiceValues.size());
+            }
+            STORM_LOG_INFO("Created shield for " << relevantStates.getNumberOfSetBits() << " of " << numberOfStates << " discovered states.");
+            
+            boost::optional<storm::storage::BitVector> coalitionStates;
+            if (explorationInformation.isGame()) {
+                // The shield only restricts the choices of the coalition.
+                coalitionStates = opponentStates;
+            }
+            return std::make_unique<tempest::shields::PreShield<ValueType, IndexType>>(rowGroupIndices, choiceValues, shieldingExpression, direction, relevantStates, coalitionStates);
+        }
+        
+        template<typename ModelType, typename StateType>
+        void SparseExplorationModelChecker<ModelType, StateType>::computeStepBoundedValues(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& state, uint64_t stepBound, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::vector<std::vector<ValueType>>& stepBoundedValues, std::unordered_map<StateType, storm::generator::CompressedState>* compressedStates) const {
+            // We use an explicit stack instead of a recursion, because the depth is only limited by the step bound.
+            std::vector<std::pair<StateType, uint64_t>> stack = {std::make_pair(state, stepBound)};
+            while (!stack.empty()) {
+                StateType currentStateId = stack.back().first;
+                uint64_t currentStepBound = stack.back().second;
+                
+                auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                    if (compressedStates != nullptr) {
+                        compressedStates->emplace(currentStateId, unexploredIt->second);
+                    }
+                    exploreState(stateGeneration, currentStateId, unexploredIt->second, explorationInformation, bounds, stats);
+                    explorationInformation.removeUnexploredState(unexploredIt);
+                    stats.explorationStep();
+                    stepBoundedValues.resize(explorationInformation.getNumberOfDiscoveredStates());
+                }
+                
+                std::vector<ValueType>& values = stepBoundedValues[currentStateId];
+                if (values.size() <= currentStepBound) {
+                    if (explorationInformation.isTerminal(currentStateId)) {
+                        // The values of terminal states do not depend on the step bound.
+                        values.resize(currentStepBound + 1, bounds.getLowerBoundForState(currentStateId, explorationInformation));
+                    } else if (values.empty()) {
+                        // Non-terminal states are no target states.
+                        values.push_back(storm::utility::zero<ValueType>());
+                    } else if (storm::utility::isOne(values.back())) {
+                        // Once a state reaches the target states almost surely, it does so for all larger step bounds.
+                        values.resize(currentStepBound + 1, storm::utility::one<ValueType>());
+                    }
+                }
+                if (values.size() > currentStepBound) {
+                    stack.pop_back();
+                    continue;
+                }
+                
+                // Make sure that the successors are known for all smaller step bounds.
+                StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
+                bool successorsMissing = false;
+                for (ActionType action = explorationInformation.getStartRowOfGroup(rowGroup); action < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++action) {
+                    for (auto const& element : explorationInformation.getRowOfMatrix(action)) {
+                        if (stepBoundedValues[element.getColumn()].size() < currentStepBound) {
+                            stack.emplace_back(element.getColumn(), currentStepBound - 1);
+                            successorsMissing = true;
+                        }
+                    }
+                }
+                if (successorsMissing) {
+                    continue;
+                }
+                
+                storm::OptimizationDirection direction = explorationInformation.getOptimizationDirectionOfRowGroup(rowGroup);
+                for (uint64_t currentBound = stepBoundedValues[currentStateId].size(); currentBound <= currentStepBound; ++currentBound) {
+                    ValueType value = getLowestBound(direction);
+                    for (ActionType action = explorationInformation.getStartRowOfGroup(rowGroup); action < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++action) {
+                        ValueType actionValue = computeStepBoundedValueOfAction(action, currentBound - 1, explorationInformation, stepBoundedValues);
+                        value = direction == storm::OptimizationDirection::Maximize ? std::max(value, actionValue) : std::min(value, actionValue);
+                    }
+                    stepBoundedValues[currentStateId].push_back(value);
+                }
+                stack.pop_back();
+            }
+        }
+        
+        template<typename ModelType, typename StateType>
+        typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeStepBoundedValueOfAction(ActionType const& action, uint64_t stepBound, ExplorationInformation<StateType, ValueType> const& explorationInformation, std::vector<std::vector<ValueType>> const& stepBoundedValues) const {
+            ValueType result = storm::utility::zero<ValueType>();
+            for (auto const& element : explorationInformation.getRowOfMatrix(action)) {
+                result += element.getValue() * stepBoundedValues[element.getColumn()][stepBound];
+            }
+            return result;
+        }
+        
+        template<typename ModelType, typename StateType>
+        std::unique_ptr<tempest::shields::AbstractShield<typename ModelType::ValueType, typename storm::storage::SparseMatrix<typename ModelType::ValueType>::index_type>> SparseExplorationModelChecker<ModelType, StateType>::createShieldForStepBoundedProperty(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, uint64_t stepBound, StateType const& initialState, StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::vector<std::vector<ValueType>>& stepBoundedValues, std::unordered_map<StateType, storm::generator::CompressedState>* compressedStates) const {
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+            STORM_LOG_THROW(shieldingExpression->isPreSafetyShield(), storm::exceptions::NotSupportedException, "The exploration engine only supports the creation of pre-safety shields.");
+            STORM_LOG_THROW(stepBound > 0, storm::exceptions::InvalidPropertyException, "Shields for step-bounded properties require a positive step bound.");
+            storm::OptimizationDirection direction = explorationInformation.getOptimizationDirection();
+            
+            // Perform a search from the initial state in which the coalition only picks choices enabled by the shield.
+            std::map<StateType, std::vector<ValueType>> choiceValuesOfShieldedStates;
+            std::set<StateType> opponentStates;
+            std::set<StateType> reachedStates = {initialState};
+            std::vector<StateType> stack = {initialState};
+            while (!stack.empty()) {
+                StateType currentStateId = stack.back();
+                stack.pop_back();
+                computeStepBoundedValues(stateGeneration, currentStateId, stepBound, explorationInformation, bounds, stats, stepBoundedValues, compressedStates);
+                
+                // Terminal states (in particular target states) are not covered by the shield.
+                if (explorationInformation.isTerminal(currentStateId)) {
+                    continue;
+                }
+                
+                // The choices are rated by the probability to reach a target state within the step bound.
+                StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
+                std::vector<ValueType> choiceValues;
+                for (ActionType action = explorationInformation.getStartRowOfGroup(rowGroup); action < explorationInformation.getStartRowOfGroup(rowGroup + 1); ++action) {
+                    for (auto const& element : explorationInformation.getRowOfMatrix(action)) {
+                        computeStepBoundedValues(stateGeneration, element.getColumn(), stepBound - 1, explorationInformation, bounds, stats, stepBoundedValues, compressedStates);
+                    }
+                    choiceValues.push_back(computeStepBoundedValueOfAction(action, stepBound - 1, explorationInformation, stepBoundedValues));
+                }
+                
+                // The shield only restricts the choices of the coalition, so all choices of opponents are followed.
+                bool isOpponentState = explorationInformation.isOpponentRowGroup(rowGroup);
+                storm::storage::BitVector followedChoices(choiceValues.size(), isOpponentState);
+                if (isOpponentState) {
+                    opponentStates.insert(currentStateId);
+                } else {
+                    storm::storage::PreSchedulerChoice<ValueType> shieldedChoices = computeShieldedChoices(choiceValues, direction, *shieldingExpression);
+                    for (auto const& choice : shieldedChoices.getChoiceMap()) {
+                        followedChoices.set(std::get<1>(choice));
+                    }
+                    if (compressedStates != nullptr) {
+                        // Emit the shield for this state right away, its representation is no longer needed afterwards.
+                        auto compressedStateIt = compressedStates->find(currentStateId);
+                        shieldCallback(compressedStateIt->second, shieldedChoices);
+                        compressedStates->erase(compressedStateIt);
+                    }
+                }
+                choiceValuesOfShieldedStates.emplace(currentStateId, std::move(choiceValues));
+                
+                for (auto const& localAction : followedChoices) {
+                    for (auto const& element : explorationInformation.getRowOfMatrix(explorationInformation.getStartRowOfGroup(rowGroup) + localAction)) {
+                        if (reachedStates.insert(element.getColumn()).second) {
+                            stack.push_back(element.getColumn());
+                        }
+                    }
+                }
+            }
+            
+            std::size_t numberOfStates = explorationInformation.getNumberOfDiscoveredStates();
+            std::vector<IndexType> rowGroupIndices = {0};
+            std::vector<ValueType> choiceValues;
+            storm::storage::BitVector relevantStates(numberOfStates);
+            storm::storage::BitVector opponentStateVector(numberOfStates);
+            for (StateType state = 0; state < numberOfStates; ++state) {
+                auto choiceValuesIt = choiceValuesOfShieldedStates.find(state);
+                if (choiceValuesIt != choiceValuesOfShieldedStates.end()) {
+                    choiceValues.insert(choiceValues.end(), choiceValuesIt->second.begin(), choiceValuesIt->second.end());
+                    relevantStates.set(state);
+                    opponentStateVector.set(state, opponentStates.count(state) > 0);
+                }
+                rowGroupIndices.push_back(choiceValues.size());
+            }
+            STORM_LOG_INFO("Created shield for " << relevantStates.getNumberOfSetBits() << " of " << numberOfStates << " discovered states.");
+            
+            boost::optional<storm::storage::BitVector> coalitionStates;
+            if (explorationInformation.isGame()) {
+                coalitionStates = opponentStateVector;
+            }
+            return std::make_unique<tempest::shields::PreShield<ValueType, IndexType>>(rowGroupIndices, choiceValues, shieldingExpression, direction, relevantStates, coalitionStates);
+        }
+        
+        template<typename ModelType, typename StateType>
+        storm::storage::PreSchedulerChoice<typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::computeShieldedChoices(std::vector<ValueType> const& choiceValues, storm::OptimizationDirection const& direction, storm::logic::ShieldExpression const& shieldingExpression) const {
+            // This mirrors the filtering performed by the pre-shields.
+            storm::storage::PreSchedulerChoice<ValueType> result;
+            if (choiceValues.empty()) {
+                return result;
+            }
+            ValueType optimalValue = direction == storm::OptimizationDirection::Maximize ? *std::max_element(choiceValues.begin(), choiceValues.end()) : *std::min_element(choiceValues.begin(), choiceValues.end());
+            for (uint_fast64_t choice = 0; choice < choiceValues.size(); ++choice) {
+                bool enabled;
+                if (direction == storm::OptimizationDirection::Maximize) {
+                    enabled = shieldingExpression.isRelative() ? tempest::shields::utility::ChoiceFilter<ValueType, storm::utility::ElementGreaterEqual<ValueType>, true>()(choiceValues[choice], optimalValue, shieldingExpression.getValue()) : tempest::shields::utility::ChoiceFilter<ValueType, storm::utility::ElementGreaterEqual<ValueType>, false>()(choiceValues[choice], optimalValue, shieldingExpression.getValue());
+                } else {
+                    enabled = shieldingExpression.isRelative() ? tempest::shields::utility::ChoiceFilter<ValueType, storm::utility::ElementLessEqual<ValueType>, true>()(choiceValues[choice], optimalValue, shieldingExpression.getValue()) : tempest::shields::utility::ChoiceFilter<ValueType, storm::utility::ElementLessEqual<ValueType>, false>()(choiceValues[choice], optimalValue, shieldingExpression.getValue());
+                }
+                if (enabled) {
+                    result.addChoice(choice, choiceValues[choice]);
+                }
+            }
+            return result;
+        }
+        
         template<typename ModelType, typename StateType>
         typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeLowerBoundOfAction(ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
             ValueType result = storm::utility::zero<ValueType>();
@@ -603,10 +1157,11 @@ namespace storm {
         template<typename ModelType, typename StateType>
         std::pair<typename ModelType::ValueType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::computeBoundsOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
             StateType group = explorationInformation.getRowGroup(currentStateId);
-            std::pair<ValueType, ValueType> result = getLowestBounds(explorationInformation.getOptimizationDirection());
+            storm::OptimizationDirection direction = explorationInformation.getOptimizationDirectionOfRowGroup(group);
+            std::pair<ValueType, ValueType> result = getLowestBounds(direction);
             for (ActionType action = explorationInformation.getStartRowOfGroup(group); action < explorationInformation.getStartRowOfGroup(group + 1); ++action) {
                 std::pair<ValueType, ValueType> actionValues = computeBoundsOfAction(action, explorationInformation, bounds);
-                result = combineBounds(explorationInformation.getOptimizationDirection(), result, actionValues);
+                result = combineBounds(direction, result, actionValues);
             }
             return result;
         }
@@ -628,11 +1183,11 @@ namespace storm {
             // And set them as the current value.
             bounds.setBoundsForAction(action, newBoundsForAction);
             
-            // Check if we need to update the values for the states.
-            if (explorationInformation.maximize()) {
+            // Check if we need to update the values for the states. In games, this depends on the player of the state.
+            StateType rowGroup = explorationInformation.getRowGroup(state);
+            if (explorationInformation.maximizeInRowGroup(rowGroup)) {
                 bounds.setLowerBoundOfStateIfGreaterThanOld(state, explorationInformation, newBoundsForAction.first);
                 
-                StateType rowGroup = explorationInformation.getRowGroup(state);
                 if (newBoundsForAction.second < bounds.getUpperBoundForRowGroup(rowGroup)) {
                     if (explorationInformation.getRowGroupSize(rowGroup) > 1) {
                         newBoundsForAction.second = std::max(newBoundsForAction.second, computeBoundOverAllOtherActions(storm::OptimizationDirection::Maximize, state, action, explorationInformation, bounds));
@@ -643,7 +1198,6 @@ namespace storm {
             } else {
                 bounds.setUpperBoundOfStateIfLessThanOld(state, explorationInformation, newBoundsForAction.second);
                 
-                StateType rowGroup = explorationInformation.getRowGroup(state);
                 if (bounds.getLowerBoundForRowGroup(rowGroup) < newBoundsForAction.first) {
                     if (explorationInformation.getRowGroupSize(rowGroup) > 1) {
                         ValueType min = computeBoundOverAllOtherActions(storm::OptimizationDirection::Minimize, state, action, explorationInformation, bounds);
@@ -657,7 +1211,7 @@ namespace storm {
         
         template<typename ModelType, typename StateType>
         typename ModelType::ValueType SparseExplorationModelChecker<ModelType, StateType>::computeBoundOverAllOtherActions(storm::OptimizationDirection const& direction, StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const {
-            ValueType bound = getLowestBound(explorationInformation.getOptimizationDirection());
+            ValueType bound = getLowestBound(direction);
             
             ActionType group = explorationInformation.getRowGroup(state);
             for (auto currentAction = explorationInformation.getStartRowOfGroup(group); currentAction < explorationInformation.getStartRowOfGroup(group + 1); ++currentAction) {
@@ -700,5 +1254,6 @@ namespace storm {
         
         template class SparseExplorationModelChecker<storm::models::sparse::Dtmc<double>, uint32_t>;
         template class SparseExplorationModelChecker<storm::models::sparse::Mdp<double>, uint32_t>;
+        template class SparseExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t>;
     }
 }
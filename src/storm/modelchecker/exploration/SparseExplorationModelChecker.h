@@ -1,7 +1,9 @@
 #ifndef STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 #define STORM_MODELCHECKER_EXPLORATION_SPARSEEXPLORATIONMODELCHECKER_H_
 
+#include <functional>
 #include <random>
+#include <unordered_map>
 
 #include "storm/modelchecker/AbstractModelChecker.h"
 
@@ -10,14 +12,24 @@
 #include "storm/generator/CompressedState.h"
 #include "storm/generator/VariableInformation.h"
 
+#include "storm/storage/PlayerIndex.h"
+#include "storm/storage/PreSchedulerChoice.h"
+
 #include "storm/utility/ConstantsComparator.h"
 
+namespace tempest {
+    namespace shields {
+        template<typename ValueType, typename IndexType> class AbstractShield;
+    }
+}
+
 namespace storm {
     
     class Environment;
     
     namespace storage {
         class MaximalEndComponent;
+        class BitVector;
     }
     namespace prism {
         class Program;
@@ -39,15 +51,33 @@ namespace storm {
             typedef typename ModelType::ValueType ValueType;
             typedef StateType ActionType;
             typedef std::vector<std::pair<StateType, ActionType>> StateActionStack;
+            typedef std::function<void (storm::generator::CompressedState const&, storm::storage::PreSchedulerChoice<ValueType> const&)> ShieldCallback;
             
             SparseExplorationModelChecker(storm::prism::Program const& program);
             
+            /*!
+             * Sets a callback that is invoked for every state covered by a shield for a step-bounded property as soon as
+             * the choices enabled by the shield are known, i.e., before the exploration of the remaining states has
+             * finished. The indices of the enabled choices refer to the order in which the choices of the state are
+             * generated from the program.
+             */
+            void setShieldCallback(ShieldCallback const& callback);
+            
             virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
             
+            virtual std::unique_ptr<CheckResult> checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, ValueType> const& checkTask) override;
+            
             virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, CheckTask<storm::logic::UntilFormula, ValueType> const& checkTask) override;
             
+            virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+            
         private:
-            std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+            /*!
+             * Resolves the names and indices of the given coalition to the indices of the players of the program.
+             */
+            std::set<storm::storage::PlayerIndex> getPlayersOfCoalition(storm::logic::PlayerCoalition const& coalition) const;
+            
+            std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
 
             bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
@@ -59,8 +89,63 @@ namespace storm {
             
             bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
+            /*!
+             * Decreases the upper bounds of the states in end components of the given game fragment in which the
+             * minimizing player can keep the play by choices that are optimal with respect to the lower bounds. The upper
+             * bound of such an end component is the best upper bound of the choices of the maximizing player leaving it
+             * (deflation, see Kelmendi et al., CAV 2018).
+             */
+            void deflateEndComponents(std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, storm::storage::SparseMatrix<ValueType> const& transposedMatrix, storm::storage::BitVector const& maximizerStates, storm::storage::BitVector const& targetStates, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
+            
             void collapseMec(storm::storage::MaximalEndComponent const& mec, std::vector<StateType> const& relevantStates, storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
             
+            /*!
+             * Computes the states of the given game fragment from which the player maximizing the reachability
+             * probability cannot reach the target states with positive probability.
+             */
+            storm::storage::BitVector computeGameProb0States(storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& maximizerStates, storm::storage::BitVector const& targetStates) const;
+            
+            /*!
+             * Computes the states of the given game fragment from which the player maximizing the reachability
+             * probability can reach the target states almost surely.
+             */
+            storm::storage::BitVector computeGameProb1States(storm::storage::SparseMatrix<ValueType> const& relevantStatesMatrix, storm::storage::BitVector const& maximizerStates, storm::storage::BitVector const& targetStates) const;
+            
+            /*!
+             * Creates a pre-safety shield for the explored states. The choices are rated by the bound that is pessimistic
+             * wrt. the optimization direction. States that were not explored or were merged with others while collapsing
+             * end components are not covered by the shield.
+             */
+            std::unique_ptr<tempest::shields::AbstractShield<ValueType, typename storm::storage::SparseMatrix<ValueType>::index_type>> createShieldForExploredStates(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds) const;
+            
+            /*!
+             * Makes sure that the values of the given state are known for all step bounds up to the given one, where the
+             * value for step bound j is the optimal probability to reach a target state within j steps. Only the states
+             * needed to compute these values are explored. As the values are monotone in the step bound, a state whose
+             * value is one for some bound is not expanded any further.
+             *
+             * @param stepBoundedValues For each discovered state, the values computed so far (indexed by step bound).
+             * @param compressedStates If given, the representations of the states explored by this call are added.
+             */
+            void computeStepBoundedValues(StateGeneration<StateType, ValueType>& stateGeneration, StateType const& state, uint64_t stepBound, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::vector<std::vector<ValueType>>& stepBoundedValues, std::unordered_map<StateType, storm::generator::CompressedState>* compressedStates) const;
+            
+            ValueType computeStepBoundedValueOfAction(ActionType const& action, uint64_t stepBound, ExplorationInformation<StateType, ValueType> const& explorationInformation, std::vector<std::vector<ValueType>> const& stepBoundedValues) const;
+            
+            /*!
+             * Creates a pre-safety shield for a step-bounded property. Starting from the initial state, only the states
+             * that are reachable if the coalition picks choices enabled by the shield are covered. For each of them, the
+             * choices are rated by the probability to reach a target state within the step bound, which is computed
+             * locally from the states within that many steps.
+             *
+             * @param compressedStates If given, the shield callback is notified about every covered coalition state.
+             */
+            std::unique_ptr<tempest::shields::AbstractShield<ValueType, typename storm::storage::SparseMatrix<ValueType>::index_type>> createShieldForStepBoundedProperty(std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, uint64_t stepBound, StateType const& initialState, StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, std::vector<std::vector<ValueType>>& stepBoundedValues, std::unordered_map<StateType, storm::generator::CompressedState>* compressedStates) const;
+            
+            /*!
+             * Determines the choices that are enabled by the given shielding expression wrt. the given choice values.
+             */
+            storm::storage::PreSchedulerChoice<ValueType> computeShieldedChoices(std::vector<ValueType> const& choiceValues, storm::OptimizationDirection const& direction, storm::logic::ShieldExpression const& shieldingExpression) const;
+            
             void updateProbabilityBoundsAlongSampledPath(StateActionStack& stack, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
 
             void updateProbabilityOfAction(StateType const& state, ActionType const& action, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const;
@@ -83,6 +168,9 @@ namespace storm {
             
             // A comparator used to determine whether values are equal.
             storm::utility::ConstantsComparator<ValueType> comparator;
+            
+            // If set, this callback is notified about the states of a shield for a step-bounded property.
+            ShieldCallback shieldCallback;
         };
     }
 }
@@ -58,37 +58,52 @@ namespace storm {
                 STORM_LOG_THROW(env.modelchecker().multi().getPrecisionType() == MultiObjectiveModelCheckerEnvironment::PrecisionType::Absolute, storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
                 //First consider the objectives individually
-                for(uint_fast64_t objIndex = 0; objIndex<this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-                    WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-                    direction[objIndex] = storm::utility::one<GeometryValueType>();
-                    this->performRefinementStep(env, std::move(direction));
+                uint_fast64_t objIndex = 0;
+                while (objIndex < this->objectives.size() && !this->maxStepsPerformed(env)) {
+                    std::vector<WeightVector> directions;
+                    for (uint64_t batchSize = this->getRefinementBatchSize(env); objIndex < this->objectives.size() && directions.size() < batchSize; ++objIndex) {
+                        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+                        direction[objIndex] = storm::utility::one<GeometryValueType>();
+                        directions.push_back(std::move(direction));
+                    }
+                    this->performRefinementSteps(env, std::move(directions));
                     if (storm::utility::resources::isTerminate()) {
                         break;
                     }
                 }
                 
+                GeometryValueType precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
                 while(!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-                    // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+                    // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
                     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
                     std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-                    uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-                    GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+                    std::vector<std::pair<GeometryValueType, uint_fast64_t>> halfspaceDistances;
+                    halfspaceDistances.reserve(underApproxHalfspaces.size());
                     for(uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
+                        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
                         for(auto const& vertex : overApproxVertices) {
-                            GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                            if(distance > farestDistance) {
-                                farestHalfspaceIndex = halfspaceIndex;
-                                farestDistance = distance;
-                            }
+                            farestDistance = std::max(farestDistance, underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex));
                         }
+                        halfspaceDistances.emplace_back(std::move(farestDistance), halfspaceIndex);
                     }
-                    if(farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+                    // Consider the farest halfspaces first. Ties are resolved in favor of the halfspace with the smaller index.
+                    std::stable_sort(halfspaceDistances.begin(), halfspaceDistances.end(), [] (std::pair<GeometryValueType, uint_fast64_t> const& lhs, std::pair<GeometryValueType, uint_fast64_t> const& rhs) { return lhs.first > rhs.first; });
+                    if(halfspaceDistances.empty() || halfspaceDistances.front().first < precision) {
                         // Goal precision reached!
                         return;
                     }
-                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-                    WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-                    this->performRefinementStep(env, std::move(direction));
+                    STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(halfspaceDistances.front().first));
+                    
+                    // The weight vectors of one batch are checked concurrently.
+                    std::vector<WeightVector> directions;
+                    uint64_t batchSize = this->getRefinementBatchSize(env);
+                    for (auto const& halfspaceDistance : halfspaceDistances) {
+                        if (directions.size() >= batchSize || halfspaceDistance.first < precision) {
+                            break;
+                        }
+                        directions.push_back(underApproxHalfspaces[halfspaceDistance.second].normalVector());
+                    }
+                    this->performRefinementSteps(env, std::move(directions));
                 }
                 STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
             }
@@ -1,6 +1,7 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
 #include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -29,7 +30,7 @@ namespace storm {
             
             template <class SparseModelType, typename GeometryValueType>
             SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult) :
-                originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+                originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives), preprocessorResult(preprocessorResult) {
 
                 this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
 
@@ -84,12 +85,64 @@ namespace storm {
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
                 // Normalize the direction vector so that the entries sum up to one
                 storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-                weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
+                refinementSteps.push_back(computeRefinementStep(env, direction, *weightVectorChecker));
+                
+                updateOverApproximation();
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+                if (directions.empty()) {
+                    return;
+                } else if (directions.size() == 1) {
+                    performRefinementStep(env, std::move(directions.front()));
+                    return;
+                }
+                
+                for (auto& direction : directions) {
+                    // Normalize the direction vector so that the entries sum up to one
+                    storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
+                }
+#ifdef STORM_HAVE_INTELTBB
+                if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                    // Create the missing weight vector checkers. They all share the (read-only) preprocessed model.
+                    while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+                        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+                    }
+                    for (auto& checker : additionalWeightVectorCheckers) {
+                        checker->setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+                    }
+                    std::vector<RefinementStep> steps(directions.size());
+                    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, directions.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                        for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                            steps[index] = computeRefinementStep(env, directions[index], index == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[index - 1]);
+                        }
+                    });
+                    for (auto& step : steps) {
+                        refinementSteps.push_back(std::move(step));
+                        updateOverApproximation();
+                    }
+                    updateUnderApproximation();
+                    return;
+                }
+#endif
+                // The directions are checked one after another, so a single weight vector checker suffices.
+                for (auto const& direction : directions) {
+                    refinementSteps.push_back(computeRefinementStep(env, direction, *weightVectorChecker));
+                    updateOverApproximation();
+                }
+                updateUnderApproximation();
+            }
+            
+            template <class SparseModelType, typename GeometryValueType>
+            typename SparsePcaaQuery<SparseModelType, GeometryValueType>::RefinementStep SparsePcaaQuery<SparseModelType, GeometryValueType>::computeRefinementStep(Environment const& env, WeightVector const& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const {
+                checker.check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
+                STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
                 RefinementStep step;
                 step.weightVector = direction;
-                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
+                step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+                step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
                 // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
                 for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
                     if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
@@ -97,10 +150,7 @@ namespace storm {
                         step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
                     }
                 }
-                refinementSteps.push_back(std::move(step));
-                
-                updateOverApproximation();
-                updateUnderApproximation();
+                return step;
             }
             
             template <class SparseModelType, typename GeometryValueType>
@@ -139,6 +189,16 @@ namespace storm {
                 this->refinementSteps.size() >= env.modelchecker().multi().getMaxSteps();
             }
             
+            template <class SparseModelType, typename GeometryValueType>
+            uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize(Environment const& env) const {
+                uint64_t result = env.modelchecker().multi().getWeightVectorBatchSize();
+                if (env.modelchecker().multi().isMaxStepsSet()) {
+                    uint64_t maxSteps = env.modelchecker().multi().getMaxSteps();
+                    result = std::min<uint64_t>(result, maxSteps > this->refinementSteps.size() ? maxSteps - this->refinementSteps.size() : 0);
+                }
+                return result;
+            }
+            
             template<typename SparseModelType, typename GeometryValueType>
             void SparsePcaaQuery<SparseModelType, GeometryValueType>::exportPlotOfCurrentApproximation(Environment const& env) const {
                
@@ -70,6 +70,12 @@ namespace storm {
                  */
                 void performRefinementStep(Environment const& env, WeightVector&& direction);
                 
+                /*
+                 * Refines the current result w.r.t. the given direction vectors. If Intel TBB is enabled, the directions are checked concurrently
+                 * (using a separate weight vector checker for each direction). The approximations are updated once all directions have been checked.
+                 */
+                void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+                
                 /*
                  * Updates the overapproximation after a refinement step has been performed
                  *
@@ -77,6 +83,11 @@ namespace storm {
                  */
                 void updateOverApproximation();
                 
+                /*
+                 * Checks the given (normalized) direction using the given weight vector checker
+                 */
+                RefinementStep computeRefinementStep(Environment const& env, WeightVector const& direction, PcaaWeightVectorChecker<SparseModelType>& checker) const;
+                
                 /*
                  * Updates the underapproximation after a refinement step has been performed
                  *
@@ -89,6 +100,11 @@ namespace storm {
                  */
                 bool maxStepsPerformed(Environment const& env) const;
                 
+                /*
+                 * Returns the number of refinement steps that are performed at once, taking the maximum number of refinement steps into account
+                 */
+                uint64_t getRefinementBatchSize(Environment const& env) const;
+                
                 SparseModelType const& originalModel;
                 storm::logic::MultiObjectiveFormula const& originalFormula;
                 
@@ -96,6 +112,8 @@ namespace storm {
                 
                 // The corresponding weight vector checker
                 std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
+                // Further weight vector checkers (created on demand) that allow to check multiple weight vectors concurrently
+                std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
 
                 //The results in each iteration of the algorithm
                 std::vector<RefinementStep> refinementSteps;
@@ -107,6 +125,9 @@ namespace storm {
                  // stores for each objective whether it still makes sense to check for this objective individually (i.e., with weight vector given by w_{i}>0 iff i=objIndex )
                 storm::storage::BitVector diracWeightVectorsToBeChecked;
                 
+                // The result of the preprocessing. All weight vector checkers share the preprocessed model.
+                preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
+                
                 
             };
             
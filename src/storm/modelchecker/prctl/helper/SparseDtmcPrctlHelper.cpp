@@ -1,5 +1,7 @@
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 
+#include <thread>
+
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
 #include "storm/utility/macros.h"
@@ -84,12 +86,7 @@ namespace storm {
                 progress.setMaxCount(epochOrder.size());
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-                    swCheck.stop();
+                auto processAnalyzedEpoch = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -101,8 +98,34 @@ namespace storm {
                     }
                     ++numCheckedEpochs;
                     progress.updateProgress(numCheckedEpochs);
-                    if (storm::utility::resources::isTerminate()) {
-                        break;
+                };
+                
+                bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+                parallelize = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+                if (parallelize) {
+                    // Epochs that do not depend on each other are analyzed concurrently. Each worker has its own solver.
+                    // The checking time then also includes the time for building the epoch models.
+                    uint64_t numberOfWorkers = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+                    std::vector<std::vector<ValueType>> workerX(numberOfWorkers), workerB(numberOfWorkers);
+                    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> workerSolvers(numberOfWorkers);
+                    swCheck.start();
+                    rewardUnfolding.analyzeEpochLevels(rewardUnfolding.getEpochComputationLevels(initEpoch), numberOfWorkers, [&](rewardbounded::EpochModel<ValueType, true>& epochModel, uint64_t worker) {
+                        return epochModel.analyzeSingleObjective(preciseEnv, workerX[worker], workerB[worker], workerSolvers[worker], lowerBound, upperBound);
+                    }, processAnalyzedEpoch);
+                    swCheck.stop();
+                } else {
+                    for (auto const& epoch : epochOrder) {
+                        swBuild.start();
+                        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                        swBuild.stop(); swCheck.start();
+                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
+                        swCheck.stop();
+                        processAnalyzedEpoch(epoch);
+                        if (storm::utility::resources::isTerminate()) {
+                            break;
+                        }
                     }
                 }
                 
@@ -80,12 +80,7 @@ namespace storm {
                 progress.setMaxCount(epochOrder.size());
                 progress.startNewMeasurement(0);
                 uint64_t numCheckedEpochs = 0;
-                for (auto const& epoch : epochOrder) {
-                    swBuild.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    swBuild.stop(); swCheck.start();
-                    rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-                    swCheck.stop();
+                auto processAnalyzedEpoch = [&](typename rewardbounded::MultiDimensionalRewardUnfolding<ValueType, true>::Epoch const& epoch) {
                     if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() && !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
                         std::vector<ValueType> cdfEntry;
                         for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
@@ -97,8 +92,34 @@ namespace storm {
                     }
                     ++numCheckedEpochs;
                     progress.updateProgress(numCheckedEpochs);
-                    if (storm::utility::resources::isTerminate()) {
-                        break;
+                };
+                
+                bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+                parallelize = storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#endif
+                if (parallelize) {
+                    // Epochs that do not depend on each other are analyzed concurrently. Each worker has its own solver.
+                    // The checking time then also includes the time for building the epoch models.
+                    uint64_t numberOfWorkers = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+                    std::vector<std::vector<ValueType>> workerX(numberOfWorkers), workerB(numberOfWorkers);
+                    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> workerSolvers(numberOfWorkers);
+                    swCheck.start();
+                    rewardUnfolding.analyzeEpochLevels(rewardUnfolding.getEpochComputationLevels(initEpoch), numberOfWorkers, [&](rewardbounded::EpochModel<ValueType, true>& epochModel, uint64_t worker) {
+                        return epochModel.analyzeSingleObjective(preciseEnv, dir, workerX[worker], workerB[worker], workerSolvers[worker], lowerBound, upperBound);
+                    }, processAnalyzedEpoch);
+                    swCheck.stop();
+                } else {
+                    for (auto const& epoch : epochOrder) {
+                        swBuild.start();
+                        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
+                        swBuild.stop(); swCheck.start();
+                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
+                        swCheck.stop();
+                        processAnalyzedEpoch(epoch);
+                        if (storm::utility::resources::isTerminate()) {
+                            break;
+                        }
                     }
                 }
 
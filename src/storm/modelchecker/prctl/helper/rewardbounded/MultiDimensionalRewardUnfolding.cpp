@@ -5,8 +5,11 @@
 #include <functional>
 
 #include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
 #include "storm/logic/Formulas.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -355,21 +358,101 @@ namespace storm {
                     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
                 }
                 
+                template<typename ValueType, bool SingleObjectiveMode>
+                std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>> MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationLevels(Epoch const& startEpoch, bool stopAtComputedEpochs) {
+                    // The computation order is a topological order, i.e., successor epochs are always considered before their predecessors
+                    std::vector<Epoch> epochOrder = getEpochComputationOrder(startEpoch, stopAtComputedEpochs);
+                    std::unordered_map<Epoch, uint64_t> epochLevels;
+                    epochLevels.reserve(epochOrder.size());
+                    std::vector<std::vector<Epoch>> result;
+                    for (auto const& epoch : epochOrder) {
+                        // The level of an epoch is the smallest level that is larger than the levels of all its successor epochs
+                        uint64_t level = 0;
+                        for (auto const& step : possibleEpochSteps) {
+                            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+                            if (successorEpoch != epoch) {
+                                auto successorLevelIt = epochLevels.find(successorEpoch);
+                                if (successorLevelIt != epochLevels.end()) {
+                                    level = std::max(level, successorLevelIt->second + 1);
+                                } else {
+                                    STORM_LOG_ASSERT(stopAtComputedEpochs && epochSolutions.count(successorEpoch) > 0, "Successor epoch " << epochManager.toString(successorEpoch) << " is not considered before epoch " << epochManager.toString(epoch) << ".");
+                                }
+                            }
+                        }
+                        epochLevels.emplace(epoch, level);
+                        if (level >= result.size()) {
+                            result.resize(level + 1);
+                        }
+                        // Since the epochs are inserted w.r.t. the computation order, epochs of the same class remain adjacent.
+                        result[level].push_back(epoch);
+                    }
+                    return result;
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochLevels(std::vector<std::vector<Epoch>> const& levels, uint64_t numberOfWorkers, std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>& epochModel, uint64_t worker)> const& analyzeEpochModel, std::function<void(Epoch const& epoch)> const& epochAnalyzed) {
+                    STORM_LOG_THROW(numberOfWorkers > 0, storm::exceptions::IllegalArgumentException, "The number of workers must be positive.");
+                    while (workerContexts.size() < numberOfWorkers) {
+                        workerContexts.emplace_back();
+                        workerContexts.back().epochModel.equationSolverProblemFormat = defaultContext.epochModel.equationSolverProblemFormat;
+                    }
+                    
+                    for (auto const& level : levels) {
+                        // Each worker analyzes a contiguous block of epochs. This way, the epoch model of a worker only changes if the epoch class changes.
+                        uint64_t levelWorkers = std::min<uint64_t>(numberOfWorkers, level.size());
+                        uint64_t blockSize = (level.size() + levelWorkers - 1) / levelWorkers;
+                        std::vector<std::vector<SolutionType>> levelSolutions(level.size());
+                        std::vector<std::shared_ptr<std::vector<uint64_t> const>> levelInStateMaps(level.size());
+                        auto analyzeBlock = [&](uint64_t worker) {
+                            EpochModelContext& context = workerContexts[worker];
+                            uint64_t blockEnd = std::min<uint64_t>(level.size(), (worker + 1) * blockSize);
+                            for (uint64_t epochIndex = worker * blockSize; epochIndex < blockEnd; ++epochIndex) {
+                                levelSolutions[epochIndex] = analyzeEpochModel(setCurrentEpoch(level[epochIndex], context), worker);
+                                levelInStateMaps[epochIndex] = context.productStateToEpochModelInStateMap;
+                            }
+                        };
+#ifdef STORM_HAVE_INTELTBB
+                        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, levelWorkers, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                            for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                                analyzeBlock(worker);
+                            }
+                        });
+#else
+                        for (uint64_t worker = 0; worker < levelWorkers; ++worker) {
+                            analyzeBlock(worker);
+                        }
+#endif
+                        // Storing the solutions is done sequentially as it might also erase solutions that are no longer needed.
+                        for (uint64_t epochIndex = 0; epochIndex < level.size(); ++epochIndex) {
+                            setSolutionForEpoch(level[epochIndex], levelInStateMaps[epochIndex], std::move(levelSolutions[epochIndex]));
+                            epochAnalyzed(level[epochIndex]);
+                        }
+                        if (storm::utility::resources::isTerminate()) {
+                            break;
+                        }
+                    }
+                }
+                
                 template<typename ValueType, bool SingleObjectiveMode>
                 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+                    return setCurrentEpoch(epoch, defaultContext);
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch, EpochModelContext& context) {
                     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
                     
                     // Check if we need to update the current epoch class
-                    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-                        setCurrentEpochClass(epoch);
-                        epochModel.epochMatrixChanged = true;
+                    if (!context.currentEpoch || !epochManager.compareEpochClass(epoch, context.currentEpoch.get())) {
+                        setCurrentEpochClass(epoch, context);
+                        context.epochModel.epochMatrixChanged = true;
                         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-                            if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
+                            if (storm::utility::graph::hasCycle(context.epochModel.epochMatrix)) {
                                 std::cout << "Epoch model for epoch " << epochManager.toString(epoch) <<  " is cyclic." << std::endl;
                             }
                         }
                     } else {
-                        epochModel.epochMatrixChanged = false;
+                        context.epochModel.epochMatrixChanged = false;
                     }
                     
                     bool containsLowerBoundedObjective = false;
@@ -388,10 +471,10 @@ namespace storm {
                             subSolutions.emplace(successorEpoch, &successorSolIt->second);
                         }
                     }
-                    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-                    auto stepSolIt = epochModel.stepSolutions.begin();
-                    for (auto reducedChoice : epochModel.stepChoices) {
-                        uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
+                    context.epochModel.stepSolutions.resize(context.epochModel.stepChoices.getNumberOfSetBits());
+                    auto stepSolIt = context.epochModel.stepSolutions.begin();
+                    for (auto reducedChoice : context.epochModel.stepChoices) {
+                        uint64_t productChoice = context.epochModelToProductChoiceMap[reducedChoice];
                         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
                         auto const& memoryState = productModel->getMemoryState(productState);
                         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, productModel->getSteps()[productChoice]);
@@ -401,7 +484,7 @@ namespace storm {
                         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
                         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
                         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-                            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+                            bool rewardEarned = !storm::utility::isZero(context.epochModel.objectiveRewards[objIndex][reducedChoice]);
                             if (rewardEarned) {
                                 for (auto dim : objectiveDimensions[objIndex]) {
                                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) && productModel->getMemoryStateManager().isRelevantDimension(memoryState, dim)) {
@@ -410,7 +493,7 @@ namespace storm {
                                     }
                                 }
                             }
-                            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+                            context.epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
                         }
                         // compute the solution for the stepChoices
                         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -443,33 +526,33 @@ namespace storm {
                         ++stepSolIt;
                     }
                     
-                    assert(epochModel.objectiveRewards.size() == objectives.size());
-                    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-                    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-                    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-                    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-                    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-                    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+                    assert(context.epochModel.objectiveRewards.size() == objectives.size());
+                    assert(context.epochModel.objectiveRewardFilter.size() == objectives.size());
+                    assert(context.epochModel.epochMatrix.getRowCount() == context.epochModel.stepChoices.size());
+                    assert(context.epochModel.stepChoices.size() == context.epochModel.objectiveRewards.front().size());
+                    assert(context.epochModel.objectiveRewards.front().size() == context.epochModel.objectiveRewards.back().size());
+                    assert(context.epochModel.objectiveRewards.front().size() == context.epochModel.objectiveRewardFilter.front().size());
+                    assert(context.epochModel.objectiveRewards.back().size() == context.epochModel.objectiveRewardFilter.back().size());
+                    assert(context.epochModel.stepChoices.getNumberOfSetBits() == context.epochModel.stepSolutions.size());
                     
-                    currentEpoch = epoch;
+                    context.currentEpoch = epoch;
                     /*
                     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << std::endl;
-                    std::cout << "Matrix: " << std::endl << epochModel.epochMatrix << std::endl;
-                    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << std::endl;
-                    std::cout << "steps: " << epochModel.stepChoices << std::endl;
+                    std::cout << "Matrix: " << std::endl << context.epochModel.epochMatrix << std::endl;
+                    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(context.epochModel.objectiveRewards[0]) << std::endl;
+                    std::cout << "steps: " << context.epochModel.stepChoices << std::endl;
                     std::cout << "step solutions: ";
-                    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-                        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+                    for (int i = 0; i < context.epochModel.stepSolutions.size(); ++i) {
+                        std::cout << "   " << context.epochModel.stepSolutions[i].weightedValue;
                     }
                     std::cout << std::endl;
                     */
-                    return epochModel;
+                    return context.epochModel;
                     
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch, EpochModelContext& context) const {
                     EpochClass epochClass = epochManager.getEpochClass(epoch);
                     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << std::endl;
                     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -482,7 +565,7 @@ namespace storm {
                         }
                         ++choice;
                     }
-                    epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
+                    context.epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
                     // redirect transitions for the case where the lower reward bounds are not met yet
                     storm::storage::BitVector violatedLowerBoundedDimensions(dimensions.size(), false);
                     for (uint64_t dim = 0; dim < dimensions.size(); ++dim) {
@@ -491,9 +574,9 @@ namespace storm {
                         }
                     }
                     if (!violatedLowerBoundedDimensions.empty()) {
-                        for (uint64_t state = 0; state < epochModel.epochMatrix.getRowGroupCount(); ++state) {
+                        for (uint64_t state = 0; state < context.epochModel.epochMatrix.getRowGroupCount(); ++state) {
                             auto const& memoryState = productModel->getMemoryState(state);
-                            for (auto& entry : epochModel.epochMatrix.getRowGroup(state)) {
+                            for (auto& entry : context.epochModel.epochMatrix.getRowGroup(state)) {
                                 entry.setColumn(productModel->transformProductState(entry.getColumn(), epochClass, memoryState));
                             }
                         }
@@ -510,21 +593,21 @@ namespace storm {
                     // Get the relevant states for this epoch.
                     storm::storage::BitVector productInStates = productModel->getInStates(epochClass);
                     // The epoch model only needs to consider the states that are reachable from a relevant state
-                    storm::storage::BitVector consideredStates = storm::utility::graph::getReachableStates(epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
+                    storm::storage::BitVector consideredStates = storm::utility::graph::getReachableStates(context.epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
                     
                     // We assume that there is no end component in which objective reward is earned
-                    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(epochModel.epochMatrix, epochModel.epochMatrix.transpose(true), allProductStates, ~zeroObjRewardChoices & ~stepChoices), "There is a scheduler that yields infinite reward for one objective. This case should be excluded");
+                    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(context.epochModel.epochMatrix, context.epochModel.epochMatrix.transpose(true), allProductStates, ~zeroObjRewardChoices & ~stepChoices), "There is a scheduler that yields infinite reward for one objective. This case should be excluded");
                     
                     // Create the epoch model matrix
                     std::vector<uint64_t> productToEpochModelStateMapping;
                     if (model.isOfType(storm::models::ModelType::Dtmc)) {
                         assert(zeroObjRewardChoices.size() == productModel->getProduct().getNumberOfStates());
                         assert(stepChoices.size() == productModel->getProduct().getNumberOfStates());
-                        STORM_LOG_ASSERT(epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
-                        bool convertToEquationSystem = epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                        STORM_LOG_ASSERT(context.epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
+                        bool convertToEquationSystem = context.epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
                         // For DTMCs we consider the subsystem induced by the considered states.
                         // The transitions for states with zero reward are filtered out to guarantee a unique solution of the eq-system.
-                        auto backwardTransitions = epochModel.epochMatrix.transpose(true);
+                        auto backwardTransitions = context.epochModel.epochMatrix.transpose(true);
                         storm::storage::BitVector nonZeroRewardStates = storm::utility::graph::performProbGreater0(backwardTransitions, consideredStates, consideredStates & (~zeroObjRewardChoices | stepChoices));
                         // If there is at least one considered state with reward zero, we have to add a 'zero-reward-state' to the epoch model.
                         bool requiresZeroRewardState = nonZeroRewardStates != consideredStates;
@@ -535,83 +618,83 @@ namespace storm {
                         }
                         storm::storage::SparseMatrixBuilder<ValueType> builder;
                         if (!nonZeroRewardStates.empty()) {
-                            builder = storm::storage::SparseMatrixBuilder<ValueType>(epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
+                            builder = storm::storage::SparseMatrixBuilder<ValueType>(context.epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
                         }
                         if (requiresZeroRewardState) {
                             if (convertToEquationSystem) {
                                 // add a diagonal entry
                                 builder.addNextValue(zeroRewardInState, zeroRewardInState, storm::utility::zero<ValueType>());
                             }
-                            epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
+                            context.epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
                         } else {
                             assert (!nonZeroRewardStates.empty());
-                            epochModel.epochMatrix = builder.build();
+                            context.epochModel.epochMatrix = builder.build();
                         }
                         if (convertToEquationSystem) {
-                            epochModel.epochMatrix.convertToEquationSystem();
+                            context.epochModel.epochMatrix.convertToEquationSystem();
                         }
                         
-                        epochModelToProductChoiceMap.clear();
-                        epochModelToProductChoiceMap.reserve(numEpochModelStates);
+                        context.epochModelToProductChoiceMap.clear();
+                        context.epochModelToProductChoiceMap.reserve(numEpochModelStates);
                         productToEpochModelStateMapping.assign(nonZeroRewardStates.size(), zeroRewardInState);
                         for (auto productState : nonZeroRewardStates) {
-                            productToEpochModelStateMapping[productState] = epochModelToProductChoiceMap.size();
-                            epochModelToProductChoiceMap.push_back(productState);
+                            productToEpochModelStateMapping[productState] = context.epochModelToProductChoiceMap.size();
+                            context.epochModelToProductChoiceMap.push_back(productState);
                         }
                         if (requiresZeroRewardState) {
                             uint64_t zeroRewardProductState = (consideredStates & ~nonZeroRewardStates).getNextSetIndex(0);
                             assert(zeroRewardProductState < consideredStates.size());
-                            epochModelToProductChoiceMap.push_back(zeroRewardProductState);
+                            context.epochModelToProductChoiceMap.push_back(zeroRewardProductState);
                         }
                     } else if (model.isOfType(storm::models::ModelType::Mdp)) {
                         // Eliminate zero-reward end components
-                        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(epochModel.epochMatrix, consideredStates, zeroObjRewardChoices & ~stepChoices, consideredStates);
-                        epochModel.epochMatrix = std::move(ecElimResult.matrix);
-                        epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
+                        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(context.epochModel.epochMatrix, consideredStates, zeroObjRewardChoices & ~stepChoices, consideredStates);
+                        context.epochModel.epochMatrix = std::move(ecElimResult.matrix);
+                        context.epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
                         productToEpochModelStateMapping = std::move(ecElimResult.oldToNewStateMapping);
                     } else {
                         STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Unsupported model type.");
                     }
                 
-                    epochModel.stepChoices = storm::storage::BitVector(epochModel.epochMatrix.getRowCount(), false);
-                    for (uint64_t choice = 0; choice < epochModel.epochMatrix.getRowCount(); ++choice) {
-                        if (stepChoices.get(epochModelToProductChoiceMap[choice])) {
-                            epochModel.stepChoices.set(choice, true);
+                    context.epochModel.stepChoices = storm::storage::BitVector(context.epochModel.epochMatrix.getRowCount(), false);
+                    for (uint64_t choice = 0; choice < context.epochModel.epochMatrix.getRowCount(); ++choice) {
+                        if (stepChoices.get(context.epochModelToProductChoiceMap[choice])) {
+                            context.epochModel.stepChoices.set(choice, true);
                         }
                     }
                     
-                    epochModel.objectiveRewards.clear();
+                    context.epochModel.objectiveRewards.clear();
                     for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
                         std::vector<ValueType> const& productObjRew = productObjectiveRewards[objIndex];
                         std::vector<ValueType> reducedModelObjRewards;
-                        reducedModelObjRewards.reserve(epochModel.epochMatrix.getRowCount());
-                        for (auto const& productChoice : epochModelToProductChoiceMap) {
+                        reducedModelObjRewards.reserve(context.epochModel.epochMatrix.getRowCount());
+                        for (auto const& productChoice : context.epochModelToProductChoiceMap) {
                             reducedModelObjRewards.push_back(productObjRew[productChoice]);
                         }
                         // Check if the objective is violated in the current epoch
                         if (!violatedLowerBoundedDimensions.isDisjointFrom(objectiveDimensions[objIndex])) {
-                            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~epochModel.stepChoices, storm::utility::zero<ValueType>());
+                            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~context.epochModel.stepChoices, storm::utility::zero<ValueType>());
                         }
-                        epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
+                        context.epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
                     }
                     
-                    epochModel.epochInStates = storm::storage::BitVector(epochModel.epochMatrix.getRowGroupCount(), false);
+                    context.epochModel.epochInStates = storm::storage::BitVector(context.epochModel.epochMatrix.getRowGroupCount(), false);
                     for (auto productState : productInStates) {
-                        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < epochModel.epochMatrix.getRowGroupCount(), "Selected product state does not exist in the epoch model.");
-                        epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
+                        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < context.epochModel.epochMatrix.getRowGroupCount(), "Selected product state does not exist in the epoch model.");
+                        context.epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
                     }
                     
                     std::vector<uint64_t> toEpochModelInStatesMap(productModel->getProduct().getNumberOfStates(), std::numeric_limits<uint64_t>::max());
-                    std::vector<uint64_t> epochModelStateToInStateMap = epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
+                    std::vector<uint64_t> epochModelStateToInStateMap = context.epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
                     for (auto productState : productInStates) {
                         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
                     }
-                    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+                    context.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
                     
-                    epochModel.objectiveRewardFilter.clear();
-                    for (auto const& objRewards : epochModel.objectiveRewards) {
-                        epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
-                        epochModel.objectiveRewardFilter.back().complement();
+                    context.epochModel.objectiveRewardFilter.clear();
+                    for (auto const& objRewards : context.epochModel.objectiveRewards) {
+                        context.epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
+                        context.epochModel.objectiveRewardFilter.back().complement();
                     }
                 }
                 
@@ -619,7 +702,10 @@ namespace storm {
                 template<typename ValueType, bool SingleObjectiveMode>
                 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
                     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-                    epochModel.equationSolverProblemFormat = eqSysFormat;
+                    defaultContext.epochModel.equationSolverProblemFormat = eqSysFormat;
+                    for (auto& context : workerContexts) {
+                        context.epochModel.equationSolverProblemFormat = eqSysFormat;
+                    }
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
@@ -801,16 +887,20 @@ namespace storm {
                 
                 template<typename ValueType, bool SingleObjectiveMode>
                 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-                    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-                    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
-    
+                    STORM_LOG_ASSERT(defaultContext.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+                    STORM_LOG_ASSERT(inStateSolutions.size() == defaultContext.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+                    setSolutionForEpoch(defaultContext.currentEpoch.get(), defaultContext.productStateToEpochModelInStateMap, std::move(inStateSolutions));
+                }
+                
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForEpoch(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions) {
                     std::set<Epoch> predecessorEpochs, successorEpochs;
                     for (auto const& step : possibleEpochSteps) {
-                        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-                        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+                        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+                        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
                     }
-                    predecessorEpochs.erase(currentEpoch.get());
-                    successorEpochs.erase(currentEpoch.get());
+                    predecessorEpochs.erase(epoch);
+                    successorEpochs.erase(epoch);
                     
                     // clean up solutions that are not needed anymore
                     for (auto const& successorEpoch : successorEpochs) {
@@ -825,27 +915,27 @@ namespace storm {
                     // add the new solution
                     EpochSolution solution;
                     solution.count = predecessorEpochs.size();
-                    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+                    solution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
                     solution.solutions = std::move(inStateSolutions);
-                    epochSolutions[currentEpoch.get()] = std::move(solution);
+                    epochSolutions[epoch] = std::move(solution);
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) const {
                     auto epochSolutionIt = epochSolutions.find(epoch);
                     STORM_LOG_ASSERT(epochSolutionIt != epochSolutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
                     return getStateSolution(epochSolutionIt->second, productState);
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const {
                     auto epochSolutionIt = solutions.find(epoch);
                     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
                     return *epochSolutionIt->second;
                 }
                 
                 template<typename ValueType, bool SingleObjectiveMode>
-                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+                typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const {
                     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
                     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(), "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
                     return epochSolution.solutions[(*epochSolution.productStateToSolutionVectorMap)[productState]];
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
+#include <unordered_map>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
@@ -60,6 +62,24 @@ namespace storm {
                      */
                     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
                     
+                    /*!
+                     * Groups the epochs that need to be analyzed to get a result at the start epoch into levels.
+                     * The epochs of a level only depend on epochs of previous levels and can thus be analyzed independently of each other.
+                     * Within a level, epochs of the same epoch class are adjacent.
+                     * @param stopAtComputedEpochs if set, the search for epochs that need to be computed is stopped at epochs that already have been computed earlier.
+                     */
+                    std::vector<std::vector<Epoch>> getEpochComputationLevels(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
+                    
+                    /*!
+                     * Analyzes the epochs of the given levels (as obtained from getEpochComputationLevels) level by level.
+                     * The epochs of a level are split into (at most) numberOfWorkers contiguous blocks which are analyzed concurrently if Intel TBB is available.
+                     * Each worker keeps its own epoch model so that models of the same epoch class are reused by a worker across blocks and levels.
+                     *
+                     * @param analyzeEpochModel analyzes the given epoch model using the data of the given worker (an index below numberOfWorkers) and returns the solutions for the in-states of the epoch model.
+                     * @param epochAnalyzed invoked sequentially for each epoch once its solution is available.
+                     */
+                    void analyzeEpochLevels(std::vector<std::vector<Epoch>> const& levels, uint64_t numberOfWorkers, std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>& epochModel, uint64_t worker)> const& analyzeEpochModel, std::function<void(Epoch const& epoch)> const& epochAnalyzed);
+                    
                     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
                     
                     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -84,7 +104,22 @@ namespace storm {
 
                 private:
                 
-                    void setCurrentEpochClass(Epoch const& epoch);
+                    /*!
+                     * An epoch model together with the data that relates it to the product model.
+                     */
+                    struct EpochModelContext {
+                        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+                        boost::optional<Epoch> currentEpoch;
+                        std::vector<uint64_t> epochModelToProductChoiceMap;
+                        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+                    };
+                    
+                    /*!
+                     * Sets the epoch of the given context. As long as no solutions are set, this can be invoked concurrently for different contexts.
+                     */
+                    EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch, EpochModelContext& context);
+                    void setCurrentEpochClass(Epoch const& epoch, EpochModelContext& context) const;
+                    void setSolutionForEpoch(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions);
                     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
                     
                     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -116,27 +151,26 @@ namespace storm {
                     template<bool SO = SingleObjectiveMode, typename std::enable_if<!SO, int>::type = 0>
                     std::string solutionToString(SolutionType const& solution) const;
                     
-                    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState);
+                    SolutionType const& getStateSolution(Epoch const& epoch, uint64_t const& productState) const;
                     struct EpochSolution {
                         uint64_t count;
+                        // Shared among all epochs of the same epoch class (analyzed with the same epoch model)
                         std::shared_ptr<std::vector<uint64_t> const> productStateToSolutionVectorMap;
                         std::vector<SolutionType> solutions;
                     };
-                    std::map<Epoch, EpochSolution> epochSolutions;
-                    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-                    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+                    std::unordered_map<Epoch, EpochSolution> epochSolutions;
+                    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+                    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
                     
                     storm::models::sparse::Model<ValueType> const& model;
                     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
                     
                     std::unique_ptr<ProductModel<ValueType>> productModel;
                     
-                    std::vector<uint64_t> epochModelToProductChoiceMap;
-                    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
                     std::set<Epoch> possibleEpochSteps;
 
-                    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-                    boost::optional<Epoch> currentEpoch;
+                    EpochModelContext defaultContext; // The context used by setCurrentEpoch(epoch)
+                    std::vector<EpochModelContext> workerContexts; // The contexts used by analyzeEpochLevels
 
                     EpochManager epochManager;
                     
@@ -0,0 +1,158 @@
+#include "storm/modelchecker/rpatl/helper/SparseSmgLtlHelper.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/automata/LTL2DeterministicAutomaton.h"
+#include "storm/transformer/DAProductBuilder.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
+#include "storm/modelchecker/rpatl/helper/internal/ParityGameHelper.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template <typename ValueType>
+            SMGSparseModelCheckingHelperReturnType<ValueType> SparseSmgLtlHelper<ValueType>::computeLTLProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::logic::PathFormula const& formula, CheckFormulaCallback const& formulaChecker, bool qualitative, storm::storage::BitVector const& statesOfCoalition) {
+                STORM_LOG_THROW(goal.hasDirection(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+                STORM_LOG_THROW(!env.modelchecker().isLtl2daToolSet(), storm::exceptions::NotSupportedException, "LTL model checking of games requires parity automata, which are only constructed with Spot (not with an external LTL2DA tool).");
+
+                // Replace the maximal state subformulas by atomic propositions and compute their satisfaction sets.
+                storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+                std::shared_ptr<storm::logic::Formula const> ltlFormula = storm::logic::ExtractMaximalStateFormulasVisitor::extract(formula, extracted);
+                std::map<std::string, storm::storage::BitVector> apSatSets;
+                for (auto const& ap : extracted) {
+                    STORM_LOG_DEBUG(" Computing satisfaction set for atomic proposition \"" << ap.first << "\" <=> " << *ap.second << "...");
+                    apSatSets[ap.first] = formulaChecker(*ap.second);
+                }
+
+                if (goal.minimize()) {
+                    // The minimal probability of the formula is one minus the maximal probability of its negation.
+                    ltlFormula = std::make_shared<storm::logic::UnaryBooleanPathFormula>(storm::logic::UnaryBooleanOperatorType::Not, ltlFormula);
+                    STORM_LOG_INFO("Computing Pmin, proceeding with negated LTL formula.");
+                }
+                STORM_LOG_INFO("Resulting LTL path formula: " << ltlFormula->toString());
+
+                std::shared_ptr<storm::automata::DeterministicAutomaton> da = storm::automata::LTL2DeterministicAutomaton::ltl2dpaSpot(*ltlFormula);
+                storm::storage::BitVector relevantStates = goal.hasRelevantValues() ? goal.relevantValues() : storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true);
+                auto result = computeDAProductProbabilities(env, *da, apSatSets, transitionMatrix, relevantStates, qualitative, statesOfCoalition);
+
+                if (goal.minimize()) {
+                    for (auto& value : result.values) {
+                        value = storm::utility::one<ValueType>() - value;
+                    }
+                }
+                return result;
+            }
+
+            template <typename ValueType>
+            SMGSparseModelCheckingHelperReturnType<ValueType> SparseSmgLtlHelper<ValueType>::computeDAProductProbabilities(Environment const& env, storm::automata::DeterministicAutomaton const& da, std::map<std::string, storm::storage::BitVector>& apSatSets, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& relevantStates, bool qualitative, storm::storage::BitVector const& statesOfCoalition) {
+                std::vector<storm::storage::BitVector> statesForAP;
+                for (std::string const& ap : da.getAPSet().getAPs()) {
+                    auto it = apSatSets.find(ap);
+                    STORM_LOG_THROW(it != apSatSets.end(), storm::exceptions::InvalidOperationException, "Deterministic automaton has AP " << ap << ", does not appear in formula");
+                    statesForAP.push_back(std::move(it->second));
+                }
+
+                // The product is built from the relevant states such that each of them is represented by a state of interest.
+                uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+                STORM_LOG_INFO("Building SMG-DA product with deterministic parity automaton, starting from " << relevantStates.getNumberOfSetBits() << " model states...");
+                transformer::DAProductBuilder productBuilder(da, statesForAP);
+                auto product = productBuilder.build<productModelType>(transitionMatrix, relevantStates);
+                storm::storage::SparseMatrix<ValueType> const& productMatrix = product->getProductModel().getTransitionMatrix();
+                storm::storage::SparseMatrix<ValueType> productBackwardTransitions = product->getProductModel().getBackwardTransitions();
+                uint64_t const numberOfProductStates = product->getProductModel().getNumberOfStates();
+                STORM_LOG_INFO("Product SMG-DA has " << numberOfProductStates << " states and " << product->getProductModel().getNumberOfTransitions() << " transitions.");
+
+                // A product state belongs to the same player as its model state.
+                storm::storage::BitVector productStatesOfCoalition = product->liftFromModel(statesOfCoalition);
+                std::vector<uint64_t> priorities = computePriorities(*product->getAcceptance(), numberOfProductStates);
+                internal::ParityGameHelper<ValueType> parityGameHelper(productMatrix, ~productStatesOfCoalition, priorities);
+                storm::storage::BitVector winningStates = parityGameHelper.computeAlmostSureWinningStates();
+                STORM_LOG_INFO("The coalition wins almost surely from " << winningStates.getNumberOfSetBits() << " of " << numberOfProductStates << " product states.");
+
+                // The other players win the complementary parity objective, which is obtained by increasing all priorities by one.
+                std::vector<uint64_t> opponentPriorities = priorities;
+                for (auto& priority : opponentPriorities) {
+                    ++priority;
+                }
+                internal::ParityGameHelper<ValueType> opponentParityGameHelper(productMatrix, productStatesOfCoalition, opponentPriorities);
+                storm::storage::BitVector opponentWinningStates = opponentParityGameHelper.computeAlmostSureWinningStates();
+                STORM_LOG_INFO("The other players win almost surely from " << opponentWinningStates.getNumberOfSetBits() << " of " << numberOfProductStates << " product states.");
+
+                // Computes the maximal probabilities of reaching the given states, where the players owning the flipped states minimize.
+                auto computeReachabilityProbabilities = [&] (storm::storage::BitVector const& targetStates, storm::storage::BitVector const& flippedStates) {
+                    if (targetStates.empty()) {
+                        return std::vector<ValueType>(numberOfProductStates, storm::utility::zero<ValueType>());
+                    }
+                    auto productResult = SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(storm::solver::OptimizationDirection::Maximize), productMatrix, productBackwardTransitions, storm::storage::BitVector(numberOfProductStates, true), targetStates, qualitative, flippedStates, false);
+                    return std::move(productResult.values);
+                };
+
+                // Reaching the almost surely winning states of the coalition yields a lower bound on the value, reaching the ones of the other players an upper bound.
+                // In contrast to MDPs, the bounds do not coincide for all stochastic parity games, as the other players might keep the play outside of both regions
+                // while the parity objective is still satisfied with some probability. We only answer queries for which the bounds coincide.
+                STORM_LOG_INFO("Computing probabilities for reaching almost surely winning states...");
+                std::vector<ValueType> values = product->projectToOriginalModel(numberOfStates, computeReachabilityProbabilities(winningStates, productStatesOfCoalition));
+                std::vector<ValueType> opponentValues = product->projectToOriginalModel(numberOfStates, computeReachabilityProbabilities(opponentWinningStates, ~productStatesOfCoalition));
+                ValueType tolerance = storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType, uint64_t>(2) * storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+                for (auto state : relevantStates) {
+                    ValueType upperBound = storm::utility::one<ValueType>() - opponentValues[state];
+                    STORM_LOG_THROW(storm::utility::abs<ValueType>(upperBound - values[state]) <= tolerance, storm::exceptions::NotSupportedException, "The value of the parity objective at state " << state << " is only known to lie in [" << values[state] << ", " << upperBound << "], as the players can avoid the almost surely winning regions. Quantitative stochastic parity games are not supported.");
+                }
+
+                return SMGSparseModelCheckingHelperReturnType<ValueType>(std::move(values), storm::storage::BitVector(numberOfStates, true), std::unique_ptr<storm::storage::Scheduler<ValueType>>(), std::vector<ValueType>());
+            }
+
+            template <typename ValueType>
+            std::vector<uint64_t> SparseSmgLtlHelper<ValueType>::computePriorities(storm::automata::AcceptanceCondition const& acceptance, uint64_t numberOfStates) {
+                std::vector<uint64_t> priorities(numberOfStates, 0);
+                if (acceptance.getNumberOfAcceptanceSets() == 0) {
+                    // Acceptance conditions without acceptance sets are trivial, so every state gets the same even or odd priority.
+                    auto expression = acceptance.getAcceptanceExpression();
+                    STORM_LOG_THROW(expression->isTRUE() || expression->isFALSE(), storm::exceptions::InvalidOperationException, "Unexpected acceptance condition " << *expression << " without acceptance sets.");
+                    std::fill(priorities.begin(), priorities.end(), expression->isTRUE() ? 0 : 1);
+                    return priorities;
+                }
+
+                // If a state belongs to several sets, only the minimal one is relevant.
+                storm::storage::BitVector assigned(numberOfStates, false);
+                for (unsigned int set = 0; set < acceptance.getNumberOfAcceptanceSets(); ++set) {
+                    for (auto state : acceptance.getAcceptanceSet(set)) {
+                        if (!assigned.get(state)) {
+                            assigned.set(state);
+                            priorities[state] = set;
+                        }
+                    }
+                }
+                STORM_LOG_THROW(assigned.full(), storm::exceptions::InvalidOperationException, "The parity automaton has states that do not belong to any acceptance set.");
+                return priorities;
+            }
+
+            template class SparseSmgLtlHelper<double>;
+#ifdef STORM_HAVE_CARL
+            template class SparseSmgLtlHelper<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+#include "storm/solver/SolveGoal.h"
+#include "storm/models/sparse/Mdp.h"
+
+#include "storm/modelchecker/rpatl/helper/SMGModelCheckingHelperReturnType.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace automata {
+        class AcceptanceCondition;
+        class DeterministicAutomaton;
+    }
+
+    namespace logic {
+        class Formula;
+        class PathFormula;
+    }
+
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Helper class for LTL model checking of stochastic multiplayer games.
+             *
+             * The game is multiplied with a deterministic parity automaton for the formula. The product keeps the row
+             * groups of the game and a product state is owned by the coalition iff its model state is. Then, the states
+             * of the product from which the coalition wins almost surely are computed (see internal::ParityGameHelper)
+             * and the probabilities of reaching them are a lower bound on the values. Reaching the almost surely winning
+             * states of the other players yields an upper bound. Only if both bounds coincide, the values are returned.
+             */
+            template <typename ValueType>
+            class SparseSmgLtlHelper {
+            public:
+                typedef std::function<storm::storage::BitVector(storm::logic::Formula const&)> CheckFormulaCallback;
+                typedef storm::models::sparse::Mdp<ValueType> productModelType;
+
+                /*!
+                 * Computes the LTL probabilities.
+                 *
+                 * @param formula The LTL formula (allowing PCTL*-like nesting).
+                 * @param formulaChecker Lambda that evaluates the state subformulas.
+                 * @param statesOfCoalition The states whose optimization direction is flipped, i.e., the states that are not owned by the coalition.
+                 */
+                static SMGSparseModelCheckingHelperReturnType<ValueType> computeLTLProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::logic::PathFormula const& formula, CheckFormulaCallback const& formulaChecker, bool qualitative, storm::storage::BitVector const& statesOfCoalition);
+
+                /*!
+                 * Computes the maximal probabilities of the coalition that the game satisfies the acceptance condition of the given parity automaton.
+                 *
+                 * @param da The deterministic automaton, which needs to have a state-based "parity min even" acceptance condition in which every state
+                 * belongs to exactly one acceptance set (see LTL2DeterministicAutomaton::ltl2dpaSpot).
+                 * @param apSatSets Maps the atomic propositions of the automaton to the states satisfying them.
+                 * @param relevantStates The states for which the values are computed. The values of other states are undefined.
+                 * @throws NotSupportedException if the value of a relevant state is not determined by the almost surely winning regions of the players.
+                 */
+                static SMGSparseModelCheckingHelperReturnType<ValueType> computeDAProductProbabilities(Environment const& env, storm::automata::DeterministicAutomaton const& da, std::map<std::string, storm::storage::BitVector>& apSatSets, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& relevantStates, bool qualitative, storm::storage::BitVector const& statesOfCoalition);
+
+            private:
+                /*!
+                 * Retrieves for each state the index of the (first) acceptance set it belongs to.
+                 */
+                static std::vector<uint64_t> computePriorities(storm::automata::AcceptanceCondition const& acceptance, uint64_t numberOfStates);
+            };
+        }
+    }
+}
@@ -8,6 +8,10 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ConstantsComparator.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
 
 namespace storm {
@@ -22,43 +26,235 @@ namespace storm {
                 // Relevant states are those states which are phiStates and not PsiStates.
                 storm::storage::BitVector relevantStates = phiStates & ~psiStates;
 
+                // The qualitative analysis of the game yields the states with value zero or one, so only the remaining maybe states are
+                // solved numerically. As the strategies of the players in these states are not computed, it is skipped for schedulers.
+                storm::storage::BitVector maybeStates = relevantStates;
+                storm::storage::BitVector statesWithProbability1 = psiStates;
+                if (!produceScheduler) {
+                    storm::storage::BitVector maximizerStates = storm::solver::maximize(goal.direction()) ? ~statesOfCoalition : statesOfCoalition;
+                    storm::storage::BitVector statesWithProbability0 = computeProb0States(transitionMatrix, backwardTransitions, phiStates, psiStates, maximizerStates);
+                    statesWithProbability1 = computeProb1States(transitionMatrix, backwardTransitions, statesWithProbability0, psiStates, maximizerStates);
+                    maybeStates &= ~(statesWithProbability0 | statesWithProbability1);
+                    STORM_LOG_INFO("Found " << statesWithProbability0.getNumberOfSetBits() << " states with value 0, " << statesWithProbability1.getNumberOfSetBits() << " states with value 1 and " << maybeStates.getNumberOfSetBits() << " maybe states.");
+                }
+
                 // Initialize the x vector and solution vector result.
-                std::vector<ValueType> x = std::vector<ValueType>(relevantStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                std::vector<ValueType> x = std::vector<ValueType>(maybeStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
                 std::vector<ValueType> result = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-                std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, psiStates);
+                std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(maybeStates, statesWithProbability1);
                 std::vector<ValueType> constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
                 std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
 
-                storm::storage::BitVector clippedStatesOfCoalition(relevantStates.getNumberOfSetBits());
-                clippedStatesOfCoalition.setClippedStatesOfCoalition(relevantStates, statesOfCoalition);
+                storm::storage::BitVector clippedStatesOfCoalition(maybeStates.getNumberOfSetBits());
+                clippedStatesOfCoalition.setClippedStatesOfCoalition(maybeStates, statesOfCoalition);
 
-                if(!relevantStates.empty()) {
-                    // Reduce the matrix to relevant states.
-                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, relevantStates, relevantStates, false);
+                if(!maybeStates.empty()) {
+                    // Reduce the matrix to maybe states.
+                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, maybeStates, maybeStates, false);
                     // Create GameViHelper for computations.
                     storm::modelchecker::helper::internal::GameViHelper<ValueType> viHelper(submatrix, clippedStatesOfCoalition);
                     if (produceScheduler) {
                         viHelper.setProduceScheduler(true);
                     }
-                    viHelper.performValueIteration(env, x, b, goal.direction(), constrainedChoiceValues);
-                    if(goal.isShieldingTask()) {
-                        viHelper.getChoiceValues(env, x, constrainedChoiceValues);
+                    if (env.solver().game().getMethod() == storm::solver::GameMethod::PolicyIteration) {
+                        std::vector<uint64_t> optimalChoices;
+                        std::vector<ValueType> values = computeUntilProbabilitiesPolicyIteration(env, goal.direction(), transitionMatrix, phiStates, psiStates, statesOfCoalition, optimalChoices);
+                        x = storm::utility::vector::filterVector(values, maybeStates);
+                        submatrix.multiplyWithVector(x, constrainedChoiceValues, &b);
+
+                        if (produceScheduler) {
+                            storm::storage::Scheduler<ValueType> relevantScheduler(x.size());
+                            uint64_t relevantState = 0;
+                            for (auto state : relevantStates) {
+                                relevantScheduler.setChoice(optimalChoices[state], relevantState);
+                                ++relevantState;
+                            }
+                            scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(std::move(relevantScheduler), psiStates, ~phiStates));
+                        }
+                    } else {
+                        if (isRationalSearchSelected(env)) {
+                            viHelper.performRationalSearch(env, x, b, goal.direction(), constrainedChoiceValues);
+                        } else {
+                            viHelper.performValueIteration(env, x, b, goal.direction(), constrainedChoiceValues);
+                        }
+                        if(goal.isShieldingTask()) {
+                            viHelper.getChoiceValues(env, x, constrainedChoiceValues);
+                        }
+
+                        if (produceScheduler) {
+                            scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(viHelper.extractScheduler(), psiStates, ~phiStates));
+                        }
                     }
 
                     // Fill up the constrainedChoice Values to full size.
-                    viHelper.fillChoiceValuesVector(constrainedChoiceValues, relevantStates, transitionMatrix.getRowGroupIndices());
+                    viHelper.fillChoiceValuesVector(constrainedChoiceValues, maybeStates, transitionMatrix.getRowGroupIndices());
+                }
 
-                    if (produceScheduler) {
-                        scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(viHelper.extractScheduler(), psiStates, ~phiStates));
+                // Fill up the result vector with the values of x for the maybe states, with 1s for states with value 1 (0 is default)
+                storm::utility::vector::setVectorValues(result, maybeStates, x);
+                storm::utility::vector::setVectorValues(result, statesWithProbability1, storm::utility::one<ValueType>());
+
+                // The choices of relevant states that were solved qualitatively get their values from the successors.
+                if (goal.isShieldingTask() && maybeStates != relevantStates) {
+                    constrainedChoiceValues.resize(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                    for (auto state : relevantStates & ~maybeStates) {
+                        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                            constrainedChoiceValues[row] = transitionMatrix.multiplyRowWithVector(row, result);
+                        }
                     }
                 }
-
-                // Fill up the result vector with the values of x for the relevant states, with 1s for psi states (0 is default)
-                storm::utility::vector::setVectorValues(result, relevantStates, x);
-                storm::utility::vector::setVectorValues(result, psiStates, storm::utility::one<ValueType>());
                 return SMGSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(relevantStates), std::move(scheduler), std::move(constrainedChoiceValues));
             }
 
+            template<typename ValueType>
+            storm::storage::BitVector SparseSmgRpatlHelper<ValueType>::computeProb0States(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& maximizerStates) {
+                storm::storage::BitVector allStates(transitionMatrix.getRowGroupCount(), true);
+                return ~computePositiveAttractor(transitionMatrix, backwardTransitions, phiStates & ~psiStates, psiStates, allStates, maximizerStates);
+            }
+
+            template<typename ValueType>
+            storm::storage::BitVector SparseSmgRpatlHelper<ValueType>::computeProb1States(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& statesWithProbability0, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& maximizerStates) {
+                // The maximizer wins almost surely iff it can always reach psi with positive probability without leaving the winning states.
+                // Starting from the states with positive value, the states from which this is impossible are removed until a fixpoint is reached.
+                storm::storage::BitVector winningStates = ~statesWithProbability0;
+                while (true) {
+                    storm::storage::BitVector newWinningStates = computePositiveAttractor(transitionMatrix, backwardTransitions, winningStates & ~psiStates, psiStates, winningStates, maximizerStates);
+                    if (newWinningStates == winningStates) {
+                        return winningStates;
+                    }
+                    winningStates = std::move(newWinningStates);
+                }
+            }
+
+            template<typename ValueType>
+            storm::storage::BitVector SparseSmgRpatlHelper<ValueType>::computePositiveAttractor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& candidateStates, storm::storage::BitVector const& targetStates, storm::storage::BitVector const& safeStates, storm::storage::BitVector const& maximizerStates) {
+                storm::storage::BitVector attractor = targetStates;
+                std::vector<uint64_t> stack;
+                for (auto state : targetStates) {
+                    stack.push_back(state);
+                }
+                auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+                // A choice is attracted if it stays in the safe states and reaches the attractor with positive probability.
+                auto isAttractedChoice = [&](uint64_t row) {
+                    bool reachesAttractor = false;
+                    for (auto const& entry : transitionMatrix.getRow(row)) {
+                        if (storm::utility::isZero(entry.getValue())) {
+                            continue;
+                        }
+                        if (!safeStates.get(entry.getColumn())) {
+                            return false;
+                        }
+                        reachesAttractor |= attractor.get(entry.getColumn());
+                    }
+                    return reachesAttractor;
+                };
+
+                // A state is only (re-)checked once one of its successors was attracted.
+                while (!stack.empty()) {
+                    uint64_t state = stack.back();
+                    stack.pop_back();
+                    for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                        uint64_t predecessor = predecessorEntry.getColumn();
+                        if (attractor.get(predecessor) || !candidateStates.get(predecessor)) {
+                            continue;
+                        }
+                        // The maximizer needs some attracted choice whereas all choices of the minimizer have to be attracted.
+                        bool isMaximizerState = maximizerStates.get(predecessor);
+                        bool attracted = !isMaximizerState;
+                        for (uint64_t row = rowGroupIndices[predecessor]; row < rowGroupIndices[predecessor + 1]; ++row) {
+                            if (isAttractedChoice(row) == isMaximizerState) {
+                                attracted = isMaximizerState;
+                                break;
+                            }
+                        }
+                        if (attracted) {
+                            attractor.set(predecessor);
+                            stack.push_back(predecessor);
+                        }
+                    }
+                }
+                return attractor;
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> SparseSmgRpatlHelper<ValueType>::computeUntilProbabilitiesPolicyIteration(Environment const& env, storm::solver::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesOfCoalition, std::vector<uint64_t>& choices) {
+                auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+                // The direction of the states in statesOfCoalition is flipped, so we can derive which states are maximizing.
+                // Only the strategy of the maximizer is iterated: Starting from an arbitrary strategy, the maximizer only switches to strictly
+                // better choices. Hence, its values never decrease and once no choice improves, they are a fixpoint of the game's Bellman operator.
+                storm::storage::BitVector maximizerStates = storm::solver::maximize(dir) ? ~statesOfCoalition : statesOfCoalition;
+                maximizerStates &= phiStates & ~psiStates;
+
+                storm::utility::ConstantsComparator<ValueType> comparator(storm::NumberTraits<ValueType>::IsExact ? storm::utility::zero<ValueType>() : storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), false);
+                choices = std::vector<uint64_t>(transitionMatrix.getRowGroupCount(), 0);
+                std::vector<ValueType> values;
+                std::vector<ValueType> choiceValues(transitionMatrix.getRowCount());
+                uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+                uint64_t iterations = 0;
+                bool strategyImproved = true;
+                while (strategyImproved && iterations < maxIter) {
+                    ++iterations;
+
+                    // Fixing the choices of the maximizer yields an MDP in which the minimizer optimizes.
+                    storm::storage::BitVector selectedRows(transitionMatrix.getRowCount(), true);
+                    for (auto state : maximizerStates) {
+                        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                            selectedRows.set(row, row == rowGroupIndices[state] + choices[state]);
+                        }
+                    }
+                    storm::storage::SparseMatrix<ValueType> inducedMatrix = transitionMatrix.restrictRows(selectedRows);
+                    auto mdpResult = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(storm::solver::OptimizationDirection::Minimize), inducedMatrix, inducedMatrix.transpose(true), phiStates, psiStates, false, false);
+                    values = std::move(mdpResult.values);
+
+                    // Improve the strategy of the maximizer.
+                    transitionMatrix.multiplyWithVector(values, choiceValues);
+                    strategyImproved = false;
+                    for (auto state : maximizerStates) {
+                        uint64_t firstRow = rowGroupIndices[state];
+                        ValueType currentValue = choiceValues[firstRow + choices[state]];
+                        for (uint64_t row = firstRow; row < rowGroupIndices[state + 1]; ++row) {
+                            if (comparator.isLess(currentValue, choiceValues[row])) {
+                                choices[state] = row - firstRow;
+                                currentValue = choiceValues[row];
+                                strategyImproved = true;
+                            }
+                        }
+                    }
+
+                    if (storm::utility::resources::isTerminate()) {
+                        break;
+                    }
+                }
+                STORM_LOG_WARN_COND(!strategyImproved, "Policy iteration for rPATL did not converge within " << iterations << " iterations.");
+                STORM_LOG_INFO("Policy iteration for rPATL terminated after " << iterations << " iterations.");
+
+                // The choices of the minimizer are the optimal choices of the final MDP.
+                for (auto state : phiStates & ~psiStates & ~maximizerStates) {
+                    uint64_t firstRow = rowGroupIndices[state];
+                    for (uint64_t row = firstRow + 1; row < rowGroupIndices[state + 1]; ++row) {
+                        if (choiceValues[row] < choiceValues[firstRow + choices[state]]) {
+                            choices[state] = row - firstRow;
+                        }
+                    }
+                }
+                return values;
+            }
+
+            template<typename ValueType>
+            bool SparseSmgRpatlHelper<ValueType>::isRationalSearchSelected(Environment const& env) {
+                if (env.solver().game().getMethod() == storm::solver::GameMethod::RationalSearch) {
+                    return true;
+                }
+                if ((storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact()) && env.solver().game().isMethodSetFromDefault()) {
+                    STORM_LOG_INFO("Using rational search to obtain exact results. If you want to override this, specify another game method.");
+                    return true;
+                }
+                return false;
+            }
+
             template<typename ValueType>
             storm::storage::Scheduler<ValueType> SparseSmgRpatlHelper<ValueType>::expandScheduler(storm::storage::Scheduler<ValueType> scheduler, storm::storage::BitVector psiStates, storm::storage::BitVector notPhiStates) {
                 storm::storage::Scheduler<ValueType> completeScheduler(psiStates.size());
@@ -39,7 +39,45 @@ namespace storm {
                 static SMGSparseModelCheckingHelperReturnType<ValueType> computeNextProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::BitVector statesOfCoalition, bool produceScheduler, ModelCheckerHint const& hint);
                 static SMGSparseModelCheckingHelperReturnType<ValueType> computeBoundedGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::BitVector statesOfCoalition, bool produceScheduler, ModelCheckerHint const& hint, uint64_t lowerBound, uint64_t upperBound);
                 static SMGSparseModelCheckingHelperReturnType<ValueType> computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::BitVector statesOfCoalition, bool produceScheduler, ModelCheckerHint const& hint, uint64_t lowerBound, uint64_t upperBound, bool computeBoundedGlobally = false);
+
+                /*!
+                 * Computes the states from which the maximizing player can not reach psi via phi states with positive probability,
+                 * i.e., the states with value 0.
+                 *
+                 * @param maximizerStates The states in which the maximizing player chooses.
+                 */
+                static storm::storage::BitVector computeProb0States(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& maximizerStates);
+
+                /*!
+                 * Computes the states from which the maximizing player reaches psi via phi states almost surely, i.e., the states with value 1.
+                 *
+                 * @param statesWithProbability0 The states with value 0 (see computeProb0States).
+                 * @param maximizerStates The states in which the maximizing player chooses.
+                 */
+                static storm::storage::BitVector computeProb1States(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& statesWithProbability0, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& maximizerStates);
+
+                /*!
+                 * Computes the target states together with the candidate states from which the maximizing player can enforce to reach the target
+                 * states with positive probability without leaving the safe states.
+                 */
+                static storm::storage::BitVector computePositiveAttractor(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& candidateStates, storm::storage::BitVector const& targetStates, storm::storage::BitVector const& safeStates, storm::storage::BitVector const& maximizerStates);
+
             private:
+                /*!
+                 * Retrieves whether unbounded reachability games are solved by rational search, which is the case if it was selected
+                 * explicitly or if exact results are required and no game method was selected.
+                 */
+                static bool isRationalSearchSelected(Environment const& env);
+
+                /*!
+                 * Computes the until probabilities for all states by policy iteration over the strategies of the maximizing player. For a fixed
+                 * strategy, the values are obtained by solving the induced MDP of the minimizing player with the configured MinMax solver.
+                 *
+                 * @param statesOfCoalition The states whose optimization direction is inverted w.r.t. dir.
+                 * @param choices Is set to optimal (local) choices for all states.
+                 */
+                static std::vector<ValueType> computeUntilProbabilitiesPolicyIteration(Environment const& env, storm::solver::OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesOfCoalition, std::vector<uint64_t>& choices);
+
                 static storm::storage::Scheduler<ValueType> expandScheduler(storm::storage::Scheduler<ValueType> scheduler, storm::storage::BitVector psiStates, storm::storage::BitVector notPhiStates);
                 static void expandChoiceValues(std::vector<uint_fast64_t> const& rowGroupIndices, storm::storage::BitVector const& relevantStates, std::vector<ValueType> const& constrainedChoiceValues, std::vector<ValueType>& choiceValues);
             };
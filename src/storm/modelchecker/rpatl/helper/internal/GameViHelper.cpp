@@ -4,15 +4,130 @@
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 
+#include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/solver/helper/MixedPrecisionValueIterationHelper.h"
+
+#include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/vector.h"
 
+#include <cmath>
+#include <numeric>
+
 namespace storm {
     namespace modelchecker {
         namespace helper {
             namespace internal {
 
+                namespace {
+                    // Below this precision, value iteration with doubles is not expected to provide further digits.
+                    double const minimalImprecisePrecision = 1e-14;
+
+                    bool isMaximizingState(storm::solver::OptimizationDirection dir, storm::storage::BitVector const& statesOfCoalition, uint64_t state) {
+                        // The direction of the states of the coalition bitvector is flipped (cf. the dirOverride of the multiplier).
+                        return statesOfCoalition.get(state) ? dir == storm::solver::OptimizationDirection::Minimize : dir == storm::solver::OptimizationDirection::Maximize;
+                    }
+
+                    /*!
+                     * Checks whether the given values are the values of the reachability game given by the matrix and the one-step target
+                     * probabilities b. This is the case if
+                     * (1) the values are a fixpoint of the Bellman operator of the game, so they are at least the least fixpoint, i.e. the
+                     *     values of the game, and
+                     * (2) the values are zero for all states from which the minimizer can avoid the target forever if the maximizer only
+                     *     uses choices that are optimal w.r.t. the values. Then, the values are the unique solution of the minimizer's MDP
+                     *     that is induced by some optimal (attractor) strategy of the maximizer, so they are at most the values of the game.
+                     *
+                     * @param backwardTransitions The transposed matrix, which is passed as it is the same for all candidates.
+                     */
+                    bool isSolutionOfGame(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& b, storm::storage::BitVector const& statesOfCoalition, storm::solver::OptimizationDirection dir, std::vector<storm::RationalNumber> const& values) {
+                        auto const& rowGroupIndices = matrix.getRowGroupIndices();
+                        uint64_t numberOfStates = matrix.getRowGroupCount();
+
+                        // Check (1) and collect the choices each player may use to keep the play away from the target.
+                        storm::storage::BitVector allowedRows(matrix.getRowCount(), false);
+                        std::vector<storm::RationalNumber> rowValues(matrix.getRowCount());
+                        for (uint64_t state = 0; state < numberOfStates; ++state) {
+                            bool maximize = isMaximizingState(dir, statesOfCoalition, state);
+                            storm::RationalNumber optimalValue;
+                            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                                rowValues[row] = b[row] + matrix.multiplyRowWithVector(row, values);
+                                if (row == rowGroupIndices[state] || (maximize ? rowValues[row] > optimalValue : rowValues[row] < optimalValue)) {
+                                    optimalValue = rowValues[row];
+                                }
+                            }
+                            if (optimalValue != values[state]) {
+                                return false;
+                            }
+                            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                                if (!maximize || rowValues[row] == optimalValue) {
+                                    allowedRows.set(row);
+                                }
+                            }
+                        }
+
+                        // Compute the states from which the minimizer can avoid the target forever (as a greatest fixpoint). Initially, we assume
+                        // this for all states and then remove states until all remaining states satisfy the condition.
+                        auto canAvoidTarget = [&] (uint64_t row, storm::storage::BitVector const& avoidingStates) {
+                            if (!storm::utility::isZero(b[row])) {
+                                return false;
+                            }
+                            for (auto const& entry : matrix.getRow(row)) {
+                                if (!storm::utility::isZero(entry.getValue()) && !avoidingStates.get(entry.getColumn())) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        };
+                        storm::storage::BitVector avoidingStates(numberOfStates, true);
+                        std::vector<uint64_t> stack(numberOfStates);
+                        std::iota(stack.begin(), stack.end(), 0);
+                        storm::storage::BitVector onStack(numberOfStates, true);
+                        while (!stack.empty()) {
+                            uint64_t state = stack.back();
+                            stack.pop_back();
+                            onStack.set(state, false);
+                            if (!avoidingStates.get(state)) {
+                                continue;
+                            }
+                            // The maximizer is restricted to its optimal choices and the minimizer may pick any choice.
+                            bool maximize = isMaximizingState(dir, statesOfCoalition, state);
+                            bool avoiding = maximize;
+                            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                                if (!allowedRows.get(row)) {
+                                    continue;
+                                }
+                                bool rowAvoids = canAvoidTarget(row, avoidingStates);
+                                if (maximize && !rowAvoids) {
+                                    avoiding = false;
+                                    break;
+                                } else if (!maximize && rowAvoids) {
+                                    avoiding = true;
+                                    break;
+                                }
+                            }
+                            if (!avoiding) {
+                                avoidingStates.set(state, false);
+                                for (auto const& predecessorEntry : backwardTransitions.getRow(state)) {
+                                    uint64_t predecessor = predecessorEntry.getColumn();
+                                    if (avoidingStates.get(predecessor) && !onStack.get(predecessor)) {
+                                        stack.push_back(predecessor);
+                                        onStack.set(predecessor, true);
+                                    }
+                                }
+                            }
+                        }
+
+                        // Check (2).
+                        for (auto state : avoidingStates) {
+                            if (!storm::utility::isZero(values[state])) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                }
+
                 template <typename ValueType>
                 GameViHelper<ValueType>::GameViHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector statesOfCoalition) : _transitionMatrix(transitionMatrix), _statesOfCoalition(statesOfCoalition) {
                     // Intentionally left empty.
@@ -25,12 +140,17 @@ namespace storm {
                 }
 
                 template <typename ValueType>
-                void GameViHelper<ValueType>::performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
+                uint64_t GameViHelper<ValueType>::performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
                     prepareSolversAndMultipliers(env);
                     // Get precision for convergence check.
                     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
                     uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
                     _b = b;
+
+                    if (storm::solver::helper::MixedPrecisionValueIterationHelper<ValueType>::isMixedPrecisionSelected(env.solver().game().getValuePrecision(), env.solver().getMemoryBudget(), _transitionMatrix, 2)) {
+                        return performMixedPrecisionValueIteration(env, x, dir, constrainedChoiceValues);
+                    }
+
                     //_x1.assign(_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                     _x1 = x;
                     _x2 = _x1;
@@ -69,6 +189,90 @@ namespace storm {
                         // We will be doing one more iteration step and track scheduler choices this time.
                         performIterationStep(env, dir, &_producedOptimalChoices.get());
                     }
+                    return iter;
+                }
+
+                template <typename ValueType>
+                uint64_t GameViHelper<ValueType>::performMixedPrecisionValueIteration(Environment const& env, std::vector<ValueType>& x, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
+                    // The helper works in place on x, so the iterates _x1 and _x2 are not needed.
+                    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+                    storm::solver::helper::MixedPrecisionValueIterationHelper<ValueType> mixedPrecisionHelper(_transitionMatrix);
+                    auto statusIters = mixedPrecisionHelper.solveEquations(x, _b, dir, precision, env.solver().game().getRelativeTerminationCriterion(), env.solver().game().getMaximalNumberOfIterations(), &_statesOfCoalition);
+                    STORM_LOG_WARN_COND(statusIters.first == storm::solver::SolverStatus::Converged, "Mixed-precision value iteration did not converge after " << statusIters.second << " iterations.");
+
+                    constrainedChoiceValues = std::vector<ValueType>(_b.size(), storm::utility::zero<ValueType>());
+                    _multiplier->multiply(env, x, &_b, constrainedChoiceValues);
+                    if (isProduceSchedulerSet()) {
+                        if (!this->_producedOptimalChoices.is_initialized()) {
+                            this->_producedOptimalChoices.emplace();
+                        }
+                        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                        std::vector<ValueType> choiceX(x.size());
+                        _multiplier->multiplyAndReduce(env, dir, x, &_b, choiceX, &_producedOptimalChoices.get(), &_statesOfCoalition);
+                    }
+                    return statusIters.second;
+                }
+
+                template <typename ValueType>
+                void GameViHelper<ValueType>::performRationalSearch(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
+                    // Value iteration is performed with doubles, the candidate solutions are checked with rational numbers.
+                    GameViHelper<double> impreciseHelper(_transitionMatrix.template toValueType<double>(), _statesOfCoalition);
+                    std::vector<double> impreciseX = storm::utility::vector::convertNumericVector<double>(x);
+                    std::vector<double> impreciseB = storm::utility::vector::convertNumericVector<double>(b);
+                    std::vector<double> impreciseChoiceValues;
+                    storm::storage::SparseMatrix<storm::RationalNumber> rationalMatrix = _transitionMatrix.template toValueType<storm::RationalNumber>();
+                    storm::storage::SparseMatrix<storm::RationalNumber> rationalBackwardTransitions = rationalMatrix.transpose(true);
+                    std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
+                    std::vector<storm::RationalNumber> rationalX(x.size());
+
+                    Environment impreciseEnv = env;
+                    double precision = storm::utility::convertNumber<double>(env.solver().game().getPrecision());
+                    uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
+                    uint64_t overallIterations = 0;
+                    uint64_t valueIterationInvocations = 0;
+                    bool foundSolution = false;
+                    while (!foundSolution && overallIterations < maxIter && precision >= minimalImprecisePrecision) {
+                        // Perform value iteration with the current precision, starting from the previous result.
+                        impreciseEnv.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(precision));
+                        impreciseEnv.solver().game().setMaximalNumberOfIterations(maxIter - overallIterations);
+                        overallIterations += impreciseHelper.performValueIteration(impreciseEnv, impreciseX, impreciseB, dir, impreciseChoiceValues);
+                        ++valueIterationInvocations;
+
+                        // Sharpen the result up to the current precision and check whether we obtained the solution.
+                        uint64_t maximalSharpeningPrecision = static_cast<uint64_t>(std::ceil(std::log10(1.0 / precision)));
+                        for (uint64_t sharpeningPrecision = 0; sharpeningPrecision <= maximalSharpeningPrecision && !foundSolution; ++sharpeningPrecision) {
+                            storm::utility::kwek_mehlhorn::sharpen(sharpeningPrecision, impreciseX, rationalX);
+                            foundSolution = isSolutionOfGame(rationalMatrix, rationalBackwardTransitions, rationalB, _statesOfCoalition, dir, rationalX);
+                        }
+                        precision /= 10.0;
+
+                        if (storm::utility::resources::isTerminate()) {
+                            break;
+                        }
+                    }
+
+                    if (!foundSolution) {
+                        STORM_LOG_WARN("Rational search did not find the exact solution after " << valueIterationInvocations << " value iteration invocations (" << overallIterations << " iterations). Falling back to value iteration.");
+                        performValueIteration(env, x, b, dir, constrainedChoiceValues);
+                        return;
+                    }
+                    STORM_LOG_INFO("Rational search found the exact solution after " << valueIterationInvocations << " value iteration invocations (" << overallIterations << " iterations).");
+                    x = storm::utility::vector::convertNumericVector<ValueType>(rationalX);
+
+                    // Compute the choice values (and the scheduler) for the solution.
+                    prepareSolversAndMultipliers(env);
+                    _b = b;
+                    _x1 = x;
+                    _x2 = x;
+                    constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
+                    _multiplier->multiply(env, x, &_b, constrainedChoiceValues);
+                    if (isProduceSchedulerSet()) {
+                        if (!this->_producedOptimalChoices.is_initialized()) {
+                            this->_producedOptimalChoices.emplace();
+                        }
+                        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                        performIterationStep(env, dir, &_producedOptimalChoices.get());
+                    }
                 }
 
                 template <typename ValueType>
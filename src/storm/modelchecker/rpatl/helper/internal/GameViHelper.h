@@ -25,8 +25,18 @@ namespace storm {
 
                     /*!
                      * Perform value iteration until convergence
+                     *
+                     * @return the number of performed iterations.
                      */
-                    void performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
+                    uint64_t performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
+
+                    /*!
+                     * Solves the game by rational search: value iteration is performed in double precision, the result is sharpened to
+                     * rational numbers and accepted once these are certified to be the value of the game. If the precision of doubles
+                     * does not suffice, value iteration is performed in ValueType instead.
+                     * Requires that b holds the probabilities to reach the target in one step, i.e., the game is a reachability game.
+                     */
+                    void performRationalSearch(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
 
                     /*!
                      * Sets whether an optimal scheduler shall be constructed during the computation
@@ -68,6 +78,13 @@ namespace storm {
                     void fillChoiceValuesVector(std::vector<ValueType>& choiceValues, storm::storage::BitVector psiStates, std::vector<storm::storage::SparseMatrix<double>::index_type> rowGroupIndices);
 
                 private:
+                    /*!
+                     * Performs value iteration in mixed precision (see MixedPrecisionValueIterationHelper) on x in place.
+                     *
+                     * @return the number of performed iterations.
+                     */
+                    uint64_t performMixedPrecisionValueIteration(Environment const& env, std::vector<ValueType>& x, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
+
                     /*!
                      * Performs one iteration step for value iteration
                      */
@@ -0,0 +1,192 @@
+#include "storm/modelchecker/rpatl/helper/internal/ParityGameHelper.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            namespace internal {
+
+                template <typename ValueType>
+                ParityGameHelper<ValueType>::ParityGameHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& coalitionStates, std::vector<uint64_t> const& priorities) : numberOfStates(transitionMatrix.getRowGroupCount()) {
+                    STORM_LOG_ASSERT(priorities.size() == numberOfStates, "Unexpected number of priorities.");
+                    // The first vertices are the states of the game, the vertices of the gadgets are appended.
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        addVertex(coalitionStates.get(state) ? Even : Odd, priorities[state]);
+                    }
+
+                    std::vector<std::pair<uint64_t, uint64_t>> edges;
+                    std::vector<uint64_t> rowSuccessors;
+                    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        // The gadgets inherit the priority of the state, so they do not influence the minimal priority that occurs infinitely often.
+                        uint64_t const priority = priorities[state];
+                        for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                            rowSuccessors.clear();
+                            for (auto const& entry : transitionMatrix.getRow(row)) {
+                                if (!storm::utility::isZero(entry.getValue())) {
+                                    rowSuccessors.push_back(entry.getColumn());
+                                }
+                            }
+                            STORM_LOG_THROW(!rowSuccessors.empty(), storm::exceptions::InvalidArgumentException, "The choice " << row << " of state " << state << " has no successor.");
+                            if (rowSuccessors.size() == 1) {
+                                edges.emplace_back(state, rowSuccessors.front());
+                                continue;
+                            }
+
+                            // The opponent picks some k, then the coalition decides whether it resolves the random choice itself
+                            // at the odd priority 2k-1 or leaves it to the opponent at the even priority 2k.
+                            uint64_t randomVertex = addVertex(Odd, priority);
+                            edges.emplace_back(state, randomVertex);
+                            for (uint64_t k = 0; k <= (priority + 1) / 2; ++k) {
+                                uint64_t choiceVertex = addVertex(Even, priority);
+                                edges.emplace_back(randomVertex, choiceVertex);
+                                for (uint64_t resolvingPriority = (k == 0 ? 0 : 2 * k - 1); resolvingPriority <= 2 * k; ++resolvingPriority) {
+                                    uint64_t resolvingVertex = addVertex(resolvingPriority % 2 == 1 ? Even : Odd, resolvingPriority);
+                                    edges.emplace_back(choiceVertex, resolvingVertex);
+                                    for (auto successor : rowSuccessors) {
+                                        edges.emplace_back(resolvingVertex, successor);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    // Store the edges in compressed row format.
+                    uint64_t const numberOfVertices = owners.size();
+                    successorIndications.assign(numberOfVertices + 1, 0);
+                    predecessorIndications.assign(numberOfVertices + 1, 0);
+                    for (auto const& edge : edges) {
+                        ++successorIndications[edge.first + 1];
+                        ++predecessorIndications[edge.second + 1];
+                    }
+                    std::partial_sum(successorIndications.begin(), successorIndications.end(), successorIndications.begin());
+                    std::partial_sum(predecessorIndications.begin(), predecessorIndications.end(), predecessorIndications.begin());
+                    successors.resize(edges.size());
+                    predecessors.resize(edges.size());
+                    std::vector<uint64_t> nextSuccessor(successorIndications.begin(), successorIndications.end() - 1);
+                    std::vector<uint64_t> nextPredecessor(predecessorIndications.begin(), predecessorIndications.end() - 1);
+                    for (auto const& edge : edges) {
+                        successors[nextSuccessor[edge.first]++] = edge.second;
+                        predecessors[nextPredecessor[edge.second]++] = edge.first;
+                    }
+                    STORM_LOG_INFO("The parity game has " << numberOfVertices << " vertices (" << numberOfStates << " states) and " << edges.size() << " edges.");
+                }
+
+                template <typename ValueType>
+                storm::storage::BitVector ParityGameHelper<ValueType>::computeAlmostSureWinningStates() const {
+                    std::vector<storm::storage::BitVector> winningRegions = solve(storm::storage::BitVector(getNumberOfVertices(), true));
+                    storm::storage::BitVector result(numberOfStates, false);
+                    for (auto vertex : winningRegions[Even]) {
+                        if (vertex >= numberOfStates) {
+                            break;
+                        }
+                        result.set(vertex);
+                    }
+                    return result;
+                }
+
+                template <typename ValueType>
+                uint64_t ParityGameHelper<ValueType>::getNumberOfVertices() const {
+                    return owners.size();
+                }
+
+                template <typename ValueType>
+                typename ParityGameHelper<ValueType>::Player ParityGameHelper<ValueType>::opponent(Player player) {
+                    return player == Even ? Odd : Even;
+                }
+
+                template <typename ValueType>
+                uint64_t ParityGameHelper<ValueType>::addVertex(Player owner, uint64_t priority) {
+                    owners.push_back(owner);
+                    vertexPriorities.push_back(priority);
+                    return owners.size() - 1;
+                }
+
+                template <typename ValueType>
+                std::vector<storm::storage::BitVector> ParityGameHelper<ValueType>::solve(storm::storage::BitVector subgame) const {
+                    std::vector<storm::storage::BitVector> winningRegions(2, storm::storage::BitVector(getNumberOfVertices(), false));
+                    // The second recursive call of Zielonka's algorithm is a tail call, so it is performed by the loop.
+                    while (!subgame.empty()) {
+                        uint64_t minimalPriority = std::numeric_limits<uint64_t>::max();
+                        for (auto vertex : subgame) {
+                            minimalPriority = std::min(minimalPriority, vertexPriorities[vertex]);
+                        }
+                        Player player = minimalPriority % 2 == 0 ? Even : Odd;
+                        storm::storage::BitVector minimalPriorityVertices(getNumberOfVertices(), false);
+                        for (auto vertex : subgame) {
+                            if (vertexPriorities[vertex] == minimalPriority) {
+                                minimalPriorityVertices.set(vertex);
+                            }
+                        }
+
+                        storm::storage::BitVector attractor = computeAttractor(subgame, minimalPriorityVertices, player);
+                        std::vector<storm::storage::BitVector> subWinningRegions = solve(subgame & ~attractor);
+                        storm::storage::BitVector const& opponentRegion = subWinningRegions[opponent(player)];
+                        if (opponentRegion.empty()) {
+                            winningRegions[player] |= subgame;
+                            break;
+                        }
+                        storm::storage::BitVector opponentAttractor = computeAttractor(subgame, opponentRegion, opponent(player));
+                        winningRegions[opponent(player)] |= opponentAttractor;
+                        subgame &= ~opponentAttractor;
+                    }
+                    return winningRegions;
+                }
+
+                template <typename ValueType>
+                storm::storage::BitVector ParityGameHelper<ValueType>::computeAttractor(storm::storage::BitVector const& subgame, storm::storage::BitVector const& target, Player player) const {
+                    storm::storage::BitVector attractor = target & subgame;
+                    std::vector<uint64_t> stack;
+                    for (auto vertex : attractor) {
+                        stack.push_back(vertex);
+                    }
+
+                    // For the vertices of the opponent, we count the successors within the subgame that are not yet attracted.
+                    storm::storage::BitVector counted(getNumberOfVertices(), false);
+                    std::vector<uint64_t> remainingSuccessors(getNumberOfVertices(), 0);
+                    while (!stack.empty()) {
+                        uint64_t vertex = stack.back();
+                        stack.pop_back();
+                        for (uint64_t index = predecessorIndications[vertex]; index < predecessorIndications[vertex + 1]; ++index) {
+                            uint64_t predecessor = predecessors[index];
+                            if (!subgame.get(predecessor) || attractor.get(predecessor)) {
+                                continue;
+                            }
+                            if (owners[predecessor] != player) {
+                                if (!counted.get(predecessor)) {
+                                    counted.set(predecessor);
+                                    for (uint64_t successorIndex = successorIndications[predecessor]; successorIndex < successorIndications[predecessor + 1]; ++successorIndex) {
+                                        if (subgame.get(successors[successorIndex])) {
+                                            ++remainingSuccessors[predecessor];
+                                        }
+                                    }
+                                }
+                                if (--remainingSuccessors[predecessor] > 0) {
+                                    continue;
+                                }
+                            }
+                            attractor.set(predecessor);
+                            stack.push_back(predecessor);
+                        }
+                    }
+                    return attractor;
+                }
+
+                template class ParityGameHelper<double>;
+#ifdef STORM_HAVE_CARL
+                template class ParityGameHelper<storm::RationalNumber>;
+#endif
+            }
+        }
+    }
+}
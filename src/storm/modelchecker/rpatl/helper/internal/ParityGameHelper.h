@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+            namespace internal {
+
+                /*!
+                 * Computes the states of a stochastic game from which the coalition wins a parity objective almost surely.
+                 *
+                 * The priorities are interpreted as "parity min even", i.e., a play is winning for the coalition iff the
+                 * minimal priority occurring infinitely often is even. Every choice with more than one successor is a random
+                 * vertex. Following Chatterjee, Jurdziński and Henzinger (Quantitative stochastic parity games, SODA 2004),
+                 * the random vertices are replaced by small gadgets such that the almost-sure winning states of the
+                 * coalition coincide with the winning states of the resulting (non-stochastic) two-player parity game. The
+                 * latter is solved with Zielonka's recursive algorithm.
+                 */
+                template <typename ValueType>
+                class ParityGameHelper {
+                public:
+                    /*!
+                     * @param transitionMatrix The transition matrix of the game.
+                     * @param coalitionStates The states that are owned by the coalition.
+                     * @param priorities The priority of each state.
+                     */
+                    ParityGameHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& coalitionStates, std::vector<uint64_t> const& priorities);
+
+                    /*!
+                     * @return the states from which the coalition has a strategy to win almost surely, regardless of the strategy of the other players.
+                     */
+                    storm::storage::BitVector computeAlmostSureWinningStates() const;
+
+                    /*!
+                     * @return the number of vertices of the two-player game (including the vertices of the gadgets).
+                     */
+                    uint64_t getNumberOfVertices() const;
+
+                private:
+                    enum Player { Even = 0, Odd = 1 };
+
+                    static Player opponent(Player player);
+
+                    uint64_t addVertex(Player owner, uint64_t priority);
+
+                    /*!
+                     * Computes the winning regions of both players in the subgame induced by the given vertices.
+                     * The subgame needs to be a trap for one of the players, i.e., every vertex has a successor in the subgame.
+                     */
+                    std::vector<storm::storage::BitVector> solve(storm::storage::BitVector subgame) const;
+
+                    /*!
+                     * Computes the vertices of the subgame from which the given player can force a visit to the target vertices.
+                     */
+                    storm::storage::BitVector computeAttractor(storm::storage::BitVector const& subgame, storm::storage::BitVector const& target, Player player) const;
+
+                    uint64_t numberOfStates;
+
+                    std::vector<Player> owners;
+                    std::vector<uint64_t> vertexPriorities;
+
+                    // The edges of the game, stored both forward and backward in compressed row format.
+                    std::vector<uint64_t> successorIndications;
+                    std::vector<uint64_t> successors;
+                    std::vector<uint64_t> predecessorIndications;
+                    std::vector<uint64_t> predecessors;
+                };
+            }
+        }
+    }
+}
@@ -47,6 +47,11 @@ namespace storm {
                 return findIt->second;
             }
 
+            template <typename ValueType, typename RewardModelType>
+            std::map<std::string, storm::storage::PlayerIndex> const& Smg<ValueType, RewardModelType>::getPlayerNameToIndexMap() const {
+                return playerNameToIndexMap;
+            }
+
             template <typename ValueType, typename RewardModelType>
             storm::storage::BitVector Smg<ValueType, RewardModelType>::computeStatesOfCoalition(storm::logic::PlayerCoalition const& coalition) const {
                 // Create a set and a bit vector encoding the coalition for faster access
@@ -33,6 +33,7 @@ namespace storm {
                 std::vector<storm::storage::PlayerIndex> const& getStatePlayerIndications() const;
                 storm::storage::PlayerIndex getPlayerOfState(uint64_t stateIndex) const;
                 storm::storage::PlayerIndex getPlayerIndex(std::string const& playerName) const;
+                std::map<std::string, storm::storage::PlayerIndex> const& getPlayerNameToIndexMap() const;
                 storm::storage::BitVector computeStatesOfCoalition(storm::logic::PlayerCoalition const& coalition) const;
 
             private:
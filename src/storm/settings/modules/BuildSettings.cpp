@@ -9,6 +9,8 @@
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
 
+#include <boost/algorithm/string.hpp>
+
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 
@@ -37,6 +39,9 @@ namespace storm {
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string noSimplifyOptionName = "no-simplify";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string symmetricModulesOptionName = "symmetric-modules";
+            const std::string partialOrderReductionOptionName = "partial-order-reduction";
+            const std::string partialOrderReductionOptionShortName = "por";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -59,6 +64,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, noSimplifyOptionName, false, "If set, simplification PRISM input is disabled.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetricModulesOptionName, false, "Declares groups of symmetric modules (or players) of a PRISM program. States that only differ by a permutation of the modules within a group are identified. Labels, rewards and properties that are not invariant under these permutations are rejected.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("groups", "The groups separated by ';', each consisting of the names of the modules (or players) separated by ','.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false, "If set, the exploration of PRISM MDPs and SMGs skips interleavings of independent, invisible commands (if the properties allow it).").setShortName(partialOrderReductionOptionShortName).setIsAdvanced().build());
             }
 
             bool BuildSettings::isExplorationOrderSet() const {
@@ -135,6 +143,25 @@ namespace storm {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            bool BuildSettings::isSymmetricModulesSet() const {
+                return this->getOption(symmetricModulesOptionName).getHasOptionBeenSet();
+            }
+
+            std::vector<std::vector<std::string>> BuildSettings::getSymmetricModules() const {
+                std::vector<std::string> groups;
+                std::string groupsAsString = this->getOption(symmetricModulesOptionName).getArgumentByName("groups").getValueAsString();
+                boost::split(groups, groupsAsString, boost::is_any_of(";"));
+                std::vector<std::vector<std::string>> result;
+                for (auto const& group : groups) {
+                    result.push_back(storm::parser::parseCommaSeperatedValues(group));
+                }
+                return result;
+            }
+
+            bool BuildSettings::isPartialOrderReductionSet() const {
+                return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+            }
+
         }
 
 
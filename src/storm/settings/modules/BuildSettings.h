@@ -121,6 +121,21 @@ namespace storm {
                  */
                  bool isNoSimplifySet() const;
 
+                /*!
+                 * Retrieves whether groups of symmetric modules were declared.
+                 */
+                bool isSymmetricModulesSet() const;
+
+                /*!
+                 * Retrieves the declared groups of symmetric modules (or players).
+                 */
+                std::vector<std::vector<std::string>> getSymmetricModules() const;
+
+                /*!
+                 * Retrieves whether partial-order reduction is to be applied during exploration.
+                 */
+                bool isPartialOrderReductionSet() const;
+
                 // The name of the module.
                 static const std::string moduleName;
             };
@@ -136,6 +136,10 @@ namespace storm {
                 return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
             }
 
+            std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideIntelTbbSet(bool stateToSet) {
+                return this->overrideOption(intelTbbOptionName, stateToSet);
+            }
+
             bool CoreSettings::isUseCudaSet() const {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
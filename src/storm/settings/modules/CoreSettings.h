@@ -103,6 +103,15 @@ namespace storm {
                  */
                 bool isUseIntelTbbSet() const;
 
+                /*!
+                 * Overrides the option to use Intel TBB by setting it to the specified value. As soon as the returned
+                 * memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option to use Intel TBB.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideIntelTbbSet(bool stateToSet);
+
                 /*!
                  * Retrieves whether the option to use CUDA is set.
                  *
@@ -17,9 +17,10 @@ namespace storm {
             const std::string GameSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string GameSolverSettings::precisionOptionName = "precision";
             const std::string GameSolverSettings::absoluteOptionName = "absolute";
+            const std::string GameSolverSettings::valuePrecisionOptionName = "valueprecision";
 
             GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
+                std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "rs", "ratsearch"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, solvingMethodOptionName, false, "Sets which game solving technique is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a game solving technique.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(gameSolvingTechniques)).setDefaultValueString("vi").build()).build());
                 
@@ -28,6 +29,10 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
+                
+                std::vector<std::string> valuePrecisions = {"full", "mixed", "auto"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, valuePrecisionOptionName, false, "Sets the precision in which the iterates of value iteration are stored. 'mixed' iterates in single precision and corrects the result in double precision, 'auto' uses mixed precision iff the memory budget would be exceeded otherwise.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the precision.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(valuePrecisions)).setDefaultValueString("auto").build()).build());
             }
             
             storm::solver::GameMethod GameSolverSettings::getGameSolvingMethod() const {
@@ -36,6 +41,8 @@ namespace storm {
                     return storm::solver::GameMethod::ValueIteration;
                 } else if (gameSolvingTechnique == "policy-iteration" || gameSolvingTechnique == "pi") {
                     return storm::solver::GameMethod::PolicyIteration;
+                } else if (gameSolvingTechnique == "ratsearch" || gameSolvingTechnique == "rs") {
+                    return storm::solver::GameMethod::RationalSearch;
                 }
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown game solving technique '" << gameSolvingTechnique << "'.");
             }
@@ -64,6 +71,18 @@ namespace storm {
                 return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            storm::solver::ValuePrecision GameSolverSettings::getValuePrecision() const {
+                std::string valuePrecisionString = this->getOption(valuePrecisionOptionName).getArgumentByName("name").getValueAsString();
+                if (valuePrecisionString == "full") {
+                    return storm::solver::ValuePrecision::Full;
+                } else if (valuePrecisionString == "mixed") {
+                    return storm::solver::ValuePrecision::Mixed;
+                } else if (valuePrecisionString == "auto") {
+                    return storm::solver::ValuePrecision::Automatic;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown value precision '" << valuePrecisionString << "'.");
+            }
+            
             bool GameSolverSettings::isConvergenceCriterionSet() const {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet();
             }
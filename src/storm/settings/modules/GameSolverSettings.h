@@ -4,6 +4,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/ValuePrecision.h"
 
 namespace storm {
     namespace settings {
@@ -82,6 +83,11 @@ namespace storm {
                  */
                 ConvergenceCriterion getConvergenceCriterion() const;
                 
+                /*!
+                 * Retrieves the precision in which value iteration stores its iterates.
+                 */
+                storm::solver::ValuePrecision getValuePrecision() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -91,6 +97,7 @@ namespace storm {
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
+                static const std::string valuePrecisionOptionName;
             };
             
         }
@@ -116,6 +116,11 @@ namespace storm {
                  */
                 std::string getExportShieldFilename() const;
 
+                /*!
+                 * Retrieves the filenames to which a shield will be exported (if several formats are requested at once).
+                 */
+                std::vector<std::string> getExportShieldFilenames() const;
+
                 /*!
                  * Retrieves whether the check result should be exported.
                  */
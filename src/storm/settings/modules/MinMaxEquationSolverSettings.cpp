@@ -19,6 +19,7 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string MinMaxEquationSolverSettings::valuePrecisionOptionName = "valueprecision";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "ovi", "optimistic-value-iteration", "topological", "vi-to-pi", "acyclic"};
@@ -37,6 +38,10 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, intervalIterationSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").setIsAdvanced().build());
                 
+                std::vector<std::string> valuePrecisions = {"full", "mixed", "auto"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, valuePrecisionOptionName, false, "Sets the precision in which the iterates of value iteration are stored. 'mixed' iterates in single precision and corrects the result in double precision, 'auto' uses mixed precision iff the memory budget would be exceeded otherwise.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the precision.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(valuePrecisions)).setDefaultValueString("auto").build()).build());
+                
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -90,6 +95,18 @@ namespace storm {
                 return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
             }
             
+            storm::solver::ValuePrecision MinMaxEquationSolverSettings::getValuePrecision() const {
+                std::string valuePrecisionString = this->getOption(valuePrecisionOptionName).getArgumentByName("name").getValueAsString();
+                if (valuePrecisionString == "full") {
+                    return storm::solver::ValuePrecision::Full;
+                } else if (valuePrecisionString == "mixed") {
+                    return storm::solver::ValuePrecision::Mixed;
+                } else if (valuePrecisionString == "auto") {
+                    return storm::solver::ValuePrecision::Automatic;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown value precision '" << valuePrecisionString << "'.");
+            }
+            
             bool MinMaxEquationSolverSettings::isConvergenceCriterionSet() const {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet();
             }
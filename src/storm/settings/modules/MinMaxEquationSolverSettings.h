@@ -5,6 +5,7 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/MultiplicationStyle.h"
+#include "storm/solver/ValuePrecision.h"
 
 namespace storm {
     namespace settings {
@@ -95,6 +96,11 @@ namespace storm {
                  */
                 bool isForceIntervalIterationSymmetricUpdatesSet() const;
                 
+                /*!
+                 * Retrieves the precision in which value iteration stores its iterates.
+                 */
+                storm::solver::ValuePrecision getValuePrecision() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -106,6 +112,7 @@ namespace storm {
                 static const std::string absoluteOptionName;
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
+                static const std::string valuePrecisionOptionName;
                 static const std::string forceBoundsOptionName;
             };
             
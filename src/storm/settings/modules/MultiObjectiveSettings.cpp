@@ -19,6 +19,7 @@ namespace storm {
             const std::string MultiObjectiveSettings::schedulerRestrictionOptionName = "purescheds";
             const std::string MultiObjectiveSettings::printResultsOptionName = "printres";
             const std::string MultiObjectiveSettings::encodingOptionName = "encoding";
+            const std::string MultiObjectiveSettings::weightVectorBatchOptionName = "weightbatch";
             
             MultiObjectiveSettings::MultiObjectiveSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = {"pcaa", "constraintbased"};
@@ -39,6 +40,8 @@ namespace storm {
                 std::vector<std::string> encodingTypes = {"auto", "classic", "flow"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, encodingOptionName, true, "The preferred type of encoding for constraint-based methods.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("type", "The type.").setDefaultValueString("auto").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(encodingTypes)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, weightVectorBatchOptionName, true, "The number of weight vectors that are checked concurrently when approximating pareto curves (requires Intel TBB).").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of weight vectors.").setDefaultValueUnsignedInteger(1).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
             }
             
             storm::modelchecker::multiobjective::MultiObjectiveMethod MultiObjectiveSettings::getMultiObjectiveMethod() const {
@@ -83,6 +86,10 @@ namespace storm {
                 return this->getOption(maxStepsOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            uint_fast64_t MultiObjectiveSettings::getWeightVectorBatchSize() const {
+                return this->getOption(weightVectorBatchOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
+            
             bool MultiObjectiveSettings::hasSchedulerRestriction() const {
                 return this->getOption(schedulerRestrictionOptionName).getHasOptionBeenSet();
             }
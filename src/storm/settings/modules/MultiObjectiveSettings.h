@@ -68,6 +68,11 @@ namespace storm {
                  */
                 uint_fast64_t getMaxSteps() const;
                 
+                /*!
+                 * Retrieves the number of weight vectors that are checked concurrently during the approximation of pareto curves.
+                 */
+                uint_fast64_t getWeightVectorBatchSize() const;
+                
 				/*!
 				 * Retrieves whether a scheduler restriction has been set.
 				 */
@@ -117,6 +122,7 @@ namespace storm {
 				const static std::string schedulerRestrictionOptionName;
 				const static std::string printResultsOptionName;
 				const static std::string encodingOptionName;
+				const static std::string weightVectorBatchOptionName;
             };
             
         } // namespace modules
@@ -16,6 +16,9 @@ namespace storm {
             const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
             const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
             const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+            const std::string ResourceSettings::profilingReportOptionName = "profile";
+            const std::string ResourceSettings::profilingTraceOptionName = "profile-trace";
+            const std::string ResourceSettings::memoryBudgetOptionName = "memory-budget";
 
             ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.").setIsAdvanced().setShortName(timeoutOptionShortName)
@@ -23,6 +26,12 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, printTimeAndMemoryOptionName, false, "Prints CPU time and memory consumption at the end.").setShortName(printTimeAndMemoryOptionShortName).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, signalWaitingTimeOptionName, false, "Specifies how much time can pass until termination when receiving a termination signal.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "Seconds after which to exit the program.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, profilingReportOptionName, false, "Profiles hot code paths (model building, solving, ...) and writes the measured times, counters and memory consumption in JSON format.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to write the report to.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, profilingTraceOptionName, false, "Profiles hot code paths and writes each measurement in the Chrome trace-event format.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the file to write the trace to.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, memoryBudgetOptionName, false, "Specifies how much memory the solvers may use. If the budget would be exceeded, value iteration falls back to mixed precision (unless a precision is set explicitly).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The budget in megabytes.").build()).build());
             }
             
             bool ResourceSettings::isTimeoutSet() const {
@@ -41,6 +50,34 @@ namespace storm {
                 return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
             }
 
+            bool ResourceSettings::isProfilingSet() const {
+                return isProfilingReportSet() || isProfilingTraceSet();
+            }
+
+            bool ResourceSettings::isProfilingReportSet() const {
+                return this->getOption(profilingReportOptionName).getHasOptionBeenSet();
+            }
+
+            std::string ResourceSettings::getProfilingReportFilename() const {
+                return this->getOption(profilingReportOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool ResourceSettings::isProfilingTraceSet() const {
+                return this->getOption(profilingTraceOptionName).getHasOptionBeenSet();
+            }
+
+            std::string ResourceSettings::getProfilingTraceFilename() const {
+                return this->getOption(profilingTraceOptionName).getArgumentByName("filename").getValueAsString();
+            }
+
+            bool ResourceSettings::isMemoryBudgetSet() const {
+                return this->getOption(memoryBudgetOptionName).getHasOptionBeenSet();
+            }
+
+            uint_fast64_t ResourceSettings::getMemoryBudgetInMegabytes() const {
+                return this->getOption(memoryBudgetOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+            }
+
         }
     }
 }
@@ -48,6 +48,43 @@ namespace storm {
                  */
                 uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+                /*!
+                 * Retrieves whether profiling of hot code paths is enabled.
+                 *
+                 * @return True iff the profiling report or the profiling trace shall be written.
+                 */
+                bool isProfilingSet() const;
+
+                /*!
+                 * Retrieves whether a profiling report (in JSON format) shall be written.
+                 */
+                bool isProfilingReportSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the profiling report shall be written.
+                 */
+                std::string getProfilingReportFilename() const;
+
+                /*!
+                 * Retrieves whether a profiling trace (in Chrome trace-event format) shall be written.
+                 */
+                bool isProfilingTraceSet() const;
+
+                /*!
+                 * Retrieves the name of the file to which the profiling trace shall be written.
+                 */
+                std::string getProfilingTraceFilename() const;
+
+                /*!
+                 * Retrieves whether a memory budget for the solvers was set.
+                 */
+                bool isMemoryBudgetSet() const;
+
+                /*!
+                 * Retrieves the memory budget for the solvers in megabytes.
+                 */
+                uint_fast64_t getMemoryBudgetInMegabytes() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -58,6 +95,9 @@ namespace storm {
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
                 static const std::string signalWaitingTimeOptionName;
+                static const std::string profilingReportOptionName;
+                static const std::string profilingTraceOptionName;
+                static const std::string memoryBudgetOptionName;
             };
         }
     }
@@ -2,11 +2,15 @@
 
 #include <boost/core/typeinfo.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 namespace tempest {
     namespace shields {
 
         template<typename ValueType, typename IndexType>
-        AbstractShield<ValueType, IndexType>::AbstractShield(std::vector<IndexType> const& rowGroupIndices, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) : rowGroupIndices(rowGroupIndices), shieldingExpression(shieldingExpression), optimizationDirection(optimizationDirection), relevantStates(relevantStates), coalitionStates(coalitionStates) {
+        AbstractShield<ValueType, IndexType>::AbstractShield(std::vector<IndexType> const& rowGroupIndices, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) : rowGroupIndices(rowGroupIndices), shieldingExpression(shieldingExpression), optimizationDirection(optimizationDirection), relevantStates(std::move(relevantStates)), coalitionStates(std::move(coalitionStates)) {
             // Intentionally left empty.
         }
 
@@ -29,6 +33,66 @@ namespace tempest {
             return optimizationDirection;
         }
 
+        template<typename ValueType, typename IndexType>
+        void AbstractShield<ValueType, IndexType>::processStateRanges(std::function<void(uint_fast64_t, uint_fast64_t)> const& processRange) const {
+            uint_fast64_t numberOfStates = this->rowGroupIndices.size() - 1;
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, numberOfStates), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                    processRange(range.begin(), range.end());
+                });
+                return;
+            }
+#endif
+            processRange(0, numberOfStates);
+        }
+
+        template<typename ValueType, typename IndexType>
+        storm::storage::BitVector AbstractShield<ValueType, IndexType>::getShieldedStates(bool onlyCoalitionStates) const {
+            storm::storage::BitVector result = this->relevantStates;
+            if (this->coalitionStates.is_initialized()) {
+                if (onlyCoalitionStates) {
+                    result &= this->coalitionStates.get();
+                } else {
+                    result &= ~this->coalitionStates.get();
+                }
+            }
+            return result;
+        }
+
+        namespace {
+            storm::storage::BitVector liftStates(storm::storage::BitVector const& quotientStates, std::vector<uint_fast64_t> const& quotientStateMapping) {
+                storm::storage::BitVector result(quotientStateMapping.size());
+                for (uint_fast64_t state = 0; state < quotientStateMapping.size(); ++state) {
+                    result.set(state, quotientStates.get(quotientStateMapping[state]));
+                }
+                return result;
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        std::vector<ValueType> AbstractShield<ValueType, IndexType>::liftChoiceValues(std::vector<ValueType> const& choiceValues, std::vector<uint_fast64_t> const& quotientChoiceMapping) {
+            std::vector<ValueType> result;
+            result.reserve(quotientChoiceMapping.size());
+            for (auto quotientChoice : quotientChoiceMapping) {
+                result.push_back(choiceValues[quotientChoice]);
+            }
+            return result;
+        }
+
+        template<typename ValueType, typename IndexType>
+        storm::storage::BitVector AbstractShield<ValueType, IndexType>::liftRelevantStates(std::vector<uint_fast64_t> const& quotientStateMapping) const {
+            return liftStates(relevantStates, quotientStateMapping);
+        }
+
+        template<typename ValueType, typename IndexType>
+        boost::optional<storm::storage::BitVector> AbstractShield<ValueType, IndexType>::liftCoalitionStates(std::vector<uint_fast64_t> const& quotientStateMapping) const {
+            if (!coalitionStates) {
+                return boost::none;
+            }
+            return liftStates(coalitionStates.get(), quotientStateMapping);
+        }
+
         template<typename ValueType, typename IndexType>
         std::string AbstractShield<ValueType, IndexType>::getClassName() const {
             return std::string(boost::core::demangled_name(BOOST_CORE_TYPEID(*this)));
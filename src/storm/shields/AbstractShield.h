@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 #include <iostream>
 #include <string>
 #include <memory>
@@ -53,10 +54,38 @@ namespace tempest {
             virtual void printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) = 0;
             virtual void printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) = 0;
 
+            /*!
+             * Lifts a shield that was computed on a quotient of the model (e.g. its bisimulation quotient) back to the
+             * model. Every state (choice) inherits the values of the quotient state (choice) it is mapped to.
+             *
+             * @param rowGroupIndices The row group indices of the original model.
+             * @param quotientStateMapping Maps every state of the original model to its quotient state.
+             * @param quotientChoiceMapping Maps every choice of the original model to its quotient choice.
+             * @return The shield for the original model.
+             */
+            virtual std::unique_ptr<AbstractShield<ValueType, IndexType>> lift(std::vector<IndexType> const& rowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping) const = 0;
 
         protected:
             AbstractShield(std::vector<IndexType> const& rowGroupIndices, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
+            /*!
+             * Calls the given function for consecutive ranges [begin, end) of states that together cover all states. As
+             * the states of a shield are independent of each other, the ranges are processed concurrently if Intel TBB
+             * is enabled.
+             */
+            void processStateRanges(std::function<void(uint_fast64_t, uint_fast64_t)> const& processRange) const;
+
+            /*!
+             * Retrieves the states for which the shield restricts the choices, i.e., the relevant states that are not
+             * states of the coalition (or, if onlyCoalitionStates is set, the relevant states of the coalition).
+             */
+            storm::storage::BitVector getShieldedStates(bool onlyCoalitionStates) const;
+
+            // Helpers for lift: transfer the choice values and the relevant/coalition states from the quotient.
+            static std::vector<ValueType> liftChoiceValues(std::vector<ValueType> const& choiceValues, std::vector<uint_fast64_t> const& quotientChoiceMapping);
+            storm::storage::BitVector liftRelevantStates(std::vector<uint_fast64_t> const& quotientStateMapping) const;
+            boost::optional<storm::storage::BitVector> liftCoalitionStates(std::vector<uint_fast64_t> const& quotientStateMapping) const;
+
             std::vector<index_type> rowGroupIndices;
             //std::vector<value_type> choiceValues;
 
@@ -2,52 +2,57 @@
 
 #include <algorithm>
 
+#include "storm/utility/profiling.h"
+
 namespace tempest {
     namespace shields {
 
         template<typename ValueType, typename IndexType>
-        PostShield<ValueType, IndexType>::PostShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) : AbstractShield<ValueType, IndexType>(rowGroupIndices, shieldingExpression, optimizationDirection, relevantStates, coalitionStates), choiceValues(choiceValues) {
+        PostShield<ValueType, IndexType>::PostShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) : AbstractShield<ValueType, IndexType>(rowGroupIndices, shieldingExpression, optimizationDirection, std::move(relevantStates), std::move(coalitionStates)), choiceValues(std::move(choiceValues)) {
             // Intentionally left empty.
         }
 
         template<typename ValueType, typename IndexType>
-        storm::storage::PostScheduler<ValueType> PostShield<ValueType, IndexType>::construct() {
+        storm::storage::PostScheduler<ValueType> const& PostShield<ValueType, IndexType>::construct() {
+            if (constructedShield) {
+                return constructedShield.get();
+            }
+            STORM_PROFILE_SCOPE("shield.construct");
             if (this->getOptimizationDirection() == storm::OptimizationDirection::Minimize) {
                 if(this->shieldingExpression->isRelative()) {
-                    return constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, true>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, true>();
                 } else {
-                    return constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, false>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, false>();
                 }
             } else {
                 if(this->shieldingExpression->isRelative()) {
-                    return constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, true>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, true>();
                 } else {
-                    return constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, false>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, false>();
                 }
             }
+            return constructedShield.get();
         }
 
         template<typename ValueType, typename IndexType>
         template<typename Compare, bool relative>
         storm::storage::PostScheduler<ValueType> PostShield<ValueType, IndexType>::constructWithCompareType() {
-            tempest::shields::utility::ChoiceFilter<ValueType, Compare, relative> choiceFilter;
             storm::storage::PostScheduler<ValueType> shield(this->rowGroupIndices.size() - 1, this->computeRowGroupSizes());
-            auto choice_it = this->choiceValues.begin();
-            if(this->coalitionStates.is_initialized()) {
-                this->relevantStates &= ~this->coalitionStates.get();
-            }
-            for(uint state = 0; state < this->rowGroupIndices.size() - 1; state++) {
-                uint rowGroupSize = this->rowGroupIndices[state + 1] - this->rowGroupIndices[state];
-                if(this->relevantStates.get(state)) {
+            storm::storage::BitVector shieldedStates = this->getShieldedStates(false);
+            this->processStateRanges([&](uint_fast64_t firstState, uint_fast64_t endState) {
+                tempest::shields::utility::ChoiceFilter<ValueType, Compare, relative> choiceFilter;
+                for(uint_fast64_t state = firstState; state < endState; state++) {
+                    if(!shieldedStates.get(state)) {
+                        continue;
+                    }
+                    uint rowGroupSize = this->rowGroupIndices[state + 1] - this->rowGroupIndices[state];
+                    auto choice_it = this->choiceValues.begin() + (this->rowGroupIndices[state] - this->rowGroupIndices.front());
                     auto optProbabilityIndex = std::min_element(choice_it, choice_it + rowGroupSize) - choice_it;
                     if(std::is_same<Compare, storm::utility::ElementGreaterEqual<ValueType>>::value) {
                         optProbabilityIndex = std::max_element(choice_it, choice_it + rowGroupSize) - choice_it;
                     }
                     ValueType optProbability = *(choice_it + optProbabilityIndex);
                     if(!relative && !choiceFilter(optProbability, optProbability, this->shieldingExpression->getValue())) {
-                        STORM_LOG_WARN("No shielding action possible with absolute comparison for state with index " << state);
-                        shield.setChoice(storm::storage::PostSchedulerChoice<ValueType>(), state, 0);
-                        choice_it += rowGroupSize;
                         continue;
                     }
                     storm::storage::PostSchedulerChoice<ValueType> choiceMapping;
@@ -59,9 +64,12 @@ namespace tempest {
                         }
                     }
                     shield.setChoice(choiceMapping, state, 0);
-                } else {
-                    shield.setChoice(storm::storage::PostSchedulerChoice<ValueType>(), state, 0);
-                    choice_it += rowGroupSize;
+                }
+            });
+            // Warn about the states without a shielding action only now, as the states may have been processed concurrently.
+            if(!relative) {
+                for(auto state : shieldedStates) {
+                    STORM_LOG_WARN_COND(!shield.getChoice(state).isEmpty(), "No shielding action possible with absolute comparison for state with index " << state);
                 }
             }
             return shield;
@@ -79,6 +87,11 @@ namespace tempest {
         }
 
 
+        template<typename ValueType, typename IndexType>
+        std::unique_ptr<AbstractShield<ValueType, IndexType>> PostShield<ValueType, IndexType>::lift(std::vector<IndexType> const& rowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping) const {
+            return std::make_unique<PostShield<ValueType, IndexType>>(rowGroupIndices, this->liftChoiceValues(choiceValues, quotientChoiceMapping), this->shieldingExpression, this->optimizationDirection, this->liftRelevantStates(quotientStateMapping), this->liftCoalitionStates(quotientStateMapping));
+        }
+
         // Explicitly instantiate appropriate classes
         template class PostShield<double, typename storm::storage::SparseMatrix<double>::index_type>;
 #ifdef STORM_HAVE_CARL
@@ -2,44 +2,51 @@
 
 #include <algorithm>
 
+#include "storm/utility/profiling.h"
+
 namespace tempest {
     namespace shields {
 
         template<typename ValueType, typename IndexType>
-        PreShield<ValueType, IndexType>::PreShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) : AbstractShield<ValueType, IndexType>(rowGroupIndices, shieldingExpression, optimizationDirection, relevantStates, coalitionStates), choiceValues(choiceValues) {
+        PreShield<ValueType, IndexType>::PreShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates) : AbstractShield<ValueType, IndexType>(rowGroupIndices, shieldingExpression, optimizationDirection, std::move(relevantStates), std::move(coalitionStates)), choiceValues(std::move(choiceValues)) {
             // Intentionally left empty.
         }
 
         template<typename ValueType, typename IndexType>
-        storm::storage::PreScheduler<ValueType> PreShield<ValueType, IndexType>::construct() {
+        storm::storage::PreScheduler<ValueType> const& PreShield<ValueType, IndexType>::construct() {
+            if (constructedShield) {
+                return constructedShield.get();
+            }
+            STORM_PROFILE_SCOPE("shield.construct");
             if (this->getOptimizationDirection() == storm::OptimizationDirection::Minimize) {
                 if(this->shieldingExpression->isRelative()) {
-                    return constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, true>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, true>();
                 } else {
-                    return constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, false>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementLessEqual<ValueType>, false>();
                 }
             } else {
                 if(this->shieldingExpression->isRelative()) {
-                    return constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, true>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, true>();
                 } else {
-                    return constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, false>();
+                    constructedShield = constructWithCompareType<storm::utility::ElementGreaterEqual<ValueType>, false>();
                 }
             }
+            return constructedShield.get();
         }
 
         template<typename ValueType, typename IndexType>
         template<typename Compare, bool relative>
         storm::storage::PreScheduler<ValueType> PreShield<ValueType, IndexType>::constructWithCompareType() {
-            tempest::shields::utility::ChoiceFilter<ValueType, Compare, relative> choiceFilter;
             storm::storage::PreScheduler<ValueType> shield(this->rowGroupIndices.size() - 1);
-            auto choice_it = this->choiceValues.begin();
-            if(this->coalitionStates.is_initialized()) {
-                this->relevantStates &= ~this->coalitionStates.get();
-            }
-            for(uint state = 0; state < this->rowGroupIndices.size() - 1; state++) {
-                uint rowGroupSize = this->rowGroupIndices[state + 1] - this->rowGroupIndices[state];
-                if(this->relevantStates.get(state)) {
-                    storm::storage::PreSchedulerChoice<ValueType> enabledChoices;
+            storm::storage::BitVector shieldedStates = this->getShieldedStates(false);
+            this->processStateRanges([&](uint_fast64_t firstState, uint_fast64_t endState) {
+                tempest::shields::utility::ChoiceFilter<ValueType, Compare, relative> choiceFilter;
+                for(uint_fast64_t state = firstState; state < endState; state++) {
+                    if(!shieldedStates.get(state)) {
+                        continue;
+                    }
+                    uint rowGroupSize = this->rowGroupIndices[state + 1] - this->rowGroupIndices[state];
+                    auto choice_it = this->choiceValues.begin() + (this->rowGroupIndices[state] - this->rowGroupIndices.front());
                     ValueType optProbability;
                     if(std::is_same<Compare, storm::utility::ElementGreaterEqual<ValueType>>::value) {
                         optProbability = *std::max_element(choice_it, choice_it + rowGroupSize);
@@ -47,23 +54,22 @@ namespace tempest {
                         optProbability = *std::min_element(choice_it, choice_it + rowGroupSize);
                     }
                     if(!relative && !choiceFilter(optProbability, optProbability, this->shieldingExpression->getValue())) {
-                        STORM_LOG_WARN("No shielding action possible with absolute comparison for state with index " << state);
-                        shield.setChoice(storm::storage::PreSchedulerChoice<ValueType>(), state, 0);
-                        choice_it += rowGroupSize;
                         continue;
                     }
+                    storm::storage::PreSchedulerChoice<ValueType> enabledChoices;
                     for(uint choice = 0; choice < rowGroupSize; choice++, choice_it++) {
                         if(choiceFilter(*choice_it, optProbability, this->shieldingExpression->getValue())) {
                             enabledChoices.addChoice(choice, *choice_it);
                         }
                     }
                     shield.setChoice(enabledChoices, state, 0);
-
-                } else {
-                    shield.setChoice(storm::storage::PreSchedulerChoice<ValueType>(), state, 0);
-                    choice_it += rowGroupSize;
                 }
-
+            });
+            // Warn about the states without a shielding action only now, as the states may have been processed concurrently.
+            if(!relative) {
+                for(auto state : shieldedStates) {
+                    STORM_LOG_WARN_COND(!shield.getChoice(state).isEmpty(), "No shielding action possible with absolute comparison for state with index " << state);
+                }
             }
             return shield;
         }
@@ -80,6 +86,11 @@ namespace tempest {
         }
 
 
+        template<typename ValueType, typename IndexType>
+        std::unique_ptr<AbstractShield<ValueType, IndexType>> PreShield<ValueType, IndexType>::lift(std::vector<IndexType> const& rowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping) const {
+            return std::make_unique<PreShield<ValueType, IndexType>>(rowGroupIndices, this->liftChoiceValues(choiceValues, quotientChoiceMapping), this->shieldingExpression, this->optimizationDirection, this->liftRelevantStates(quotientStateMapping), this->liftCoalitionStates(quotientStateMapping));
+        }
+
         // Explicitly instantiate appropriate classes
         template class PreShield<double, typename storm::storage::SparseMatrix<double>::index_type>;
 #ifdef STORM_HAVE_CARL
@@ -9,17 +9,24 @@ namespace tempest {
         template<typename ValueType, typename IndexType>
         class PreShield : public AbstractShield<ValueType, IndexType> {
         public:
-            PreShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+            PreShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
-            storm::storage::PreScheduler<ValueType> construct();
+            /*!
+             * Constructs the shield from the choice values. The result is cached, i.e., the shield is only constructed
+             * once no matter how often it is exported.
+             */
+            storm::storage::PreScheduler<ValueType> const& construct();
             template<typename Compare, bool relative>
             storm::storage::PreScheduler<ValueType> constructWithCompareType();
 
             virtual void printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) override;
             virtual void printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) override;
 
+            virtual std::unique_ptr<AbstractShield<ValueType, IndexType>> lift(std::vector<IndexType> const& rowGroupIndices, std::vector<uint_fast64_t> const& quotientStateMapping, std::vector<uint_fast64_t> const& quotientChoiceMapping) const override;
+
         private:
             std::vector<ValueType> choiceValues;
+            boost::optional<storm::storage::PreScheduler<ValueType>> constructedShield;
         };
     }
 }
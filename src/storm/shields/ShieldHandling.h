@@ -4,6 +4,7 @@
 #include <boost/optional.hpp>
 #include <memory>
 
+#include "storm/models/sparse/Model.h"
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/BitVector.h"
 
@@ -21,11 +22,15 @@
 
 namespace tempest {
     namespace shields {     
+        /*!
+         * Creates a safety shield from the given choice values. The model is only used to obtain the row groups,
+         * so it is neither copied nor retained by the shield. Pass the choice values as an rvalue to avoid copying them.
+         */
         template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
-        std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+        std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createShield(storm::models::sparse::Model<ValueType> const& model, std::vector<ValueType> choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
         template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
-        std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createQuantitativeShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+        std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createQuantitativeShield(storm::models::sparse::Model<ValueType> const& model, std::vector<ValueType> choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
     }
 }
@@ -0,0 +1,177 @@
+#include "storm/simulator/PrismProgramBatchSimulator.h"
+
+#include <algorithm>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace simulator {
+
+        template<typename ValueType>
+        DiscreteTimePrismProgramBatchSimulator<ValueType>::DiscreteTimePrismProgramBatchSimulator(storm::prism::Program const& program, storm::generator::NextStateGeneratorOptions const& options, uint64_t batchSize, uint64_t maximalNumberOfActions) : maximalNumberOfActions(maximalNumberOfActions) {
+            STORM_LOG_THROW(batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch needs to contain at least one trajectory.");
+            // The simulators are created sequentially as the construction of the generators is not thread-safe.
+            simulators.reserve(batchSize);
+            for (uint64_t index = 0; index < batchSize; ++index) {
+                simulators.push_back(std::make_unique<DiscreteTimePrismProgramSimulator<ValueType>>(program, options));
+            }
+            numberOfRewards = simulators.front()->getLastRewards().size();
+
+            observations.resize(batchSize * getObservationSize());
+            rewards.resize(batchSize * numberOfRewards);
+            actionMasks.resize(batchSize * maximalNumberOfActions);
+            sinkStates.resize(batchSize);
+            for (uint64_t index = 0; index < batchSize; ++index) {
+                updateOutputs(index);
+            }
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::setSeed(uint64_t seed) {
+            for (uint64_t index = 0; index < simulators.size(); ++index) {
+                simulators[index]->setSeed(seed + index);
+            }
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::setActionFilter(ActionFilter const& filter) {
+            actionFilter = filter;
+            forEachTrajectory([this](uint64_t index) { updateOutputs(index); });
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::unsetActionFilter() {
+            actionFilter = nullptr;
+            forEachTrajectory([this](uint64_t index) { updateOutputs(index); });
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::step(std::vector<uint64_t> const& actions) {
+            STORM_LOG_THROW(actions.size() == simulators.size(), storm::exceptions::InvalidArgumentException, "Expected " << simulators.size() << " actions but got " << actions.size() << ".");
+            // Check the actions upfront, so that a wrong action does not leave the batch partially advanced.
+            for (uint64_t index = 0; index < actions.size(); ++index) {
+                STORM_LOG_THROW(actions[index] < maximalNumberOfActions && actionMasks[index * maximalNumberOfActions + actions[index]] != 0, storm::exceptions::InvalidArgumentException, "Action " << actions[index] << " is not allowed in trajectory " << index << ".");
+            }
+            forEachTrajectory([this, &actions](uint64_t index) {
+                simulators[index]->step(actions[index]);
+                updateOutputs(index);
+            });
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::resetToInitial() {
+            forEachTrajectory([this](uint64_t index) {
+                simulators[index]->resetToInitial();
+                updateOutputs(index);
+            });
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::resetToInitial(uint64_t index) {
+            STORM_LOG_THROW(index < simulators.size(), storm::exceptions::InvalidArgumentException, "Invalid trajectory index " << index << ".");
+            simulators[index]->resetToInitial();
+            updateOutputs(index);
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimePrismProgramBatchSimulator<ValueType>::getBatchSize() const {
+            return simulators.size();
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimePrismProgramBatchSimulator<ValueType>::getMaximalNumberOfActions() const {
+            return maximalNumberOfActions;
+        }
+
+        template<typename ValueType>
+        uint64_t DiscreteTimePrismProgramBatchSimulator<ValueType>::getObservationSize() const {
+            auto const& variableInformation = simulators.front()->getVariableInformation();
+            return variableInformation.booleanVariables.size() + variableInformation.integerVariables.size();
+        }
+
+        template<typename ValueType>
+        std::vector<int64_t> const& DiscreteTimePrismProgramBatchSimulator<ValueType>::getObservations() const {
+            return observations;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> const& DiscreteTimePrismProgramBatchSimulator<ValueType>::getRewards() const {
+            return rewards;
+        }
+
+        template<typename ValueType>
+        std::vector<uint8_t> const& DiscreteTimePrismProgramBatchSimulator<ValueType>::getActionMasks() const {
+            return actionMasks;
+        }
+
+        template<typename ValueType>
+        std::vector<uint8_t> const& DiscreteTimePrismProgramBatchSimulator<ValueType>::getSinkStates() const {
+            return sinkStates;
+        }
+
+        template<typename ValueType>
+        DiscreteTimePrismProgramSimulator<ValueType> const& DiscreteTimePrismProgramBatchSimulator<ValueType>::getSimulator(uint64_t index) const {
+            return *simulators[index];
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::updateOutputs(uint64_t index) {
+            DiscreteTimePrismProgramSimulator<ValueType> const& simulator = *simulators[index];
+            generator::CompressedState const& state = simulator.getCurrentState();
+            generator::VariableInformation const& variableInformation = simulator.getVariableInformation();
+
+            auto observationIt = observations.begin() + index * getObservationSize();
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                *observationIt = state.get(booleanVariable.bitOffset) ? 1 : 0;
+                ++observationIt;
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                *observationIt = static_cast<int64_t>(state.getAsInt(integerVariable.bitOffset, integerVariable.bitWidth)) + integerVariable.lowerBound;
+                ++observationIt;
+            }
+
+            std::copy(simulator.getLastRewards().begin(), simulator.getLastRewards().end(), rewards.begin() + index * numberOfRewards);
+
+            uint64_t numberOfChoices = simulator.getChoices().size();
+            STORM_LOG_THROW(numberOfChoices <= maximalNumberOfActions, storm::exceptions::NotSupportedException, "The current state of trajectory " << index << " has " << numberOfChoices << " choices, but the action masks only have " << maximalNumberOfActions << " entries.");
+            auto maskIt = actionMasks.begin() + index * maximalNumberOfActions;
+            std::fill(maskIt, maskIt + maximalNumberOfActions, 0);
+            if (actionFilter) {
+                storm::storage::BitVector allowedChoices = actionFilter(simulator);
+                STORM_LOG_THROW(allowedChoices.size() == numberOfChoices, storm::exceptions::InvalidArgumentException, "The action filter returned " << allowedChoices.size() << " entries for a state with " << numberOfChoices << " choices.");
+                for (auto choice : allowedChoices) {
+                    *(maskIt + choice) = 1;
+                }
+            } else {
+                std::fill(maskIt, maskIt + numberOfChoices, 1);
+            }
+
+            sinkStates[index] = simulator.isSinkState() ? 1 : 0;
+        }
+
+        template<typename ValueType>
+        void DiscreteTimePrismProgramBatchSimulator<ValueType>::forEachTrajectory(std::function<void(uint64_t)> const& function) {
+#ifdef STORM_HAVE_INTELTBB
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet()) {
+                // The trajectories only share the (read-only) program, so they can be advanced independently.
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, simulators.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        function(index);
+                    }
+                });
+                return;
+            }
+#endif
+            for (uint64_t index = 0; index < simulators.size(); ++index) {
+                function(index);
+            }
+        }
+
+        template class DiscreteTimePrismProgramBatchSimulator<double>;
+    }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace simulator {
+
+        /**
+         * This class simulates a batch of independent trajectories through a prism program, e.g.,
+         * to serve many environment instances of a learning agent at once.
+         *
+         * Each trajectory is driven by its own DiscreteTimePrismProgramSimulator, as the next state generators
+         * keep the loaded state and therefore can not be shared. A step advances all trajectories, in parallel if
+         * Intel TBB is enabled. After every step, the observations, rewards and masks of the enabled actions of all
+         * trajectories are available in flat arrays, in which the entries of trajectory i form the i-th block.
+         *
+         * @tparam ValueType
+         */
+        template<typename ValueType>
+        class DiscreteTimePrismProgramBatchSimulator {
+        public:
+            /**
+             * A filter that restricts the actions of a trajectory, e.g., to the actions that are allowed by a pre-shield.
+             * Given the simulator of the trajectory, it returns the allowed indices of the getChoices vector.
+             * As the trajectories are advanced in parallel, the filter has to be safe to call concurrently.
+             */
+            typedef std::function<storm::storage::BitVector(DiscreteTimePrismProgramSimulator<ValueType> const&)> ActionFilter;
+
+            /**
+             * Initialize the simulator for a given prism program. All trajectories start in the initial state.
+             *
+             * @param program The prism program. Should have a unique initial state.
+             * @param options The generator options that are used to generate successor states.
+             * @param batchSize The number of trajectories.
+             * @param maximalNumberOfActions The number of entries of the action mask of each trajectory. No state may have more choices.
+             */
+            DiscreteTimePrismProgramBatchSimulator(storm::prism::Program const& program,
+                                                   storm::generator::NextStateGeneratorOptions const& options,
+                                                   uint64_t batchSize, uint64_t maximalNumberOfActions);
+
+            /**
+             * Set the simulation seed. The trajectory with index i uses the seed + i.
+             */
+            void setSeed(uint64_t seed);
+
+            /**
+             * Set the filter that restricts the actions of the trajectories and recomputes the action masks.
+             */
+            void setActionFilter(ActionFilter const& filter);
+
+            /**
+             * Removes the filter, i.e., all choices are allowed again.
+             */
+            void unsetActionFilter();
+
+            /**
+             * Make a step in every trajectory. The index of the action of trajectory i is given by actions[i]
+             * and needs to be allowed by the current action mask.
+             */
+            void step(std::vector<uint64_t> const& actions);
+
+            /**
+             * Reset all trajectories to the (unique) initial state.
+             */
+            void resetToInitial();
+
+            /**
+             * Reset the given trajectory to the (unique) initial state, e.g., after it has reached a sink state.
+             */
+            void resetToInitial(uint64_t index);
+
+            uint64_t getBatchSize() const;
+            uint64_t getMaximalNumberOfActions() const;
+
+            /**
+             * The number of entries of the observation of each trajectory, i.e., the number of boolean and integer variables.
+             */
+            uint64_t getObservationSize() const;
+
+            /**
+             * The values of the variables in the current states, booleans (as 0 and 1) first, in the order of the variable information of the simulators.
+             * @return A vector with getBatchSize() * getObservationSize() entries.
+             */
+            std::vector<int64_t> const& getObservations() const;
+
+            /**
+             * The last rewards of all trajectories, see DiscreteTimePrismProgramSimulator::getLastRewards.
+             * @return A vector with getBatchSize() * (the number of reward names) entries.
+             */
+            std::vector<ValueType> const& getRewards() const;
+
+            /**
+             * Indicates which actions are allowed in the current states, where 1 means allowed.
+             * @return A vector with getBatchSize() * getMaximalNumberOfActions() entries.
+             */
+            std::vector<uint8_t> const& getActionMasks() const;
+
+            /**
+             * Indicates which trajectories are in a sink state.
+             * @return A vector with getBatchSize() entries.
+             */
+            std::vector<uint8_t> const& getSinkStates() const;
+
+            DiscreteTimePrismProgramSimulator<ValueType> const& getSimulator(uint64_t index) const;
+
+        private:
+            /**
+             * Writes the observation, rewards and action mask of the given trajectory into the flat arrays.
+             */
+            void updateOutputs(uint64_t index);
+
+            /**
+             * Applies the given function to every trajectory, in parallel if Intel TBB is enabled.
+             */
+            void forEachTrajectory(std::function<void(uint64_t)> const& function);
+
+            /// The simulators of the trajectories.
+            std::vector<std::unique_ptr<DiscreteTimePrismProgramSimulator<ValueType>>> simulators;
+            uint64_t maximalNumberOfActions;
+            uint64_t numberOfRewards;
+            /// The optional filter for the actions.
+            ActionFilter actionFilter;
+
+            std::vector<int64_t> observations;
+            std::vector<ValueType> rewards;
+            std::vector<uint8_t> actionMasks;
+            std::vector<uint8_t> sinkStates;
+        };
+    }
+}
@@ -134,6 +134,11 @@ namespace storm {
             return names;
         }
 
+        template<typename ValueType>
+        generator::VariableInformation const& DiscreteTimePrismProgramSimulator<ValueType>::getVariableInformation() const {
+            return stateGenerator->getVariableInformation();
+        }
+
         template<typename ValueType>
         uint32_t DiscreteTimePrismProgramSimulator<ValueType>::getOrAddStateIndex(generator::CompressedState const& state) {
             uint32_t newIndex = static_cast<uint32_t>(stateToId.size());
@@ -80,6 +80,11 @@ namespace storm {
              * The names of the rewards that are returned.
              */
             std::vector<std::string> getRewardNames() const;
+
+            /**
+             * The information about the variables, which describes how the values of the variables are packed into compressed states.
+             */
+            generator::VariableInformation const& getVariableInformation() const;
         protected:
             bool explore();
             void clearStateCaches();
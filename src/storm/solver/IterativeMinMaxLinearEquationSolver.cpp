@@ -6,6 +6,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/solver/helper/MixedPrecisionValueIterationHelper.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
@@ -426,7 +427,14 @@ namespace storm {
                 this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
             }
 
-            if (!auxiliaryRowGroupVector) {
+            // In mixed precision, the auxiliary vector is only needed for the initial scheduler and for extracting the scheduler.
+            bool useMixedPrecision = storm::solver::helper::MixedPrecisionValueIterationHelper<ValueType>::isMixedPrecisionSelected(env.solver().minMax().getValuePrecision(), env.solver().getMemoryBudget(), *this->A, 1);
+            if (useMixedPrecision && (this->hasCustomTerminationCondition() || this->hasLowerBound() || this->hasUpperBound())) {
+                // The mixed-precision helper neither checks custom termination conditions nor keeps the iterates within the bounds.
+                STORM_LOG_INFO("Using full precision, because a custom termination condition or bounds are set.");
+                useMixedPrecision = false;
+            }
+            if (!auxiliaryRowGroupVector && (!useMixedPrecision || this->hasInitialScheduler() || this->isTrackSchedulerSet())) {
                 auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
             }
 
@@ -479,6 +487,21 @@ namespace storm {
                 }
             }
 
+            if (useMixedPrecision) {
+                // The in-place updates preserve the guarantee of the initial vector.
+                storm::solver::helper::MixedPrecisionValueIterationHelper<ValueType> helper(*this->A);
+                auto statusIters = helper.solveEquations(x, b, dir, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+                this->reportStatus(statusIters.first, statusIters.second);
+                if (this->isTrackSchedulerSet()) {
+                    this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                    this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
+                }
+                if (!this->isCachingEnabled()) {
+                    clearCache();
+                }
+                return statusIters.first == SolverStatus::Converged || statusIters.first == SolverStatus::TerminatedEarly;
+            }
+
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             std::vector<ValueType>* currentX = &x;
 
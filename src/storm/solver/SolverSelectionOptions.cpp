@@ -46,6 +46,8 @@ namespace storm {
                     return "valueiteration";
                 case GameMethod::PolicyIteration:
                     return "PolicyIteration";
+                case GameMethod::RationalSearch:
+                    return "ratsearch";
             }
             return "invalid";
         }
@@ -8,7 +8,7 @@ namespace storm {
     namespace solver {
         ExtendEnumsWithSelectionField(MinMaxMethod, ValueIteration, PolicyIteration, LinearProgramming, Topological, RationalSearch, IntervalIteration, SoundValueIteration, OptimisticValueIteration, TopologicalCuda, ViToPi, Acyclic)
         ExtendEnumsWithSelectionField(MultiplierType, Native, Gmmxx)
-        ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration)
+        ExtendEnumsWithSelectionField(GameMethod, PolicyIteration, ValueIteration, RationalSearch)
         ExtendEnumsWithSelectionField(LraMethod, LinearProgramming, ValueIteration, GainBiasEquations, LraDistributionEquations)
         ExtendEnumsWithSelectionField(MaBoundedReachabilityMethod, Imca, UnifPlus)
 
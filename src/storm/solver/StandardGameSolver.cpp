@@ -51,6 +51,10 @@ namespace storm {
         template<typename ValueType>
         GameMethod StandardGameSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
             auto method = env.solver().game().getMethod();
+            if (method == GameMethod::RationalSearch) {
+                method = GameMethod::PolicyIteration;
+                STORM_LOG_INFO("Changing game method to policy-iteration as rational search is only supported for rPATL model checking.");
+            }
             if (isExactMode && method != GameMethod::PolicyIteration) {
                 if (env.solver().game().isMethodSetFromDefault()) {
                     method = GameMethod::PolicyIteration;
@@ -0,0 +1,16 @@
+#include "storm/solver/ValuePrecision.h"
+
+namespace storm {
+    namespace solver {
+        
+        std::ostream& operator<<(std::ostream& out, ValuePrecision const& precision) {
+            switch (precision) {
+                case ValuePrecision::Full: out << "full"; break;
+                case ValuePrecision::Mixed: out << "mixed"; break;
+                case ValuePrecision::Automatic: out << "automatic"; break;
+            }
+            return out;
+        }
+        
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <iostream>
+
+namespace storm {
+    namespace solver {
+        
+        /*!
+         * The precision in which iterative solvers store the iterates. In mixed precision, the bulk of the iterations is
+         * performed on single-precision iterates, followed by a correction in full precision. Automatic selects mixed
+         * precision iff the full-precision iterates would exceed the memory budget.
+         */
+        enum class ValuePrecision { Full, Mixed, Automatic };
+     
+        std::ostream& operator<<(std::ostream& out, ValuePrecision const& precision);
+        
+    }
+}
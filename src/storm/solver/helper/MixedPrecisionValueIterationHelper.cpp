@@ -0,0 +1,138 @@
+#include "storm/solver/helper/MixedPrecisionValueIterationHelper.h"
+
+#include <limits>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/vector.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            template<typename ValueType>
+            MixedPrecisionValueIterationHelper<ValueType>::MixedPrecisionValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            std::pair<SolverStatus, uint64_t> MixedPrecisionValueIterationHelper<ValueType>::solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b, storm::solver::OptimizationDirection const& dir, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations, storm::storage::BitVector const* dirOverride) const {
+                uint64_t const numberOfStates = matrix.getRowGroupCount();
+                STORM_LOG_ASSERT(x.size() == numberOfStates, "Unexpected size of the solution vector.");
+                STORM_LOG_ASSERT(b.size() == matrix.getRowCount(), "Unexpected size of the right-hand side.");
+                storm::storage::BitVector maximizingStates(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    maximizingStates.set(state, maximizeInState(state, dir, dirOverride));
+                }
+                uint64_t iterations = 0;
+
+                // In the first phase, the iterates are updated in place in reduced precision. We stop as soon as they only
+                // change within the resolution of the reduced precision (relative to their magnitude), because the rounding
+                // would prevent convergence wrt. stricter criteria.
+                {
+                    ValueType reducedPrecision = storm::utility::max<ValueType>(precision, storm::utility::convertNumber<ValueType>(16.0 * std::numeric_limits<float>::epsilon()));
+                    std::vector<IterateType> reducedX(numberOfStates);
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        reducedX[state] = static_cast<IterateType>(x[state]);
+                    }
+                    bool converged = false;
+                    while (!converged && iterations < maximalNumberOfIterations && !storm::utility::resources::isTerminate()) {
+                        converged = true;
+                        for (uint64_t state = 0; state < numberOfStates; ++state) {
+                            IterateType newValue = static_cast<IterateType>(computeOptimalValueOfState(state, reducedX, b, maximizingStates.get(state)));
+                            if (converged && !storm::utility::vector::equalModuloPrecision(static_cast<ValueType>(reducedX[state]), static_cast<ValueType>(newValue), reducedPrecision, true)) {
+                                converged = false;
+                            }
+                            reducedX[state] = newValue;
+                        }
+                        ++iterations;
+                    }
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        x[state] = static_cast<ValueType>(reducedX[state]);
+                    }
+                    STORM_LOG_DEBUG("Reduced-precision phase of mixed-precision value iteration stopped after " << iterations << " iterations.");
+                }
+
+                // In the second phase, the result is corrected in full precision.
+                SolverStatus status = SolverStatus::InProgress;
+                while (status == SolverStatus::InProgress) {
+                    bool converged = true;
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        ValueType newValue = computeOptimalValueOfState(state, x, b, maximizingStates.get(state));
+                        if (converged && !storm::utility::vector::equalModuloPrecision(x[state], newValue, precision, relative)) {
+                            converged = false;
+                        }
+                        x[state] = std::move(newValue);
+                    }
+                    ++iterations;
+
+                    if (converged) {
+                        status = SolverStatus::Converged;
+                    } else if (iterations >= maximalNumberOfIterations) {
+                        status = SolverStatus::MaximalIterationsExceeded;
+                    } else if (storm::utility::resources::isTerminate()) {
+                        status = SolverStatus::Aborted;
+                    }
+                }
+                return std::make_pair(status, iterations);
+            }
+
+            template<typename ValueType>
+            bool MixedPrecisionValueIterationHelper<ValueType>::isMixedPrecisionSelected(storm::solver::ValuePrecision const& valuePrecision, boost::optional<uint64_t> const& memoryBudget, storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfFullPrecisionIterates) {
+                bool const reducible = !std::is_same<IterateType, ValueType>::value;
+                if (valuePrecision == storm::solver::ValuePrecision::Full) {
+                    return false;
+                } else if (valuePrecision == storm::solver::ValuePrecision::Mixed) {
+                    STORM_LOG_WARN_COND(reducible, "Mixed precision is not available for this value type, using full precision.");
+                    return reducible;
+                } else if (!reducible || !memoryBudget) {
+                    return false;
+                }
+
+                // Estimate the memory needed with full precision: the matrix (entries and row indications), x, b and the iterates.
+                typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+                uint64_t const numberOfStates = matrix.getRowGroupCount();
+                uint64_t const sharedMemory = matrix.getEntryCount() * (sizeof(IndexType) + sizeof(ValueType)) + (matrix.getRowCount() + numberOfStates + 2) * sizeof(IndexType) + matrix.getRowCount() * sizeof(ValueType) + numberOfStates * sizeof(ValueType);
+                uint64_t const fullPrecisionMemory = sharedMemory + numberOfFullPrecisionIterates * numberOfStates * sizeof(ValueType);
+                if (fullPrecisionMemory <= memoryBudget.get()) {
+                    return false;
+                }
+                uint64_t const mixedPrecisionMemory = sharedMemory + numberOfStates * sizeof(IterateType);
+                STORM_LOG_INFO("Using mixed precision, because the full-precision solver is estimated to need " << fullPrecisionMemory << " bytes, which exceeds the memory budget of " << memoryBudget.get() << " bytes.");
+                STORM_LOG_WARN_COND(mixedPrecisionMemory <= memoryBudget.get(), "Even with mixed precision, the solver is estimated to need " << mixedPrecisionMemory << " bytes, which exceeds the memory budget of " << memoryBudget.get() << " bytes.");
+                return true;
+            }
+
+            template<typename ValueType>
+            template<typename VectorValueType>
+            ValueType MixedPrecisionValueIterationHelper<ValueType>::computeOptimalValueOfState(uint64_t state, std::vector<VectorValueType> const& x, std::vector<ValueType> const& b, bool maximize) const {
+                auto const& rowGroupIndices = matrix.getRowGroupIndices();
+                ValueType result;
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    ValueType rowValue = b[row];
+                    for (auto const& entry : matrix.getRow(row)) {
+                        rowValue += entry.getValue() * static_cast<ValueType>(x[entry.getColumn()]);
+                    }
+                    if (row == rowGroupIndices[state] || (maximize ? rowValue > result : rowValue < result)) {
+                        result = std::move(rowValue);
+                    }
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            bool MixedPrecisionValueIterationHelper<ValueType>::maximizeInState(uint64_t state, storm::solver::OptimizationDirection const& dir, storm::storage::BitVector const* dirOverride) const {
+                bool flip = dirOverride != nullptr && dirOverride->get(state);
+                return flip ? dir == storm::solver::OptimizationDirection::Minimize : dir == storm::solver::OptimizationDirection::Maximize;
+            }
+
+            template class MixedPrecisionValueIterationHelper<double>;
+#ifdef STORM_HAVE_CARL
+            template class MixedPrecisionValueIterationHelper<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/ValuePrecision.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+
+            /*!
+             * The type in which the iterates are stored during the reduced-precision phase of mixed-precision value iteration.
+             * Only doubles are reduced (to floats), all other types are kept.
+             */
+            template<typename ValueType>
+            struct ReducedPrecision {
+                typedef ValueType type;
+            };
+
+            template<>
+            struct ReducedPrecision<double> {
+                typedef float type;
+            };
+
+            /*!
+             * Performs value iteration for min/max equation systems x = min/max (A*x + b) in mixed precision. First, the
+             * iterates are stored in reduced precision (see ReducedPrecision) and updated in place until they converge up to
+             * the resolution of the reduced precision. The products with the matrix are still accumulated in full precision.
+             * Then, the result is corrected by in-place iterations in full precision until the desired precision is reached.
+             * Besides the given vector x, only a single reduced-precision vector is allocated. Compared to regular value
+             * iteration, this saves the full-precision auxiliary iterates and halves the memory traffic of most iterations.
+             * The matrix is not converted, so its values are always used in full precision.
+             */
+            template<typename ValueType>
+            class MixedPrecisionValueIterationHelper {
+            public:
+                typedef typename ReducedPrecision<ValueType>::type IterateType;
+
+                MixedPrecisionValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+                /*!
+                 * Solves the equation system starting from the given x.
+                 *
+                 * @param dirOverride If given, the states whose bit is set are optimized in the direction opposite to dir (as
+                 * for the states of a coalition in games).
+                 * @return the status of the solver and the number of performed iterations.
+                 */
+                std::pair<SolverStatus, uint64_t> solveEquations(std::vector<ValueType>& x, std::vector<ValueType> const& b, storm::solver::OptimizationDirection const& dir, ValueType const& precision, bool relative, uint64_t maximalNumberOfIterations, storm::storage::BitVector const* dirOverride = nullptr) const;
+
+                /*!
+                 * Decides whether mixed precision shall be used for solving an equation system with the given matrix.
+                 *
+                 * @param valuePrecision The selected precision. For Automatic, mixed precision is used iff the memory of the
+                 * matrix, the vectors x and b and the full-precision iterates exceeds the memory budget.
+                 * @param memoryBudget The memory budget in bytes (if any).
+                 * @param numberOfFullPrecisionIterates The number of iterate vectors (besides x) allocated by the solver in full precision.
+                 */
+                static bool isMixedPrecisionSelected(storm::solver::ValuePrecision const& valuePrecision, boost::optional<uint64_t> const& memoryBudget, storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t numberOfFullPrecisionIterates);
+
+            private:
+                /*!
+                 * Computes the optimal value of the row group of the given state wrt. the given iterates.
+                 */
+                template<typename VectorValueType>
+                ValueType computeOptimalValueOfState(uint64_t state, std::vector<VectorValueType> const& x, std::vector<ValueType> const& b, bool maximize) const;
+
+                bool maximizeInState(uint64_t state, storm::solver::OptimizationDirection const& dir, storm::storage::BitVector const* dirOverride) const;
+
+                storm::storage::SparseMatrix<ValueType> const& matrix;
+            };
+
+        }
+    }
+}
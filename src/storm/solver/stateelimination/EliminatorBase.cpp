@@ -1,5 +1,8 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "storm/utility/stateelimination.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/constants.h"
@@ -72,10 +75,13 @@ namespace storm {
                 FlexibleRowType rowsKeepingEntryInColumnEqualRow;
                 
                 // For each entry in the row d, we need to build a list of other rows that will contain an element in the
-                // column d.
-                std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-                for (auto& backwardEntry : newBackwardEntries) {
-                    backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+                // column d. The lists of previous eliminations are reused to keep their storage.
+                if (newBackwardEntries.size() < entriesInRow.size()) {
+                    newBackwardEntries.resize(entriesInRow.size());
+                }
+                for (uint_fast64_t index = 0; index < entriesInRow.size(); ++index) {
+                    newBackwardEntries[index].clear();
+                    newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
                 }
                 
                 // Now go through the rows with an entry in the column corresponding to the current row and substitute
@@ -101,10 +107,11 @@ namespace storm {
                     // First, find the probability with which the predecessor can move to the current state, because
                     // the forward probabilities of the state to be eliminated need to be scaled with this factor.
                     FlexibleRowType& predecessorForwardTransitions = matrix.getRow(predecessor);
-                    FlexibleRowIterator multiplyElement = std::find_if(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == column; });
+                    // As the rows are sorted by column, we can use a binary search.
+                    FlexibleRowIterator multiplyElement = std::lower_bound(predecessorForwardTransitions.begin(), predecessorForwardTransitions.end(), column, [](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a, uint64_t searchedColumn) { return a.getColumn() < searchedColumn; });
                     
                     // Make sure we have found the probability and set it to zero.
-                    STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end(), storm::exceptions::InvalidStateException, "No probability for successor found.");
+                    STORM_LOG_THROW(multiplyElement != predecessorForwardTransitions.end() && multiplyElement->getColumn() == column, storm::exceptions::InvalidStateException, "No probability for successor found.");
                     ValueType multiplyFactor = multiplyElement->getValue();
                     multiplyElement->setValue(storm::utility::zero<ValueType>());
                     
@@ -114,9 +121,9 @@ namespace storm {
                     FlexibleRowIterator first2 = entriesInRow.begin();
                     FlexibleRowIterator last2 = entriesInRow.end();
                     
-                    FlexibleRowType newSuccessors;
-                    newSuccessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+                    rowBuffer.clear();
+                    rowBuffer.reserve((last1 - first1) + (last2 - first2));
+                    std::back_insert_iterator<FlexibleRowType> result(rowBuffer);
                     
                     uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
                     // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -166,7 +173,7 @@ namespace storm {
                     }
                     
                     // Now move the new transitions in place.
-                    predecessorForwardTransitions = std::move(newSuccessors);
+                    predecessorForwardTransitions.swap(rowBuffer);
                     STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
                     
                     updatePredecessor(predecessor, multiplyFactor, row);
@@ -187,8 +194,8 @@ namespace storm {
                     // Delete the current state as a predecessor of the successor state only if we are going to remove the
                     // current state's forward transitions.
                     if (clearRow) {
-                        FlexibleRowIterator elimIt = std::find_if(successorBackwardTransitions.begin(), successorBackwardTransitions.end(), [&](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() == row; });
-                        STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end(), "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
+                        FlexibleRowIterator elimIt = std::lower_bound(successorBackwardTransitions.begin(), successorBackwardTransitions.end(), row, [](storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a, uint64_t searchedColumn) { return a.getColumn() < searchedColumn; });
+                        STORM_LOG_ASSERT(elimIt != successorBackwardTransitions.end() && elimIt->getColumn() == row, "Expected a proper backward transition from " << successorEntry.getColumn() << " to " << column << ", but found none.");
                         successorBackwardTransitions.erase(elimIt);
                     }
                     
@@ -197,9 +204,9 @@ namespace storm {
                     FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
                     FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
                     
-                    FlexibleRowType newPredecessors;
-                    newPredecessors.reserve((last1 - first1) + (last2 - first2));
-                    std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+                    rowBuffer.clear();
+                    rowBuffer.reserve((last1 - first1) + (last2 - first2));
+                    std::back_insert_iterator<FlexibleRowType> result(rowBuffer);
                     
                     for (; first1 != last1; ++result) {
                         if (first2 == last2) {
@@ -230,7 +237,7 @@ namespace storm {
                         std::copy_if(first2, last2, result, [&] (storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type, typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type> const& a) { return a.getColumn() != row; });
                     }
                     // Now move the new predecessors in place.
-                    successorBackwardTransitions = std::move(newPredecessors);
+                    successorBackwardTransitions.swap(rowBuffer);
                     ++successorOffsetInNewBackwardTransitions;
                 }
                 STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "storm/storage/sparse/StateType.h"
 
 #include "storm/storage/FlexibleSparseMatrix.h"
@@ -35,6 +37,12 @@ namespace storm {
             protected:
                 storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+                
+            private:
+                // Buffers that are reused across eliminations to avoid allocating new rows for every merge. A merged row
+                // is swapped with the row it replaces, so the buffer afterwards holds the storage of the old row.
+                FlexibleRowType rowBuffer;
+                std::vector<FlexibleRowType> newBackwardEntries;
             };
             
         } // namespace stateelimination
@@ -16,6 +16,7 @@
 #include "storm/exceptions/OutOfRangeException.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 
 #include <iterator>
 
@@ -2118,6 +2119,7 @@ namespace storm {
 
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, storm::storage::BitVector const* dirOverride) const {
+            STORM_PROFILE_SCOPE("matrix.multiplyAndReduce");
 
             // If the vector and the result are aliases, we need and temporary vector.
             std::vector<ValueType>* target;
@@ -4,6 +4,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/profiling.h"
 #include "storm/utility/Stopwatch.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -154,6 +155,7 @@ namespace storm {
 
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options) {
+            STORM_PROFILE_SCOPE("decomposition.scc");
             
             STORM_LOG_ASSERT(!options.choicesPtr || options.subsystemPtr, "Expecting subsystem if choices are given.");
             
@@ -1,12 +1,16 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/storage/sparse/ModelComponents.h"
+
 #include "storm/utility/graph.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -15,6 +19,36 @@ namespace storm {
         
         using namespace bisimulation;
         
+        namespace {
+            // Retrieves the controlling player of each state if the model is a game and nullptr otherwise.
+            template<typename ModelType>
+            std::vector<storm::storage::PlayerIndex> const* getStatePlayerIndications(ModelType const&) {
+                return nullptr;
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            std::vector<storm::storage::PlayerIndex> const* getStatePlayerIndications(storm::models::sparse::Smg<ValueType, RewardModelType> const& model) {
+                return &model.getStatePlayerIndications();
+            }
+            
+            // Equips the components of the quotient with the players of the representative states if the model is a game.
+            template<typename ModelType>
+            void addPlayerInformation(ModelType const&, storm::storage::sparse::ModelComponents<typename ModelType::ValueType, typename ModelType::RewardModelType>&, std::vector<storm::storage::sparse::state_type> const&) {
+                // Intentionally left empty.
+            }
+            
+            template<typename ValueType, typename RewardModelType>
+            void addPlayerInformation(storm::models::sparse::Smg<ValueType, RewardModelType> const& model, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>& components, std::vector<storm::storage::sparse::state_type> const& representativeStates) {
+                std::vector<storm::storage::PlayerIndex> statePlayerIndications;
+                statePlayerIndications.reserve(representativeStates.size());
+                for (auto representativeState : representativeStates) {
+                    statePlayerIndications.push_back(model.getPlayerOfState(representativeState));
+                }
+                components.statePlayerIndications = std::move(statePlayerIndications);
+                components.playerNameToIndexMap = model.getPlayerNameToIndexMap();
+            }
+        }
+        
         template<typename ModelType>
         NondeterministicModelBisimulationDecomposition<ModelType>::NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>::Options const& options) : BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>(model, model.getTransitionMatrix().transpose(false), options), choiceToStateMapping(model.getNumberOfChoices()), quotientDistributions(model.getNumberOfChoices()), orderedQuotientDistributions(model.getNumberOfChoices()) {
             STORM_LOG_THROW(options.getType() == BisimulationType::Strong, storm::exceptions::IllegalFunctionCallException, "Weak bisimulation is currently not supported for nondeterministic models.");
@@ -23,6 +57,7 @@ namespace storm {
         template<typename ModelType>
         std::pair<storm::storage::BitVector, storm::storage::BitVector> NondeterministicModelBisimulationDecomposition<ModelType>::getStatesWithProbability01() {
             STORM_LOG_THROW(this->options.isOptimizationDirectionSet(), storm::exceptions::IllegalFunctionCallException, "Can only compute states with probability 0/1 with an optimization direction (min/max).");
+            STORM_LOG_THROW(getStatePlayerIndications(this->model) == nullptr, storm::exceptions::NotSupportedException, "Measure-driven initial partitions are not supported for games.");
             if (this->options.getOptimizationDirection() == OptimizationDirection::Minimize) {
                 return storm::utility::graph::performProb01Min(this->model.getTransitionMatrix(), this->model.getTransitionMatrix().getRowGroupIndices(), this->model.getBackwardTransitions(), this->options.phiStates.get(), this->options.psiStates.get());
             } else {
@@ -32,10 +67,25 @@ namespace storm {
         
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::initialize() {
+            this->splitInitialPartitionBasedOnPlayers();
             this->createChoiceToStateMapping();
             this->initializeQuotientDistributions();
         }
         
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::splitInitialPartitionBasedOnPlayers() {
+            std::vector<storm::storage::PlayerIndex> const* statePlayerIndications = getStatePlayerIndications(this->model);
+            if (statePlayerIndications == nullptr) {
+                return;
+            }
+            
+            // States of different players must never be merged, because this would change which player resolves the
+            // nondeterminism. Splitting by player also keeps the coalitions intact.
+            this->partition.split([statePlayerIndications] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                return (*statePlayerIndications)[state1] < (*statePlayerIndications)[state2];
+            });
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -127,6 +177,11 @@ namespace storm {
                 }
             }
             
+            // Keep track of the representative states and choices to map the original model to the quotient.
+            std::vector<storm::storage::sparse::state_type> representativeStates(this->blocks.size());
+            std::vector<uint_fast64_t> quotientRowGroupIndices;
+            std::vector<uint_fast64_t> quotientRowToChoice;
+            
             // Now build (a) and (b) by traversing all blocks.
             uint_fast64_t currentRow = 0;
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -135,6 +190,7 @@ namespace storm {
                 
                 // Open new row group for the new meta state.
                 builder.newRowGroup(currentRow);
+                quotientRowGroupIndices.push_back(currentRow);
                 
                 // Pick one representative state. For strong bisimulation it doesn't matter which state it is, because
                 // they all behave equally.
@@ -144,6 +200,7 @@ namespace storm {
                 // If the block is absorbing, we simply add a self-loop.
                 if (oldBlock.data().absorbing()) {
                     builder.addNextValue(currentRow, blockIndex, storm::utility::one<ValueType>());
+                    quotientRowToChoice.push_back(nondeterministicChoiceIndices[representativeState]);
                     ++currentRow;
                     
                     // If the block has a special representative state, we retrieve it now.
@@ -174,6 +231,7 @@ namespace storm {
                         for (auto entry : quotientDistributions[choice]) {
                             builder.addNextValue(currentRow, entry.first, entry.second);
                         }
+                        quotientRowToChoice.push_back(choice);
                         if (this->options.getKeepRewards() && rewardModel && rewardModel.get().hasStateActionRewards()) {
                             stateActionRewards.get().push_back(quotientDistributions[choice].getReward());
                         }
@@ -194,7 +252,10 @@ namespace storm {
                 if (this->options.getKeepRewards() && rewardModel && rewardModel.get().hasStateRewards()) {
                     stateRewards.get()[blockIndex] = rewardModel.get().getStateRewardVector()[representativeState];
                 }
+                representativeStates[blockIndex] = representativeState;
             }
+            quotientRowGroupIndices.push_back(currentRow);
+            this->createQuotientMappings(quotientRowGroupIndices, quotientRowToChoice);
             
             // Now check which of the blocks of the partition contain at least one initial state.
             for (auto initialState : this->model.getInitialStates()) {
@@ -211,7 +272,53 @@ namespace storm {
             }
             
             // Finally construct the quotient model.
-            this->quotient = std::make_shared<ModelType>(builder.build(0,this->size(), this->size()), std::move(newLabeling), std::move(rewardModels));
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(builder.build(0,this->size(), this->size()), std::move(newLabeling), std::move(rewardModels));
+            addPlayerInformation(this->model, components, representativeStates);
+            this->quotient = std::make_shared<ModelType>(std::move(components));
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::createQuotientMappings(std::vector<uint_fast64_t> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientRowToChoice) {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            quotientStateMapping.resize(this->model.getNumberOfStates());
+            quotientChoiceMapping.resize(this->model.getNumberOfChoices());
+            
+            for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+                bool absorbing = this->partition.getBlock(*this->blocks[blockIndex].begin()).data().absorbing();
+                for (auto state : this->blocks[blockIndex]) {
+                    quotientStateMapping[state] = blockIndex;
+                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                        // Absorbing blocks only have a single (artificial) choice.
+                        if (absorbing) {
+                            quotientChoiceMapping[choice] = quotientRowGroupIndices[blockIndex];
+                            continue;
+                        }
+                        
+                        // As the states of a block are bisimilar, the quotient state has a choice with the same
+                        // distribution over blocks.
+                        uint_fast64_t quotientRow = quotientRowGroupIndices[blockIndex];
+                        for (; quotientRow < quotientRowGroupIndices[blockIndex + 1]; ++quotientRow) {
+                            if (quotientDistributions[quotientRowToChoice[quotientRow]].equals(quotientDistributions[choice], this->comparator)) {
+                                break;
+                            }
+                        }
+                        STORM_LOG_ASSERT(quotientRow < quotientRowGroupIndices[blockIndex + 1], "Unable to find quotient choice for choice " << choice << ".");
+                        quotientChoiceMapping[choice] = quotientRow;
+                    }
+                }
+            }
+        }
+        
+        template<typename ModelType>
+        std::vector<uint_fast64_t> const& NondeterministicModelBisimulationDecomposition<ModelType>::getQuotientStateMapping() const {
+            STORM_LOG_THROW(this->quotient, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve the quotient state mapping before the quotient was built.");
+            return quotientStateMapping;
+        }
+        
+        template<typename ModelType>
+        std::vector<uint_fast64_t> const& NondeterministicModelBisimulationDecomposition<ModelType>::getQuotientChoiceMapping() const {
+            STORM_LOG_THROW(this->quotient, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve the quotient choice mapping before the quotient was built.");
+            return quotientChoiceMapping;
         }
         
         template<typename ModelType>
@@ -426,10 +533,13 @@ namespace storm {
         }
         
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>;
 
 #ifdef STORM_HAVE_CARL
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalNumber>>;
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalFunction>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<storm::RationalNumber>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<storm::RationalFunction>>;
 #endif
     }
 }
@@ -10,7 +10,9 @@ namespace storm {
     namespace storage {
         
         /*!
-         * This class represents the decomposition of a nondeterministic model into its bisimulation quotient.
+         * This class represents the decomposition of a nondeterministic model into its bisimulation quotient. For
+         * stochastic multiplayer games, only states controlled by the same player are considered bisimilar, so the
+         * quotient is again a game with the same players.
          */
         template<typename ModelType>
         class NondeterministicModelBisimulationDecomposition : public BisimulationDecomposition<ModelType, bisimulation::DeterministicBlockData> {
@@ -28,6 +30,23 @@ namespace storm {
              */
             NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, BlockDataType>::Options const& options = typename BisimulationDecomposition<ModelType, BlockDataType>::Options());
             
+            /*!
+             * Retrieves the mapping from the states of the original model to the states of the quotient, i.e., to
+             * their blocks. May only be called after the quotient has been built.
+             *
+             * @return For each state of the original model the index of the corresponding quotient state.
+             */
+            std::vector<uint_fast64_t> const& getQuotientStateMapping() const;
+            
+            /*!
+             * Retrieves the mapping from the choices of the original model to the choices of the quotient, i.e., each
+             * choice is mapped to the quotient choice with the same distribution over blocks. May only be called after
+             * the quotient has been built.
+             *
+             * @return For each choice of the original model the index of the corresponding quotient choice.
+             */
+            std::vector<uint_fast64_t> const& getQuotientChoiceMapping() const;
+            
         protected:
             virtual std::pair<storm::storage::BitVector, storm::storage::BitVector> getStatesWithProbability01() override;
             
@@ -41,6 +60,13 @@ namespace storm {
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
             
+            // Splits the initial partition such that every block only contains states of a single player (if any).
+            void splitInitialPartitionBasedOnPlayers();
+            
+            // Creates the mappings from the states and choices of the original model to the ones of the quotient.
+            // The first row of each quotient state and the representative choice of each quotient row are given.
+            void createQuotientMappings(std::vector<uint_fast64_t> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientRowToChoice);
+            
             // Initializes the quotient distributions wrt. to the current partition.
             void initializeQuotientDistributions();
             
@@ -73,6 +99,11 @@ namespace storm {
             
             // A vector that stores for each state the ordered list of quotient distributions.
             std::vector<storm::storage::DistributionWithReward<ValueType> const*> orderedQuotientDistributions;
+            
+            // Mappings from the states and choices of the original model to the ones of the quotient. They are only
+            // available after the quotient has been built.
+            std::vector<uint_fast64_t> quotientStateMapping;
+            std::vector<uint_fast64_t> quotientChoiceMapping;
         };
     }
 }
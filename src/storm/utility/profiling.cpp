@@ -0,0 +1,348 @@
+#include "storm/utility/profiling.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/io/file.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/OsDetection.h"
+
+namespace storm {
+    namespace utility {
+        namespace profiling {
+            namespace detail {
+                std::atomic<bool> profilingEnabled(false);
+                std::atomic<bool> tracingEnabled(false);
+            }
+
+            namespace {
+                // Bounds the memory consumed by recorded trace events
+                uint64_t const maxTraceEventsPerThread = 1ull << 20;
+
+                struct TimerStatistics {
+                    uint64_t count = 0;
+                    uint64_t totalNanoseconds = 0;
+                    uint64_t maxNanoseconds = 0;
+                };
+
+                struct TraceEvent {
+                    char const* name;
+                    int64_t startNanoseconds;
+                    int64_t durationNanoseconds;
+                };
+
+                struct ThreadData {
+                    uint64_t id;
+                    std::unordered_map<char const*, TimerStatistics> timers;
+                    std::unordered_map<char const*, uint64_t> counters;
+                    std::vector<TraceEvent> traceEvents;
+                    uint64_t droppedTraceEvents = 0;
+                };
+
+                struct Phase {
+                    std::string name;
+                    uint64_t depth;
+                    int64_t startNanoseconds;
+                    int64_t endNanoseconds;
+                    uint64_t residentMemoryAtStart;
+                    uint64_t residentMemoryAtEnd;
+                    uint64_t peakResidentMemoryAtStart;
+                    uint64_t peakResidentMemoryAtEnd;
+                    bool finished;
+                };
+
+                // The data is owned here (and not by the threads) such that measurements of terminated threads are kept.
+                std::mutex registryMutex;
+                std::vector<std::unique_ptr<ThreadData>> threadData;
+                std::vector<Phase> phases;
+                uint64_t currentPhaseDepth = 0;
+                std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+
+                thread_local ThreadData* localThreadData = nullptr;
+
+                ThreadData& getLocalThreadData() {
+                    if (!localThreadData) {
+                        std::lock_guard<std::mutex> lock(registryMutex);
+                        threadData.push_back(std::make_unique<ThreadData>());
+                        threadData.back()->id = threadData.size() - 1;
+                        localThreadData = threadData.back().get();
+                    }
+                    return *localThreadData;
+                }
+
+                int64_t toNanoseconds(std::chrono::steady_clock::time_point const& timePoint) {
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint - origin).count();
+                }
+
+                /*!
+                 * Retrieves the current resident memory in kilobytes (or 0 if not supported on this platform).
+                 */
+                uint64_t getResidentMemory() {
+#ifdef LINUX
+                    std::ifstream statm("/proc/self/statm");
+                    uint64_t size = 0, resident = 0;
+                    if (statm >> size >> resident) {
+                        return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+                    }
+#endif
+                    return 0;
+                }
+
+                /*!
+                 * Retrieves the maximal resident memory so far in kilobytes.
+                 */
+                uint64_t getPeakResidentMemory() {
+#if defined LINUX || defined MACOS
+                    struct rusage ru;
+                    getrusage(RUSAGE_SELF, &ru);
+#ifdef MACOS
+                    // For Mac OS, this is returned in bytes.
+                    return ru.ru_maxrss / 1024;
+#else
+                    // For Linux, this is returned in kilobytes.
+                    return ru.ru_maxrss;
+#endif
+#else
+                    return 0;
+#endif
+                }
+
+                double toMilliseconds(uint64_t nanoseconds) {
+                    return static_cast<double>(nanoseconds) / 1e6;
+                }
+
+                double toMicroseconds(int64_t nanoseconds) {
+                    return static_cast<double>(nanoseconds) / 1e3;
+                }
+
+                storm::json<double> timerToJson(TimerStatistics const& statistics) {
+                    storm::json<double> result;
+                    result["count"] = statistics.count;
+                    result["total-ms"] = toMilliseconds(statistics.totalNanoseconds);
+                    result["max-ms"] = toMilliseconds(statistics.maxNanoseconds);
+                    result["mean-ms"] = statistics.count == 0 ? 0.0 : toMilliseconds(statistics.totalNanoseconds) / statistics.count;
+                    return result;
+                }
+            }
+
+            namespace detail {
+                void addTimerMeasurement(char const* name, std::chrono::steady_clock::time_point const& start, std::chrono::steady_clock::time_point const& end) {
+                    ThreadData& data = getLocalThreadData();
+                    uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+                    TimerStatistics& statistics = data.timers[name];
+                    ++statistics.count;
+                    statistics.totalNanoseconds += duration;
+                    statistics.maxNanoseconds = std::max(statistics.maxNanoseconds, duration);
+                    if (tracingEnabled.load(std::memory_order_relaxed)) {
+                        if (data.traceEvents.size() < maxTraceEventsPerThread) {
+                            data.traceEvents.push_back({name, toNanoseconds(start), static_cast<int64_t>(duration)});
+                        } else {
+                            ++data.droppedTraceEvents;
+                        }
+                    }
+                }
+
+                void addCounterValue(char const* name, uint64_t value) {
+                    getLocalThreadData().counters[name] += value;
+                }
+            }
+
+            void enable(bool trace) {
+                reset();
+                detail::tracingEnabled.store(trace);
+                detail::profilingEnabled.store(true);
+            }
+
+            void disable() {
+                detail::profilingEnabled.store(false);
+                detail::tracingEnabled.store(false);
+            }
+
+            void reset() {
+                std::lock_guard<std::mutex> lock(registryMutex);
+                for (auto& data : threadData) {
+                    data->timers.clear();
+                    data->counters.clear();
+                    data->traceEvents.clear();
+                    data->droppedTraceEvents = 0;
+                }
+                phases.clear();
+                currentPhaseDepth = 0;
+                origin = std::chrono::steady_clock::now();
+            }
+
+            ScopedPhase::ScopedPhase(std::string const& name) : index(0), active(isEnabled()) {
+                if (active) {
+                    std::lock_guard<std::mutex> lock(registryMutex);
+                    index = phases.size();
+                    phases.push_back({name, currentPhaseDepth, toNanoseconds(std::chrono::steady_clock::now()), 0, getResidentMemory(), 0, getPeakResidentMemory(), 0, false});
+                    ++currentPhaseDepth;
+                }
+            }
+
+            ScopedPhase::~ScopedPhase() {
+                if (active) {
+                    std::lock_guard<std::mutex> lock(registryMutex);
+                    // The phases might have been reset in the meantime
+                    if (index < phases.size() && !phases[index].finished) {
+                        Phase& phase = phases[index];
+                        phase.endNanoseconds = toNanoseconds(std::chrono::steady_clock::now());
+                        phase.residentMemoryAtEnd = getResidentMemory();
+                        phase.peakResidentMemoryAtEnd = getPeakResidentMemory();
+                        phase.finished = true;
+                        --currentPhaseDepth;
+                    }
+                }
+            }
+
+            void writeJsonReport(std::ostream& out) {
+                std::lock_guard<std::mutex> lock(registryMutex);
+                storm::json<double> report;
+
+                // Aggregate the data of all threads. Different translation units might use different pointers for the same name, so we merge by name.
+                std::map<std::string, TimerStatistics> timers;
+                std::map<std::string, uint64_t> counters;
+                storm::json<double> threadsJson = storm::json<double>::array();
+                for (auto const& data : threadData) {
+                    if (data->timers.empty() && data->counters.empty()) {
+                        continue;
+                    }
+                    std::map<std::string, TimerStatistics> threadTimers;
+                    for (auto const& timer : data->timers) {
+                        TimerStatistics& threadStatistics = threadTimers[timer.first];
+                        threadStatistics.count += timer.second.count;
+                        threadStatistics.totalNanoseconds += timer.second.totalNanoseconds;
+                        threadStatistics.maxNanoseconds = std::max(threadStatistics.maxNanoseconds, timer.second.maxNanoseconds);
+                        TimerStatistics& statistics = timers[timer.first];
+                        statistics.count += timer.second.count;
+                        statistics.totalNanoseconds += timer.second.totalNanoseconds;
+                        statistics.maxNanoseconds = std::max(statistics.maxNanoseconds, timer.second.maxNanoseconds);
+                    }
+                    std::map<std::string, uint64_t> threadCounters;
+                    for (auto const& counter : data->counters) {
+                        threadCounters[counter.first] += counter.second;
+                        counters[counter.first] += counter.second;
+                    }
+
+                    storm::json<double> threadJson;
+                    threadJson["id"] = data->id;
+                    threadJson["timers"] = storm::json<double>::object();
+                    for (auto const& timer : threadTimers) {
+                        threadJson["timers"][timer.first] = timerToJson(timer.second);
+                    }
+                    threadJson["counters"] = storm::json<double>::object();
+                    for (auto const& counter : threadCounters) {
+                        threadJson["counters"][counter.first] = counter.second;
+                    }
+                    if (data->droppedTraceEvents > 0) {
+                        threadJson["dropped-trace-events"] = data->droppedTraceEvents;
+                    }
+                    threadsJson.push_back(std::move(threadJson));
+                }
+
+                report["timers"] = storm::json<double>::object();
+                for (auto const& timer : timers) {
+                    report["timers"][timer.first] = timerToJson(timer.second);
+                }
+                report["counters"] = storm::json<double>::object();
+                for (auto const& counter : counters) {
+                    report["counters"][counter.first] = counter.second;
+                }
+                report["threads"] = std::move(threadsJson);
+
+                report["phases"] = storm::json<double>::array();
+                for (auto const& phase : phases) {
+                    storm::json<double> phaseJson;
+                    phaseJson["name"] = phase.name;
+                    phaseJson["depth"] = phase.depth;
+                    phaseJson["finished"] = phase.finished;
+                    int64_t end = phase.finished ? phase.endNanoseconds : toNanoseconds(std::chrono::steady_clock::now());
+                    phaseJson["time-ms"] = toMilliseconds(end - phase.startNanoseconds);
+                    phaseJson["resident-memory-start-kb"] = phase.residentMemoryAtStart;
+                    phaseJson["resident-memory-end-kb"] = phase.finished ? phase.residentMemoryAtEnd : getResidentMemory();
+                    uint64_t peakAtEnd = phase.finished ? phase.peakResidentMemoryAtEnd : getPeakResidentMemory();
+                    phaseJson["peak-resident-memory-kb"] = peakAtEnd;
+                    // The peak memory is only known for the whole process. It can thus only be attributed to this phase if it increased during the phase.
+                    phaseJson["raised-peak-memory"] = peakAtEnd > phase.peakResidentMemoryAtStart;
+                    report["phases"].push_back(std::move(phaseJson));
+                }
+                report["peak-resident-memory-kb"] = getPeakResidentMemory();
+
+                out << report.dump(4) << std::endl;
+            }
+
+            void writeChromeTrace(std::ostream& out) {
+                STORM_LOG_WARN_COND(detail::tracingEnabled.load(), "Writing a trace although tracing is not enabled. The trace will not contain timer events.");
+                std::lock_guard<std::mutex> lock(registryMutex);
+                storm::json<double> events = storm::json<double>::array();
+                for (auto const& data : threadData) {
+                    for (auto const& traceEvent : data->traceEvents) {
+                        storm::json<double> event;
+                        event["name"] = std::string(traceEvent.name);
+                        event["ph"] = "X";
+                        event["ts"] = toMicroseconds(traceEvent.startNanoseconds);
+                        event["dur"] = toMicroseconds(traceEvent.durationNanoseconds);
+                        event["pid"] = 0;
+                        event["tid"] = data->id;
+                        events.push_back(std::move(event));
+                    }
+                }
+                // Phases are shown on a separate track together with the memory consumption
+                for (auto const& phase : phases) {
+                    int64_t end = phase.finished ? phase.endNanoseconds : toNanoseconds(std::chrono::steady_clock::now());
+                    storm::json<double> event;
+                    event["name"] = phase.name;
+                    event["ph"] = "X";
+                    event["ts"] = toMicroseconds(phase.startNanoseconds);
+                    event["dur"] = toMicroseconds(end - phase.startNanoseconds);
+                    event["pid"] = 1;
+                    event["tid"] = 0;
+                    events.push_back(std::move(event));
+
+                    storm::json<double> memoryStart;
+                    memoryStart["name"] = "resident memory (kb)";
+                    memoryStart["ph"] = "C";
+                    memoryStart["ts"] = toMicroseconds(phase.startNanoseconds);
+                    memoryStart["pid"] = 1;
+                    memoryStart["args"]["resident"] = phase.residentMemoryAtStart;
+                    events.push_back(std::move(memoryStart));
+                    if (phase.finished) {
+                        storm::json<double> memoryEnd;
+                        memoryEnd["name"] = "resident memory (kb)";
+                        memoryEnd["ph"] = "C";
+                        memoryEnd["ts"] = toMicroseconds(phase.endNanoseconds);
+                        memoryEnd["pid"] = 1;
+                        memoryEnd["args"]["resident"] = phase.residentMemoryAtEnd;
+                        events.push_back(std::move(memoryEnd));
+                    }
+                }
+
+                storm::json<double> trace;
+                trace["traceEvents"] = std::move(events);
+                trace["displayTimeUnit"] = "ms";
+                out << trace.dump() << std::endl;
+            }
+
+            void exportReports(std::string const& reportFilename, std::string const& traceFilename) {
+                if (!reportFilename.empty()) {
+                    std::ofstream stream;
+                    storm::utility::openFile(reportFilename, stream);
+                    writeJsonReport(stream);
+                    storm::utility::closeFile(stream);
+                }
+                if (!traceFilename.empty()) {
+                    std::ofstream stream;
+                    storm::utility::openFile(traceFilename, stream);
+                    writeChromeTrace(stream);
+                    storm::utility::closeFile(stream);
+                }
+            }
+        }
+    }
+}
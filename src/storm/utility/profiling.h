@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace storm {
+    namespace utility {
+        namespace profiling {
+
+            /*!
+             * Lightweight instrumentation of hot code paths. The instrumentation is always compiled, but all probes are no-ops (apart from
+             * checking a flag) unless profiling is enabled. Measurements are aggregated per thread and merged when a report is written.
+             *
+             * Timers and counters are identified by their name, which is expected to be a string literal (or otherwise outlive the profiler).
+             */
+
+            namespace detail {
+                extern std::atomic<bool> profilingEnabled;
+                extern std::atomic<bool> tracingEnabled;
+
+                void addTimerMeasurement(char const* name, std::chrono::steady_clock::time_point const& start, std::chrono::steady_clock::time_point const& end);
+                void addCounterValue(char const* name, uint64_t value);
+            }
+
+            /*!
+             * Enables profiling and resets all previous measurements.
+             *
+             * @param trace If true, each individual timer measurement is recorded such that a trace (in the Chrome trace-event format) can be written.
+             */
+            void enable(bool trace = false);
+
+            /*!
+             * Disables profiling. Measurements that were already taken are kept.
+             */
+            void disable();
+
+            /*!
+             * Retrieves whether profiling is enabled.
+             */
+            inline bool isEnabled() {
+                return detail::profilingEnabled.load(std::memory_order_relaxed);
+            }
+
+            /*!
+             * Discards all measurements.
+             * Should only be called if no instrumented code is executed concurrently.
+             */
+            void reset();
+
+            /*!
+             * Adds the given value to the counter with the given name.
+             */
+            inline void addToCounter(char const* name, uint64_t value = 1) {
+                if (isEnabled()) {
+                    detail::addCounterValue(name, value);
+                }
+            }
+
+            /*!
+             * Measures the time between construction and destruction and adds it to the timer with the given name.
+             */
+            class ScopedTimer {
+            public:
+                explicit ScopedTimer(char const* name) : name(isEnabled() ? name : nullptr) {
+                    if (this->name) {
+                        start = std::chrono::steady_clock::now();
+                    }
+                }
+
+                ~ScopedTimer() {
+                    if (name) {
+                        detail::addTimerMeasurement(name, start, std::chrono::steady_clock::now());
+                    }
+                }
+
+                ScopedTimer(ScopedTimer const&) = delete;
+                ScopedTimer& operator=(ScopedTimer const&) = delete;
+
+            private:
+                char const* name;
+                std::chrono::steady_clock::time_point start;
+            };
+
+            /*!
+             * Marks a (coarse) phase of the computation such as model building or model checking.
+             * In addition to the time, the resident memory at the start and the end of the phase as well as the memory high-water mark are recorded.
+             * Phases should not be used in hot code as querying the memory consumption involves system calls.
+             */
+            class ScopedPhase {
+            public:
+                explicit ScopedPhase(std::string const& name);
+                ~ScopedPhase();
+
+                ScopedPhase(ScopedPhase const&) = delete;
+                ScopedPhase& operator=(ScopedPhase const&) = delete;
+
+            private:
+                uint64_t index;
+                bool active;
+            };
+
+            /*!
+             * Writes the aggregated measurements (per timer, counter, thread and phase) in JSON format to the given stream.
+             * Should only be called if no instrumented code is executed concurrently.
+             */
+            void writeJsonReport(std::ostream& out);
+
+            /*!
+             * Writes the recorded measurements in the Chrome trace-event format to the given stream.
+             * Requires that profiling was enabled with tracing.
+             * Should only be called if no instrumented code is executed concurrently.
+             */
+            void writeChromeTrace(std::ostream& out);
+
+            /*!
+             * Writes the JSON report and (if tracing is enabled) the trace to the given files.
+             */
+            void exportReports(std::string const& reportFilename, std::string const& traceFilename = "");
+        }
+    }
+}
+
+#define STORM_PROFILE_CONCAT_INNER(a, b) a ## b
+#define STORM_PROFILE_CONCAT(a, b) STORM_PROFILE_CONCAT_INNER(a, b)
+
+/*!
+ * Measures the time spent in the current scope.
+ */
+#define STORM_PROFILE_SCOPE(name) storm::utility::profiling::ScopedTimer STORM_PROFILE_CONCAT(stormProfilingScopedTimer, __LINE__)(name)
+
+/*!
+ * Marks the current scope as a phase of the computation (also recording the memory consumption).
+ */
+#define STORM_PROFILE_PHASE(name) storm::utility::profiling::ScopedPhase STORM_PROFILE_CONCAT(stormProfilingScopedPhase, __LINE__)(name)
+
+/*!
+ * Adds the given value to the given counter.
+ */
+#define STORM_PROFILE_COUNT(name, value) storm::utility::profiling::addToCounter(name, value)
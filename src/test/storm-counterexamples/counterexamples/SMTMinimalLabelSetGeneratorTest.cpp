@@ -0,0 +1,51 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_Z3
+
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/storm.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+TEST(SMTMinimalLabelSetGeneratorTest, UnreachableTargetCandidate) {
+    // The first and the last command are guaranteed to be part of every counterexample. However, only the set of all four
+    // relevant commands exceeds the threshold.
+    std::string programAsString = R"(mdp
+module m
+    s : [0..4] init 0;
+    [] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=2);
+    [] s=1 -> (s'=3);
+    [] s=2 -> (s'=3);
+    [] s=3 -> (s'=4);
+    [] s=4 -> (s'=4);
+endmodule
+label "target" = s=4;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programAsString, "cex.nm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P<=0.6 [F \"target\"]", program));
+    storm::builder::BuilderOptions builderOptions(formulas);
+    builderOptions.setBuildChoiceOrigins(true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, builderOptions).build();
+
+    storm::Environment env;
+    storm::storage::SymbolicModelDescription symbolicModel(program);
+    typedef storm::counterexamples::SMTMinimalLabelSetGenerator<double> Generator;
+    Generator::Options options(true);
+    options.silent = true;
+    // Without the backward implication cuts, the solver first proposes the two guaranteed commands, from which the target
+    // is unreachable. This candidate is rejected by the graph search alone.
+    options.addBackwardImplicationCuts = false;
+    Generator::GeneratorStats stats;
+    auto labelSets = Generator::computeCounterexampleLabelSet(env, stats, symbolicModel, *model, Generator::precompute(env, symbolicModel, *model, formulas.front()), {}, options);
+
+    ASSERT_EQ(1ull, labelSets.size());
+    EXPECT_EQ(4ull, labelSets.front().size());
+    EXPECT_EQ(1ull, stats.skippedModelChecks);
+}
+
+#endif /* STORM_HAVE_Z3 */
@@ -0,0 +1,154 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseMdpInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> createValuations(std::set<storm::RationalFunctionVariable> const& parameters, uint64_t numberOfValuations) {
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> result;
+        for (uint64_t i = 0; i < numberOfValuations; ++i) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            uint64_t offset = 0;
+            for (auto const& parameter : parameters) {
+                double value = 0.2 + 0.6 * ((i + offset) % numberOfValuations) / (numberOfValuations - 1);
+                valuation.emplace(parameter, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+                offset += 3;
+            }
+            result.push_back(std::move(valuation));
+        }
+        return result;
+    }
+
+    class SparseBatchInstantiationModelCheckerTest : public ::testing::Test {
+    protected:
+        SparseBatchInstantiationModelCheckerTest() {
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        }
+        virtual void SetUp() { carl::VariablePool::getInstance().clear(); }
+        virtual void TearDown() { carl::VariablePool::getInstance().clear(); }
+        storm::Environment env;
+    };
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Prob) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P=? [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto valuations = createValuations(storm::models::sparse::getProbabilityParameters(*model), 16);
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> checker(*model);
+        checker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        EXPECT_FALSE(checker.checksBatchJointly(env));
+        checker.setInstantiationsAreGraphPreserving(true);
+        EXPECT_TRUE(checker.checksBatchJointly(env));
+
+        auto batchResults = checker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        uint64_t initialState = *model->getInitialStates().begin();
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            double expected = checker.check(env, valuations[i])->asExplicitQuantitativeCheckResult<double>()[initialState];
+            EXPECT_NEAR(expected, batchResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-8);
+        }
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Prob_Bound) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto valuations = createValuations(storm::models::sparse::getProbabilityParameters(*model), 8);
+
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber> checker(*model);
+        checker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        checker.setInstantiationsAreGraphPreserving(true);
+
+        auto batchResults = checker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        uint64_t initialState = *model->getInitialStates().begin();
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            EXPECT_EQ(checker.check(env, valuations[i])->asExplicitQualitativeCheckResult()[initialState], batchResults[i]->asExplicitQualitativeCheckResult()[initialState]);
+        }
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, Brp_Prob_Exact) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+        std::string formulaAsString = "P=? [F s=5 ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+        auto valuations = createValuations(storm::models::sparse::getProbabilityParameters(*model), 4);
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        // Exact values are not approximated by the batch computation.
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber> exactChecker(*model);
+        exactChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        exactChecker.setInstantiationsAreGraphPreserving(true);
+        EXPECT_FALSE(exactChecker.checksBatchJointly(env));
+        auto exactResults = exactChecker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), exactResults.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            EXPECT_EQ(exactChecker.check(env, valuations[i])->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState], exactResults[i]->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState]);
+        }
+
+        // Neither are the results in a sound environment.
+        storm::Environment soundEnv = env;
+        soundEnv.solver().setForceSoundness(true);
+        storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> soundChecker(*model);
+        soundChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        soundChecker.setInstantiationsAreGraphPreserving(true);
+        EXPECT_FALSE(soundChecker.checksBatchJointly(soundEnv));
+        auto soundResults = soundChecker.checkBatch(soundEnv, valuations);
+        ASSERT_EQ(valuations.size(), soundResults.size());
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            EXPECT_EQ(soundChecker.check(soundEnv, valuations[i])->asExplicitQuantitativeCheckResult<double>()[initialState], soundResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState]);
+        }
+    }
+
+    TEST_F(SparseBatchInstantiationModelCheckerTest, Coin_Prob) {
+        std::string programFile = STORM_TEST_RESOURCES_DIR "/pmdp/coin2_2.nm";
+        std::string formulaAsString = "Pmin=? [F \"all_coins_equal_1\" ]";
+
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        std::shared_ptr<storm::models::sparse::Mdp<storm::RationalFunction>> model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalFunction>>();
+        auto valuations = createValuations(storm::models::sparse::getProbabilityParameters(*model), 16);
+
+        storm::modelchecker::SparseMdpInstantiationModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double> checker(*model, false);
+        checker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formulas[0], false));
+        checker.setInstantiationsAreGraphPreserving(true);
+
+        auto batchResults = checker.checkBatch(env, valuations);
+        ASSERT_EQ(valuations.size(), batchResults.size());
+        uint64_t initialState = *model->getInitialStates().begin();
+        for (uint64_t i = 0; i < valuations.size(); ++i) {
+            double expected = checker.check(env, valuations[i])->asExplicitQuantitativeCheckResult<double>()[initialState];
+            EXPECT_NEAR(expected, batchResults[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+        }
+    }
+}
+
+#endif
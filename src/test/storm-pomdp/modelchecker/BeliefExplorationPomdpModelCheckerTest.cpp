@@ -108,6 +108,27 @@ namespace {
         static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {options.refine = true; options.refinePrecision = precision();}
     };
 
+    class CachedRefineDoubleVIEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+        static bool const isExactModelChecking = false;
+        static ValueType precision() { return storm::utility::convertNumber<ValueType>(0.005); }
+        static PreprocessingType const preprocessingType = PreprocessingType::None;
+        static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+            options.refine = true;
+            options.refinePrecision = precision();
+            // Use a small cache so that it also gets cleared during the refinement
+            options.cacheBeliefExpansions = true;
+            options.beliefExpansionCacheSize = 50;
+        }
+    };
+
     class PreprocessedRefineDoubleVIEnvironment {
     public:
         typedef double ValueType;
@@ -240,6 +261,7 @@ namespace {
             PreprocessedDefaultDoubleVIEnvironment,
             FineDoubleVIEnvironment,
             RefineDoubleVIEnvironment,
+            CachedRefineDoubleVIEnvironment,
             PreprocessedRefineDoubleVIEnvironment,
             DefaultDoubleOVIEnvironment,
             DefaultRationalPIEnvironment,
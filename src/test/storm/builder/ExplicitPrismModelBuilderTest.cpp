@@ -4,8 +4,11 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/logic/Formulas.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -213,3 +216,115 @@ TEST(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.addSymmetricModules({"die1", "die2"});
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    // The 13 * 13 states are reduced to the unordered pairs of local states.
+    EXPECT_EQ(91ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+    EXPECT_EQ(21ul, model->getStates("done").getNumberOfSetBits());
+
+    storm::generator::NextStateGeneratorOptions illegalOptions;
+    illegalOptions.addSymmetricModules({"die1", "die3"});
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, illegalOptions).build(), storm::exceptions::InvalidArgumentException);
+
+    // Labels that distinguish the symmetric modules are rejected, symmetric rewards are accepted.
+    storm::generator::NextStateGeneratorOptions asymmetricLabelOptions;
+    asymmetricLabelOptions.addLabel(program.getManager().getVariableExpression("d1") == program.getManager().integer(1));
+    asymmetricLabelOptions.addSymmetricModules({"die1", "die2"});
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, asymmetricLabelOptions).build(), storm::exceptions::InvalidArgumentException);
+    storm::parser::FormulaParser formulaParser(program);
+    storm::generator::NextStateGeneratorOptions asymmetricRewardOptions(*formulaParser.parseSingleFormulaFromString("R{\"coinflips\"}max=? [F \"done\"]"));
+    asymmetricRewardOptions.addSymmetricModules({"die1", "die2"});
+    EXPECT_NO_THROW(storm::builder::ExplicitModelBuilder<double>(program, asymmetricRewardOptions).build());
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReductionOfAsymmetricCommands) {
+    std::string programAsString = R"(mdp
+module m1
+    x1 : [0..2] init 0;
+    [] x1=0 -> 0.5 : (x1'=1) + 0.5 : (x1'=2);
+    [] x1>0 & x2>0 -> (x1'=0);
+endmodule
+module m2
+    x2 : [0..2] init 0;
+    [] x2=0 -> 0.5 : (x2'=1) + 0.5 : (x2'=2);
+    [] x2>0 & x1>1 -> (x2'=0);
+endmodule
+module m3 = m1 [ x1=x3, x2=x1 ] endmodule
+module m4 = m1 [ x1=x4, x2=x1 ] endmodule
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programAsString, "asymmetric.nm");
+
+    // The renamed modules m3 and m4 are symmetric, whereas the guard of m2 is not the swapped guard of m1.
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.addSymmetricModules({"m3", "m4"});
+    EXPECT_NO_THROW(storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build());
+
+    storm::generator::NextStateGeneratorOptions asymmetricOptions;
+    asymmetricOptions.addSymmetricModules({"m1", "m2"});
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, asymmetricOptions).build(), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReductionOfPlayers) {
+    std::string programAsString = R"(smg
+player p1 m1 endplayer
+player p2 m2 endplayer
+player p3 m3 endplayer
+module m1
+    x1 : [0..1] init 0;
+    [] x1=0 -> (x1'=1);
+endmodule
+module m2 = m1 [ x1=x2 ] endmodule
+module m3
+    y : [0..1] init 0;
+    [] y=0 -> (y'=1);
+endmodule
+label "goal" = x1=1 & x2=1;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programAsString, "players.nm");
+    storm::parser::FormulaParser formulaParser(program);
+
+    // Both symmetric players are in the coalition.
+    storm::generator::NextStateGeneratorOptions generatorOptions(*formulaParser.parseSingleFormulaFromString("<<p1, p2>> Pmax=? [F \"goal\"]"));
+    generatorOptions.addSymmetricModules({"p1", "p2"});
+    EXPECT_NO_THROW(storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build());
+
+    // Swapping the players would change the owner of states to a player outside of the coalition.
+    storm::generator::NextStateGeneratorOptions illegalOptions(*formulaParser.parseSingleFormulaFromString("<<p1>> Pmax=? [F \"goal\"]"));
+    illegalOptions.addSymmetricModules({"p1", "p2"});
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, illegalOptions).build(), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    std::string programAsString = R"(mdp
+module worker
+    w : [0..3] init 0;
+    [] w<3 -> (w'=w+1);
+endmodule
+module main
+    x : [0..2] init 0;
+    [] x=0 -> 0.5 : (x'=1) + 0.5 : (x'=2);
+    [] x=0 -> (x'=2);
+endmodule
+label "goal" = x=1;
+)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programAsString, "por.nm");
+    storm::parser::FormulaParser formulaParser(program);
+
+    // The steps of the worker are independent of the main module and invisible, so they are not interleaved.
+    storm::generator::NextStateGeneratorOptions generatorOptions(*formulaParser.parseSingleFormulaFromString("Pmax=? [F \"goal\"]"));
+    generatorOptions.setPartialOrderReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(6ul, model->getNumberOfStates());
+
+    // Step-bounded properties are not preserved, so the reduction must not be applied.
+    generatorOptions = storm::generator::NextStateGeneratorOptions(*formulaParser.parseSingleFormulaFromString("Pmax=? [F<=2 \"goal\"]"));
+    generatorOptions.setPartialOrderReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(12ul, model->getNumberOfStates());
+}
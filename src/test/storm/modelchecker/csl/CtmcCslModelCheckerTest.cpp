@@ -18,12 +18,14 @@
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
@@ -553,4 +555,64 @@ namespace {
         }
 
     }
+
+    TEST(SparseCtmcCslHelperTest, MultipleTimeBounds) {
+        // State 0 moves to the absorbing state 1 with rate 1, so the probability to reach state 1 within time t is 1 - exp(-t).
+        storm::storage::SparseMatrixBuilder<double> builder(2, 2);
+        builder.addNextValue(0, 1, 1.0);
+        storm::storage::SparseMatrix<double> rateMatrix = builder.build();
+        std::vector<double> exitRates = {1.0, 0.0};
+        storm::storage::BitVector allStates(2, true);
+        storm::storage::BitVector targetStates(2, false);
+        targetStates.set(1);
+        std::vector<double> timeBounds = {0.0, 0.5, 1.0, 2.0, 10.0};
+
+        storm::Environment env;
+        auto results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(env, rateMatrix, rateMatrix.transpose(), allStates, targetStates, exitRates, timeBounds);
+        ASSERT_EQ(timeBounds.size(), results.size());
+        for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+            EXPECT_NEAR(1.0 - std::exp(-timeBounds[boundIndex]), results[boundIndex][0], 1e-6);
+            EXPECT_NEAR(1.0, results[boundIndex][1], 1e-6);
+        }
+
+        // Reference values for the tandem queueing network.
+        std::string formulasString = "P=? [ F<=10 \"network_full\" ]";
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/ctmc/tandem5.sm", true);
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto ctmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Ctmc<double>>();
+        storm::storage::BitVector allCtmcStates(ctmc->getNumberOfStates(), true);
+        std::vector<double> ctmcTimeBounds = {0.0, 10.0};
+        results = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesForTimeBounds(env, ctmc->getTransitionMatrix(), ctmc->getBackwardTransitions(), allCtmcStates, ctmc->getStates("network_full"), ctmc->getExitRateVector(), ctmcTimeBounds);
+        ASSERT_EQ(2ul, results.size());
+        uint64_t initialState = *ctmc->getInitialStates().begin();
+        EXPECT_NEAR(0.0, results[0][initialState], 1e-6);
+        EXPECT_NEAR(0.015446370562428037, results[1][initialState], 1e-6);
+    }
+
+    TEST(SparseCtmcCslHelperTest, TransientProbabilitiesForSeveralVectors) {
+        // The uniformized matrix (with rate 2) of the CTMC in which state 0 moves to the absorbing state 1 with rate 1.
+        storm::storage::SparseMatrixBuilder<double> builder(2, 2);
+        builder.addNextValue(0, 0, 0.5);
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(1, 1, 1.0);
+        storm::storage::SparseMatrix<double> uniformizedMatrix = builder.build();
+        std::vector<double> timeBounds = {1.0, 3.0};
+        std::vector<std::vector<double>> values = {{0.0, 1.0}, {1.0, 0.0}};
+
+        storm::Environment env;
+        storm::Environment soundEnv;
+        soundEnv.solver().setForceSoundness(true);
+        for (auto const& environment : {env, soundEnv}) {
+            auto results = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilitiesForTimeBounds(environment, uniformizedMatrix, nullptr, timeBounds, 2.0, values, 1e-10);
+            ASSERT_EQ(4ul, results.size());
+            for (uint64_t boundIndex = 0; boundIndex < timeBounds.size(); ++boundIndex) {
+                // Being in state 1 at time t.
+                EXPECT_NEAR(1.0 - std::exp(-timeBounds[boundIndex]), results[boundIndex * 2][0], 1e-8);
+                EXPECT_NEAR(1.0, results[boundIndex * 2][1], 1e-8);
+                // Being in state 0 at time t.
+                EXPECT_NEAR(std::exp(-timeBounds[boundIndex]), results[boundIndex * 2 + 1][0], 1e-8);
+                EXPECT_NEAR(0.0, results[boundIndex * 2 + 1][1], 1e-8);
+            }
+        }
+    }
 }
@@ -1,16 +1,23 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <cstdio>
+#include <boost/filesystem.hpp>
+
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/api/export.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm-parsers/parser/FormulaParser.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ExplorationSettings.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/PreSchedulerChoice.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 TEST(SparseExplorationModelCheckerTest, Dice) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
@@ -86,3 +93,118 @@ TEST(SparseExplorationModelCheckerTest, AsynchronousLeader) {
     
     EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
 }
+
+TEST(SparseExplorationModelCheckerTest, Walker) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t> checker(program);
+    
+    // The blocker can prevent reaching s3 from s4 by staying there forever.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F \"s3\"]");
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    task.setShieldingExpression(std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+    ASSERT_TRUE(checker.canHandle(task));
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(task);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0.34545435, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    EXPECT_TRUE(quantitativeResult1.hasShield());
+    
+    // The shield refers to the explored states, for which there is no model. Hence, it can only be exported in the textual format.
+    auto shield = quantitativeResult1.getShield();
+    std::string filename = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("walker_exploration_shield-%%%%-%%%%")).string();
+    STORM_SILENT_EXPECT_THROW(storm::api::exportShield(std::shared_ptr<storm::models::sparse::Model<double>>(), shield, filename + ".json"), storm::exceptions::NotSupportedException);
+    EXPECT_NO_THROW(storm::api::exportShield(std::shared_ptr<storm::models::sparse::Model<double>>(), shield, filename + ".shield"));
+    std::remove((filename + ".json").c_str());
+    std::remove((filename + ".shield").c_str());
+    
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmin=? [F \"s3\"]");
+    
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    
+    // Without a coalition, the property cannot be checked on a game.
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"s3\"]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+}
+
+TEST(SparseExplorationModelCheckerTest, MixedEndComponent) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/mixedEndComponent.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t> checker(program);
+    
+    // The end component of the maxer and the miner needs to be deflated, as the miner keeps the play in it.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<maxer>> Pmax=? [F \"target\"]");
+    ASSERT_TRUE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0.5, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    
+    // If the miner helps, the target is reached almost surely.
+    formula = formulaParser.parseSingleFormulaFromString("<<maxer, miner>> Pmax=? [F \"target\"]");
+    
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(1, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+}
+
+TEST(SparseExplorationModelCheckerTest, WalkerStepBounded) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser;
+    
+    storm::modelchecker::SparseExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t> checker(program);
+    
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F<=2 \"s3\"]");
+    ASSERT_TRUE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0.24, quantitativeResult1[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F<=3 \"s3\"]");
+    
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0.272, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    
+    // The walker can avoid s4 by staying in s0, so the shield only covers s0 and does not enable the risky choice.
+    uint64_t numberOfEmittedStates = 0;
+    checker.setShieldCallback([&numberOfEmittedStates] (storm::generator::CompressedState const&, storm::storage::PreSchedulerChoice<double> const& choice) {
+        ++numberOfEmittedStates;
+        ASSERT_EQ(1ull, choice.getChoiceMap().size());
+        EXPECT_NEAR(0, std::get<0>(choice.getChoiceMap().front()), storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    });
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmin=? [F<=2 \"s4\"]");
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    task.setShieldingExpression(std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+    
+    result = checker.check(task);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult3 = result->asExplicitQuantitativeCheckResult<double>();
+    
+    EXPECT_NEAR(0, quantitativeResult3[0], storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+    EXPECT_TRUE(quantitativeResult3.hasShield());
+    EXPECT_EQ(1ull, numberOfEmittedStates);
+    
+    // Lower bounds are not supported.
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F[1,2] \"s3\"]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+    EXPECT_THROW(checker.check(storm::modelchecker::CheckTask<>(*formula, true)), storm::exceptions::NotSupportedException);
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F>=1 \"s3\"]");
+    EXPECT_FALSE(checker.canHandle(storm::modelchecker::CheckTask<>(*formula, true)));
+}
@@ -5,6 +5,7 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
@@ -98,6 +99,52 @@ TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_large
 }
 
 
+TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_one_dim_walk_epoch_levels) {
+    storm::Environment env;
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm";
+    std::string constantsDef = "N=10";
+    std::string formulasAsString = "Pmax=? [ multi( F{\"r\"}<=5 x=N, F{\"l\"}<=10 x=0 )]";
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, constantsDef);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<storm::RationalNumber>> mdp = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Mdp<storm::RationalNumber>>();
+    
+    typedef storm::modelchecker::helper::rewardbounded::MultiDimensionalRewardUnfolding<storm::RationalNumber, true> RewardUnfolding;
+    RewardUnfolding rewardUnfolding(*mdp, std::static_pointer_cast<storm::logic::OperatorFormula const>(formulas[0]));
+    auto initEpoch = rewardUnfolding.getStartEpoch();
+    auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    auto epochLevels = rewardUnfolding.getEpochComputationLevels(initEpoch);
+    
+    // Every epoch occurs in exactly one level and independent epochs share a level.
+    std::set<RewardUnfolding::Epoch> levelEpochs;
+    uint64_t numberOfLevelEpochs = 0;
+    for (auto const& level : epochLevels) {
+        levelEpochs.insert(level.begin(), level.end());
+        numberOfLevelEpochs += level.size();
+    }
+    EXPECT_EQ(epochOrder.size(), numberOfLevelEpochs);
+    EXPECT_EQ(std::set<RewardUnfolding::Epoch>(epochOrder.begin(), epochOrder.end()), levelEpochs);
+    EXPECT_LT(epochLevels.size(), epochOrder.size());
+    ASSERT_EQ(1ull, epochLevels.back().size());
+    EXPECT_EQ(initEpoch, epochLevels.back().front());
+    
+    uint64_t const numberOfWorkers = 3;
+    std::vector<std::vector<storm::RationalNumber>> x(numberOfWorkers), b(numberOfWorkers);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<storm::RationalNumber>>> solvers(numberOfWorkers);
+    auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
+    auto upperBound = rewardUnfolding.getUpperObjectiveBound();
+    uint64_t numberOfAnalyzedEpochs = 0;
+    rewardUnfolding.analyzeEpochLevels(epochLevels, numberOfWorkers, [&](storm::modelchecker::helper::rewardbounded::EpochModel<storm::RationalNumber, true>& epochModel, uint64_t worker) {
+        return epochModel.analyzeSingleObjective(env, storm::OptimizationDirection::Maximize, x[worker], b[worker], solvers[worker], lowerBound, upperBound);
+    }, [&](RewardUnfolding::Epoch const&) { ++numberOfAnalyzedEpochs; });
+    EXPECT_EQ(epochOrder.size(), numberOfAnalyzedEpochs);
+    storm::RationalNumber expectedResult = storm::utility::pow(storm::utility::convertNumber<storm::RationalNumber>(0.5), 15);
+    EXPECT_EQ(expectedResult, rewardUnfolding.getInitialStateResult(initEpoch));
+}
+
 TEST(SparseMdpMultiDimensionalRewardUnfoldingTest, single_obj_tiny_ec) {
     storm::Environment env;
     
@@ -12,6 +12,8 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/storage/geometry/Polytope.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
@@ -430,4 +432,41 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, resource_gathering) {
     }
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra_weightbatch) {
+    if (!storm::test::z3AtLeastVersion(4,8,5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    storm::Environment env;
+    env.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+    storm::Environment batchEnv = env;
+    batchEnv.modelchecker().multi().setWeightVectorBatchSize(3);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_simple_lra.nm";
+    std::string formulasAsString  = "multi(R{\"first\"}max=? [ LRA ], R{\"second\"}max=? [ LRA ]);\n"; // pareto
+    formulasAsString += "multi(R{\"first\"}min=? [ C ], R{\"second\"}max=? [ LRA ], R{\"third\"}max=? [ C ]);\n"; // pareto
+    
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    storm::generator::NextStateGeneratorOptions options(formulas);
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+#ifdef STORM_HAVE_INTELTBB
+    // The weight vectors of a batch are only checked concurrently if TBB is enabled.
+    std::unique_ptr<storm::settings::SettingMemento> useIntelTbb = storm::settings::mutableCoreSettings().overrideIntelTbbSet(true);
+#endif
+
+    // The Pareto curve obtained with batches of weight vectors coincides with the one obtained by checking them one by one.
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formula->asMultiObjectiveFormula());
+        std::unique_ptr<storm::modelchecker::CheckResult> batchResult = storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(batchEnv, *mdp, formula->asMultiObjectiveFormula());
+        ASSERT_TRUE(sequentialResult->isExplicitParetoCurveCheckResult());
+        ASSERT_TRUE(batchResult->isExplicitParetoCurveCheckResult());
+        double eps = 1e-4;
+        EXPECT_TRUE(expectSubset(batchResult->asExplicitParetoCurveCheckResult<double>().getPoints(), sequentialResult->asExplicitParetoCurveCheckResult<double>().getPoints(), eps)) << "Non-Pareto point found.";
+        EXPECT_TRUE(expectSubset(sequentialResult->asExplicitParetoCurveCheckResult<double>().getPoints(), batchResult->asExplicitParetoCurveCheckResult<double>().getPoints(), eps)) << "Pareto point missing.";
+    }
+}
+
 #endif /* STORM_HAVE_HYPRO || defined STORM_HAVE_Z3_OPTIMIZE */
@@ -141,6 +141,12 @@ namespace {
     this->getStringsToCompare(filename, shieldingString, compareFileString);
     EXPECT_EQ(shieldingString, compareFileString);
 
+    // Exporting the (already constructed) shield to several files at once yields the same shield.
+    storm::api::exportShield<ValueType>(mdp, result->template asExplicitQuantitativeCheckResult<ValueType>().getShield() , std::vector<std::string>({filename + ".shield", filename + ".json"}));
+    this->getStringsToCompare(filename, shieldingString, compareFileString);
+    EXPECT_EQ(shieldingString, compareFileString);
+    std::remove((filename + ".json").c_str());
+
     filename = fileNames[1];
     preSafetyShieldingExpression = std::shared_ptr<storm::logic::ShieldExpression>(new storm::logic::ShieldExpression(typePreSafety, comparisonAbsolute, value08));
     tasks[1].setShieldingExpression(preSafetyShieldingExpression);
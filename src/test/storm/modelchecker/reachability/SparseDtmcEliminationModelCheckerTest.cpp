@@ -11,6 +11,41 @@
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm/settings/modules/EliminationSettings.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/solver/stateelimination/StatePriorityQueue.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/stateelimination.h"
+#include "storm/utility/vector.h"
+
+namespace {
+    // Computes the probabilities to reach the given label by eliminating all maybe states in the given order.
+    std::vector<double> computeReachabilityProbabilitiesByElimination(storm::models::sparse::Dtmc<double> const& dtmc, std::string const& targetLabel, storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
+        storm::storage::SparseMatrix<double> const& transitionMatrix = dtmc.getTransitionMatrix();
+        storm::storage::BitVector phiStates(dtmc.getNumberOfStates(), true);
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(dtmc.getBackwardTransitions(), phiStates, dtmc.getStates(targetLabel));
+        storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+
+        std::vector<double> values = transitionMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+        storm::storage::SparseMatrix<double> submatrix = transitionMatrix.getSubmatrix(false, maybeStates, maybeStates);
+        storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(submatrix);
+        storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(submatrix.transpose());
+
+        // The forward transitions are kept, so the values of all states are computed.
+        storm::storage::BitVector subsystem(maybeStates.getNumberOfSetBits(), true);
+        std::shared_ptr<storm::solver::stateelimination::StatePriorityQueue> priorityQueue = storm::utility::stateelimination::createStatePriorityQueue<double>(order, boost::none, flexibleMatrix, flexibleBackwardTransitions, values, subsystem);
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> stateEliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, values);
+        while (priorityQueue->hasNext()) {
+            stateEliminator.eliminateState(priorityQueue->pop(), false);
+        }
+
+        std::vector<double> result(dtmc.getNumberOfStates(), 0.0);
+        storm::utility::vector::setVectorValues(result, maybeStates, values);
+        storm::utility::vector::setVectorValues(result, statesWithProbability01.second, 1.0);
+        return result;
+    }
+}
 
 TEST(SparseDtmcEliminationModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", STORM_TEST_RESOURCES_DIR "/rew/die.coin_flips.trans.rew");
@@ -135,3 +170,18 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(SparseDtmcEliminationModelCheckerTest, DynamicFillInOrder) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    // The fill-in order yields the same probabilities as the dynamic penalty order.
+    std::vector<double> fillInResult = computeReachabilityProbabilitiesByElimination(*dtmc, "observe0Greater1", storm::settings::modules::EliminationSettings::EliminationOrder::DynamicFillIn);
+    std::vector<double> penaltyResult = computeReachabilityProbabilitiesByElimination(*dtmc, "observe0Greater1", storm::settings::modules::EliminationSettings::EliminationOrder::DynamicPenalty);
+    ASSERT_EQ(penaltyResult.size(), fillInResult.size());
+    for (uint_fast64_t state = 0; state < fillInResult.size(); ++state) {
+        EXPECT_NEAR(penaltyResult[state], fillInResult[state], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+    }
+    EXPECT_NEAR(0.3328800375801578281, fillInResult[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
@@ -12,12 +12,15 @@
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
+#include "storm/shields/PreShield.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/logic/Formulas.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace {
     class DoubleViEnvironment {
@@ -325,5 +328,109 @@ namespace {
         EXPECT_EQ(shieldingString, compareFileString);
     }
 
+    TYPED_TEST(ShieldGenerationSmgRpatlModelCheckerTest, LtlRightDecision) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<PreSafety, lambda=0.9> <<hiker>> Pmax=? [ F G \"target\" ]";
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/rightDecision.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*smg);
+
+        // A shield for the game can not keep track of the state of the automaton, so shielding LTL objectives is rejected.
+        auto preSafetyShieldingExpression = std::shared_ptr<storm::logic::ShieldExpression>(new storm::logic::ShieldExpression(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+        tasks[0].setShieldingExpression(preSafetyShieldingExpression);
+        EXPECT_TRUE(tasks[0].isShieldingTask());
+        STORM_SILENT_EXPECT_THROW(checker.check(this->env(), tasks[0]), storm::exceptions::NotSupportedException);
+#else
+        GTEST_SKIP();
+#endif
+    }
+
+    TYPED_TEST(ShieldGenerationSmgRpatlModelCheckerTest, AlmostSureChoiceValues) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<<maxer>> Pmax=? [ F \"target\" ]";
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/almostSure.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*smg);
+
+        // With lambda = 0, all choices are allowed, so the shields contain the values of all choices. Without schedulers, the values of the
+        // choices of the states with value 0 or 1 are obtained from the qualitative analysis, with schedulers they are computed numerically.
+        auto preSafetyShieldingExpression = std::shared_ptr<storm::logic::ShieldExpression>(new storm::logic::ShieldExpression(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.0));
+        tasks[0].setShieldingExpression(preSafetyShieldingExpression);
+        auto result = checker.check(this->env(), tasks[0]);
+        ASSERT_TRUE(result->hasShield());
+        tasks[0].setProduceSchedulers(true);
+        auto schedulerResult = checker.check(this->env(), tasks[0]);
+        ASSERT_TRUE(schedulerResult->hasShield());
+
+        auto preShield = std::dynamic_pointer_cast<tempest::shields::PreShield<ValueType, storm::storage::sparse::state_type>>(result->template asExplicitQuantitativeCheckResult<ValueType>().getShield());
+        auto schedulerPreShield = std::dynamic_pointer_cast<tempest::shields::PreShield<ValueType, storm::storage::sparse::state_type>>(schedulerResult->template asExplicitQuantitativeCheckResult<ValueType>().getShield());
+        ASSERT_TRUE(preShield != nullptr);
+        ASSERT_TRUE(schedulerPreShield != nullptr);
+        auto const& shield = preShield->construct();
+        auto const& schedulerShield = schedulerPreShield->construct();
+        for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+            auto const& choices = shield.getChoice(state).getChoiceMap();
+            auto const& schedulerChoices = schedulerShield.getChoice(state).getChoiceMap();
+            ASSERT_EQ(choices.size(), schedulerChoices.size());
+            for (uint_fast64_t index = 0; index < choices.size(); ++index) {
+                EXPECT_NEAR(std::get<0>(choices[index]), std::get<0>(schedulerChoices[index]), 1e-6);
+                EXPECT_EQ(std::get<1>(choices[index]), std::get<1>(schedulerChoices[index]));
+            }
+        }
+
+        // The choice of the start leads to the retry state and to the minimizer, who escapes to the gamble state.
+        uint_fast64_t initialState = *smg->getInitialStates().begin();
+        ASSERT_EQ(1ul, shield.getChoice(initialState).getChoiceMap().size());
+        EXPECT_NEAR(0.75, std::get<0>(shield.getChoice(initialState).getChoiceMap().front()), 1e-6);
+    }
+
+    TYPED_TEST(ShieldGenerationSmgRpatlModelCheckerTest, EndComponentRationalSearch) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<<maxer>> Pmax=? [ F \"target\" ]";
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/endComponent.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*smg);
+
+        auto preSafetyShieldingExpression = std::shared_ptr<storm::logic::ShieldExpression>(new storm::logic::ShieldExpression(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+        tasks[0].setShieldingExpression(preSafetyShieldingExpression);
+        auto result = checker.check(this->env(), tasks[0]);
+        ASSERT_TRUE(result->hasShield());
+        storm::Environment rationalSearchEnv = this->env();
+        rationalSearchEnv.solver().game().setMethod(storm::solver::GameMethod::RationalSearch);
+        auto rationalSearchResult = checker.check(rationalSearchEnv, tasks[0]);
+        ASSERT_TRUE(rationalSearchResult->hasShield());
+
+        // The shield obtained from the solution of the rational search allows the same choices as the shield obtained by value iteration.
+        auto preShield = std::dynamic_pointer_cast<tempest::shields::PreShield<ValueType, storm::storage::sparse::state_type>>(result->template asExplicitQuantitativeCheckResult<ValueType>().getShield());
+        auto rationalSearchPreShield = std::dynamic_pointer_cast<tempest::shields::PreShield<ValueType, storm::storage::sparse::state_type>>(rationalSearchResult->template asExplicitQuantitativeCheckResult<ValueType>().getShield());
+        ASSERT_TRUE(preShield != nullptr);
+        ASSERT_TRUE(rationalSearchPreShield != nullptr);
+        auto const& shield = preShield->construct();
+        auto const& rationalSearchShield = rationalSearchPreShield->construct();
+        for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+            auto const& choices = shield.getChoice(state).getChoiceMap();
+            auto const& rationalSearchChoices = rationalSearchShield.getChoice(state).getChoiceMap();
+            ASSERT_EQ(choices.size(), rationalSearchChoices.size());
+            for (uint_fast64_t index = 0; index < choices.size(); ++index) {
+                EXPECT_NEAR(std::get<0>(choices[index]), std::get<0>(rationalSearchChoices[index]), 1e-6);
+                EXPECT_EQ(std::get<1>(choices[index]), std::get<1>(rationalSearchChoices[index]));
+            }
+        }
+
+        // Waiting at the start does not decrease the value, so both choices of the start are allowed.
+        uint_fast64_t initialState = *smg->getInitialStates().begin();
+        auto const& initialChoices = rationalSearchShield.getChoice(initialState).getChoiceMap();
+        ASSERT_EQ(2ul, initialChoices.size());
+        EXPECT_NEAR(2.0 / 3.0, std::get<0>(initialChoices[0]), 1e-6);
+        EXPECT_NEAR(2.0 / 3.0, std::get<0>(initialChoices[1]), 1e-6);
+    }
+
     // TODO: create more test cases (files)
 }
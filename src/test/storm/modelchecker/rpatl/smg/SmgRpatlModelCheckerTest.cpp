@@ -7,16 +7,23 @@
 #include "storm-parsers/api/properties.h"
 
 #include "storm/models/sparse/Smg.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm-parsers/parser/PrismParser.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/logic/Formulas.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace {
 
@@ -86,6 +93,63 @@ namespace {
         }
     };
 
+    class SparseDoubleRationalSearchEnvironment {
+    public:
+        static const SmgEngine engine = SmgEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Smg<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setMethod(storm::solver::GameMethod::RationalSearch);
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+            return env;
+        }
+    };
+
+    class SparseDoublePolicyIterationEnvironment {
+    public:
+        static const SmgEngine engine = SmgEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Smg<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setMethod(storm::solver::GameMethod::PolicyIteration);
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+    };
+
+    class SparseDoubleMixedPrecisionEnvironment {
+    public:
+        static const SmgEngine engine = SmgEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Smg<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setValuePrecision(storm::solver::ValuePrecision::Mixed);
+            return env;
+        }
+    };
+
+    class SparseDoubleAutomaticPrecisionEnvironment {
+    public:
+        static const SmgEngine engine = SmgEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Smg<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            // Any game exceeds a memory budget of one byte, so mixed precision is selected automatically.
+            env.solver().game().setValuePrecision(storm::solver::ValuePrecision::Automatic);
+            env.solver().setMemoryBudget(boost::optional<uint64_t>(1));
+            return env;
+        }
+    };
+
     template<typename TestType>
     class SmgRpatlModelCheckerTest : public ::testing::Test {
     public:
@@ -153,7 +217,11 @@ namespace {
     SparseDoubleValueIterationGmmxxGaussSeidelMultEnvironment,
     SparseDoubleValueIterationGmmxxRegularMultEnvironment,
     SparseDoubleValueIterationNativeGaussSeidelMultEnvironment,
-    SparseDoubleValueIterationNativeRegularMultEnvironment
+    SparseDoubleValueIterationNativeRegularMultEnvironment,
+    SparseDoubleRationalSearchEnvironment,
+    SparseDoublePolicyIterationEnvironment,
+    SparseDoubleMixedPrecisionEnvironment,
+    SparseDoubleAutomaticPrecisionEnvironment
     > TestingTypes;
 
     TYPED_TEST_SUITE(SmgRpatlModelCheckerTest, TestingTypes,);
@@ -299,6 +367,59 @@ namespace {
         EXPECT_NEAR(this->parseNumber("0"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
     }
 
+    TYPED_TEST(SmgRpatlModelCheckerTest, LtlRightDecision) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+        std::string formulasString = "<<hiker>> Pmax=? [ F G \"target\" ]";
+        formulasString += "; <<hiker>> Pmin=? [ G F \"target\" ]";
+        formulasString += "; <<hiker>> Pmax=? [ (X (shortcut=1)) & (F G \"target\") ]";
+        formulasString += "; <<native>> Pmin=? [ (X (shortcut=1)) & (F G \"target\") ]";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/rightDecision.nm", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        ASSERT_EQ(model->getType(), storm::models::ModelType::Smg);
+        auto checker = this->createModelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+        result = checker->check(this->env(), tasks[0]);
+        EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[1]);
+        EXPECT_NEAR(this->parseNumber("0"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // The native resolves the shortcut in the worse way for the hiker.
+        result = checker->check(this->env(), tasks[2]);
+        EXPECT_NEAR(this->parseNumber("0.9"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // The hiker takes the shortcut, as the formula is violated otherwise.
+        result = checker->check(this->env(), tasks[3]);
+        EXPECT_NEAR(this->parseNumber("0.9"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+#else
+        GTEST_SKIP();
+#endif
+    }
+
+    TYPED_TEST(SmgRpatlModelCheckerTest, LtlAvoidWinningRegion) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+        std::string formulasString = "<<p1>> Pmax=? [ G F \"a\" ]";
+        formulasString += "; <<p1>> Pmin=? [ G F \"a\" ]";
+        formulasString += "; <<p2>> Pmax=? [ G F \"a\" ]";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/avoidWinningRegion.nm", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        ASSERT_EQ(model->getType(), storm::models::ModelType::Smg);
+        auto checker = this->createModelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+        // The value is 1/2, but p2 can loop at the start without reaching the almost surely winning region of p1.
+        STORM_SILENT_EXPECT_THROW(checker->check(this->env(), tasks[0]), storm::exceptions::NotSupportedException);
+        STORM_SILENT_EXPECT_THROW(checker->check(this->env(), tasks[1]), storm::exceptions::NotSupportedException);
+        // By looping, p2 wins surely.
+        result = checker->check(this->env(), tasks[2]);
+        EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+#else
+        GTEST_SKIP();
+#endif
+    }
+
     TYPED_TEST(SmgRpatlModelCheckerTest, RobotCircle) {
         // This test is for testing bounded globally with upper bound and in an interval (with upper and lower bound)
         std::string formulasString = " <<friendlyRobot>> Pmax=? [ G<1 !\"crash\" ]";
@@ -345,5 +466,120 @@ namespace {
         EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
     }
 
+    TYPED_TEST(SmgRpatlModelCheckerTest, AlmostSure) {
+        // The minimizer can leave the states from which the target is reached almost surely, so the value of the start is below 1.
+        std::string formulasString = "<<maxer>> Pmax=? [ F \"target\" ]";
+        formulasString += "; <<miner>> Pmin=? [ F \"target\" ]";
+        formulasString += "; <<maxer>> Pmin=? [ F \"target\" ]";
+        formulasString += "; <<maxer>> Pmax=? [ F \"target\" ]";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/almostSure.nm", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        EXPECT_EQ(6ul, model->getNumberOfStates());
+        EXPECT_EQ(10ul, model->getNumberOfTransitions());
+        EXPECT_EQ(7ul, model->getNumberOfChoices());
+        ASSERT_EQ(model->getType(), storm::models::ModelType::Smg);
+        auto checker = this->createModelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+        result = checker->check(this->env(), tasks[0]);
+        EXPECT_NEAR(this->parseNumber("0.75"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[1]);
+        EXPECT_NEAR(this->parseNumber("0.75"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // If the minimizer of the target is the maxer, the miner goes back to the start until the retry state is reached.
+        result = checker->check(this->env(), tasks[2]);
+        EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // The qualitative analysis is skipped for schedulers, which must not change the result.
+        tasks[3].setProduceSchedulers(true);
+        result = checker->check(this->env(), tasks[3]);
+        EXPECT_NEAR(this->parseNumber("0.75"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+    }
+
+    TEST(SparseSmgRpatlHelperTest, AlmostSureQualitativeAnalysis) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/almostSure.nm");
+        std::shared_ptr<storm::models::sparse::Smg<double>> smg = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build()->as<storm::models::sparse::Smg<double>>();
+        storm::storage::SparseMatrix<double> backwardTransitions = smg->getBackwardTransitions();
+        storm::storage::BitVector phiStates(smg->getNumberOfStates(), true);
+        storm::storage::BitVector psiStates = smg->getStates("target");
+        std::vector<boost::variant<std::string, storm::storage::PlayerIndex>> players = {std::string("maxer")};
+        storm::storage::BitVector maximizerStates = smg->computeStatesOfCoalition(storm::logic::PlayerCoalition(players));
+
+        // Only from the trap, the target can not be reached.
+        storm::storage::BitVector statesWithProbability0 = storm::modelchecker::helper::SparseSmgRpatlHelper<double>::computeProb0States(smg->getTransitionMatrix(), backwardTransitions, phiStates, psiStates, maximizerStates);
+        EXPECT_EQ(smg->getStates("trap"), statesWithProbability0);
+
+        // A single attractor computation within the states with positive value also contains the start, as the maximizer reaches the
+        // retry state with positive probability. As the minimizer can escape to the gamble state from which the trap is reachable, the
+        // start is only removed in the second iteration of the fixpoint.
+        storm::storage::BitVector positiveStates = ~statesWithProbability0;
+        storm::storage::BitVector attractor = storm::modelchecker::helper::SparseSmgRpatlHelper<double>::computePositiveAttractor(smg->getTransitionMatrix(), backwardTransitions, positiveStates & ~psiStates, psiStates, positiveStates, maximizerStates);
+        EXPECT_TRUE(attractor.get(*smg->getInitialStates().begin()));
+        storm::storage::BitVector statesWithProbability1 = storm::modelchecker::helper::SparseSmgRpatlHelper<double>::computeProb1States(smg->getTransitionMatrix(), backwardTransitions, statesWithProbability0, psiStates, maximizerStates);
+        EXPECT_EQ(smg->getStates("target") | smg->getStates("retry"), statesWithProbability1);
+
+        // If the miner maximizes, it can always return to the start, so only the trap and the gamble state have a value below 1.
+        storm::storage::BitVector minerStates = ~maximizerStates;
+        statesWithProbability0 = storm::modelchecker::helper::SparseSmgRpatlHelper<double>::computeProb0States(smg->getTransitionMatrix(), backwardTransitions, phiStates, psiStates, minerStates);
+        EXPECT_EQ(smg->getStates("trap"), statesWithProbability0);
+        statesWithProbability1 = storm::modelchecker::helper::SparseSmgRpatlHelper<double>::computeProb1States(smg->getTransitionMatrix(), backwardTransitions, statesWithProbability0, psiStates, minerStates);
+        EXPECT_EQ(~(smg->getStates("trap") | smg->getStates("gamble")), statesWithProbability1);
+    }
+
+    TYPED_TEST(SmgRpatlModelCheckerTest, EndComponent) {
+        // The start and the miner form an end component, in which the maxer can stay if it minimizes.
+        std::string formulasString = "<<maxer>> Pmax=? [ F \"target\" ]";
+        formulasString += "; <<miner>> Pmin=? [ F \"target\" ]";
+        formulasString += "; <<maxer>> Pmin=? [ F \"target\" ]";
+        formulasString += "; <<miner>> Pmax=? [ F \"target\" ]";
+        formulasString += "; <<maxer>> Pmax=? [ F \"target\" ]";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/endComponent.nm", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        EXPECT_EQ(5ul, model->getNumberOfStates());
+        EXPECT_EQ(9ul, model->getNumberOfTransitions());
+        EXPECT_EQ(7ul, model->getNumberOfChoices());
+        ASSERT_EQ(model->getType(), storm::models::ModelType::Smg);
+        auto checker = this->createModelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+        result = checker->check(this->env(), tasks[0]);
+        EXPECT_NEAR(this->parseNumber("2/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[1]);
+        EXPECT_NEAR(this->parseNumber("2/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[2]);
+        EXPECT_NEAR(this->parseNumber("0"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[3]);
+        EXPECT_NEAR(this->parseNumber("0"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // With schedulers, the end component is not removed by the qualitative analysis.
+        tasks[4].setProduceSchedulers(true);
+        result = checker->check(this->env(), tasks[4]);
+        EXPECT_NEAR(this->parseNumber("2/3"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+    }
+
+    TEST(SmgRpatlModelCheckerExactTest, EndComponent) {
+        // Without a selected game method, exact results are computed by rational search.
+        std::string formulasString = "<<maxer>> Pmax=? [ F \"target\" ]";
+        formulasString += "; <<maxer>> Pmin=? [ F \"target\" ]";
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/endComponent.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->template as<storm::models::sparse::Smg<storm::RationalNumber>>();
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<storm::RationalNumber>> checker(*model);
+        storm::Environment env;
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalNumber>(*formulas[0]));
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("2/3")), result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState]);
+        result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalNumber>(*formulas[1]));
+        EXPECT_EQ(storm::utility::zero<storm::RationalNumber>(), result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState]);
+
+        // The rational search also yields the exact result if schedulers are produced, i.e., if the qualitative analysis is skipped.
+        storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalNumber> schedulerTask(*formulas[0]);
+        schedulerTask.setProduceSchedulers(true);
+        result = checker.check(env, schedulerTask);
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("2/3")), result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initialState]);
+    }
+
     // TODO: create more test cases (files)
 }
@@ -383,3 +383,11 @@ TEST(JaniParser, UnassignedVariablesTest) {
     EXPECT_EQ(2ul, result.first.getNumberOfAutomata());
 }
 
+
+TEST(JaniParser, SkipPropertiesTest) {
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> result;
+    EXPECT_NO_THROW(result = storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/mdp/unassigned-variables.jani", std::vector<std::string>()));
+    EXPECT_EQ(storm::jani::ModelType::MDP, result.first.getModelType());
+    EXPECT_EQ(2ul, result.first.getNumberOfAutomata());
+    EXPECT_TRUE(result.second.empty());
+}
@@ -3,6 +3,9 @@
 #include "storm-config.h"
 #include "storm-parsers/parser/PrismParser.h"
 
+#include <fstream>
+#include <sstream>
+
 TEST(PrismParser, StandardModelTest) {
     storm::prism::Program result;
     EXPECT_NO_THROW(result = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2.nm"));
@@ -218,6 +221,37 @@ TEST(PrismParser, NAryPredicates) {
     EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
 }
 
+TEST(PrismParser, FileAndStringInputTest) {
+    // Parsing a (memory-mapped) file yields the same program as parsing its contents.
+    std::ifstream inputFileStream(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::string fileContent((std::istreambuf_iterator<char>(inputFileStream)), (std::istreambuf_iterator<char>()));
+    storm::prism::Program fromFile = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::prism::Program fromString = storm::parser::PrismParser::parseFromString(fileContent, STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::stringstream fromFileStream, fromStringStream;
+    fromFileStream << fromFile;
+    fromStringStream << fromString;
+    EXPECT_EQ(fromStringStream.str(), fromFileStream.str());
+    EXPECT_EQ(2ul, fromFile.getNumberOfModules());
+    EXPECT_EQ(16ul, fromFile.getNumberOfCommands());
+}
+
+TEST(PrismParser, ByteOrderMarkTest) {
+    // The byte order mark is skipped in both passes of the parser.
+    std::string testInput = "\xEF\xBB\xBF";
+    testInput += R"(dtmc
+    module mod1
+        b : bool;
+        [a] !b -> 0.5: (b'=true) + 0.5: (b'=false);
+        [] b -> 1: true;
+    endmodule)";
+
+    storm::prism::Program result;
+    EXPECT_NO_THROW(result = storm::parser::PrismParser::parseFromString(testInput, "testfile"));
+    EXPECT_EQ(1ul, result.getNumberOfModules());
+    EXPECT_EQ(2ul, result.getModule(0).getNumberOfCommands());
+    EXPECT_EQ(2ul, result.getModule(0).getCommand(0).getNumberOfUpdates());
+}
+
 TEST(PrismParser, IllegalInputTest) {
     std::string testInput =
     R"(ctmc
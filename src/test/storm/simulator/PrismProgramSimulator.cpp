@@ -1,7 +1,9 @@
 #include "test/storm_gtest.h"
 #include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/simulator/PrismProgramBatchSimulator.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/environment/Environment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 TEST(PrismProgramSimulatorTest, KnuthYaoDieTest) {
     storm::Environment env;
@@ -26,3 +28,41 @@ TEST(PrismProgramSimulatorTest, KnuthYaoDieTest) {
     EXPECT_EQ(1ul, rew.size());
     EXPECT_EQ(1.0, rew[0]);
 }
+
+TEST(PrismProgramSimulatorTest, KnuthYaoDieBatchTest) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+    storm::builder::BuilderOptions options;
+    options.setBuildAllRewardModels();
+
+    storm::simulator::DiscreteTimePrismProgramBatchSimulator<double> sim(program, options, 3, 2);
+    EXPECT_EQ(3ul, sim.getBatchSize());
+    EXPECT_EQ(2ul, sim.getObservationSize());
+    EXPECT_EQ(std::vector<int64_t>(6, 0), sim.getObservations());
+    EXPECT_EQ(std::vector<double>(3, 0.0), sim.getRewards());
+    EXPECT_EQ(std::vector<uint8_t>(6, 1), sim.getActionMasks());
+    EXPECT_EQ(std::vector<uint8_t>(3, 0), sim.getSinkStates());
+
+    sim.step({0, 1, 0});
+    for (uint64_t index = 0; index < 3; ++index) {
+        int64_t s = sim.getObservations()[2 * index];
+        EXPECT_TRUE(s == 1 || s == 2);
+        EXPECT_EQ(0, sim.getObservations()[2 * index + 1]);
+        EXPECT_EQ(1u, sim.getActionMasks()[2 * index]);
+        EXPECT_EQ(0u, sim.getActionMasks()[2 * index + 1]);
+    }
+    std::vector<uint64_t> actions = {0, 1, 0};
+    STORM_SILENT_EXPECT_THROW(sim.step(actions), storm::exceptions::InvalidArgumentException);
+
+    // Only allow the last choice, e.g., as a shield would do.
+    sim.resetToInitial();
+    sim.setActionFilter([](storm::simulator::DiscreteTimePrismProgramSimulator<double> const& simulator) {
+        storm::storage::BitVector allowed(simulator.getChoices().size(), false);
+        allowed.set(simulator.getChoices().size() - 1);
+        return allowed;
+    });
+    EXPECT_EQ(std::vector<uint8_t>({0, 1, 0, 1, 0, 1}), sim.getActionMasks());
+    actions = {0, 1, 1};
+    STORM_SILENT_EXPECT_THROW(sim.step(actions), storm::exceptions::InvalidArgumentException);
+    sim.step({1, 1, 1});
+    EXPECT_EQ(std::vector<uint8_t>({1, 0, 1, 0, 1, 0}), sim.getActionMasks());
+}
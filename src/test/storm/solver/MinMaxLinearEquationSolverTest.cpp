@@ -4,6 +4,9 @@
 #include "test/storm_gtest.h"
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/solver/TerminationCondition.h"
+#include "storm/solver/helper/MixedPrecisionValueIterationHelper.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
@@ -24,6 +27,19 @@ namespace {
         }
     };
 
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setValuePrecision(storm::solver::ValuePrecision::Mixed);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+
     class DoubleSoundViEnvironment {
     public:
         typedef double ValueType;
@@ -136,6 +152,7 @@ namespace {
   
     typedef ::testing::Types<
             DoubleViEnvironment,
+            DoubleMixedPrecisionViEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
             DoubleOptimisticViEnvironment,
@@ -175,6 +192,86 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+
+    storm::storage::SparseMatrix<double> buildMixedPrecisionTestMatrix() {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 0.9);
+        return builder.build(2);
+    }
+
+    storm::Environment createMixedPrecisionEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setValuePrecision(storm::solver::ValuePrecision::Mixed);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        return env;
+    }
+
+    TEST(MixedPrecisionValueIterationTest, SolveEquations) {
+        // Without bounds and termination conditions, the equations are solved in mixed precision.
+        storm::storage::SparseMatrix<double> A = buildMixedPrecisionTestMatrix();
+        storm::Environment env = createMixedPrecisionEnvironment();
+        std::vector<double> x(1);
+        std::vector<double> b = {0.099, 0.5};
+
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(0.5, x[0], 1e-6);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.99, x[0], 1e-6);
+    }
+
+    TEST(MixedPrecisionValueIterationTest, CustomTerminationCondition) {
+        // The custom termination condition needs to be checked, so the solver falls back to full precision and stops early.
+        storm::storage::SparseMatrix<double> A = buildMixedPrecisionTestMatrix();
+        storm::Environment env = createMixedPrecisionEnvironment();
+        std::vector<double> x(1);
+        std::vector<double> b = {0.099, 0.5};
+
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setLowerBound(0.0);
+        storm::storage::BitVector filter(1, true);
+        solver->setTerminationCondition(std::make_unique<storm::solver::TerminateIfFilteredExtremumExceedsThreshold<double>>(filter, false, 0.5, false));
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_GE(x[0], 0.5);
+        EXPECT_LT(x[0], 0.9);
+    }
+
+    TEST(MixedPrecisionValueIterationTest, AutomaticSelection) {
+        storm::storage::SparseMatrix<double> A = buildMixedPrecisionTestMatrix();
+        typedef storm::solver::helper::MixedPrecisionValueIterationHelper<double> Helper;
+        boost::optional<uint64_t> noBudget;
+        boost::optional<uint64_t> smallBudget(1);
+        boost::optional<uint64_t> largeBudget(1ull << 30);
+
+        // Without a memory budget, automatic selection keeps full precision.
+        EXPECT_FALSE(Helper::isMixedPrecisionSelected(storm::solver::ValuePrecision::Automatic, noBudget, A, 1));
+        // Mixed precision is only selected if the full-precision solver exceeds the budget.
+        EXPECT_TRUE(Helper::isMixedPrecisionSelected(storm::solver::ValuePrecision::Automatic, smallBudget, A, 1));
+        EXPECT_FALSE(Helper::isMixedPrecisionSelected(storm::solver::ValuePrecision::Automatic, largeBudget, A, 1));
+        // An explicit selection ignores the budget.
+        EXPECT_TRUE(Helper::isMixedPrecisionSelected(storm::solver::ValuePrecision::Mixed, noBudget, A, 1));
+        EXPECT_FALSE(Helper::isMixedPrecisionSelected(storm::solver::ValuePrecision::Full, smallBudget, A, 1));
+
+        // With a budget of one byte, the solver selects mixed precision and still solves the equations.
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setValuePrecision(storm::solver::ValuePrecision::Automatic);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().setMemoryBudget(smallBudget);
+        std::vector<double> x(1);
+        std::vector<double> b = {0.099, 0.5};
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.99, x[0], 1e-6);
+    }
 }
 
 
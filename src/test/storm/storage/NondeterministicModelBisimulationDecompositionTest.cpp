@@ -8,8 +8,15 @@
 
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/shields/PreShield.h"
+
 TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
 
@@ -56,3 +63,91 @@ TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     EXPECT_EQ(26ul, result->getNumberOfTransitions());
     EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
 }
+
+TEST(NondeterministicModelBisimulationDecomposition, RobotCircleGame) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/robotCircle.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Smg);
+    std::shared_ptr<storm::models::sparse::Smg<double>> smg = model->as<storm::models::sparse::Smg<double>>();
+
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<friendlyRobot>> Pmax=? [ G !\"crash\" ]");
+
+    typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>::Options options(*smg, *formula);
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>> bisim(*smg, options);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Smg<double>> quotient;
+    ASSERT_NO_THROW(quotient = bisim.getQuotient());
+
+    EXPECT_EQ(storm::models::ModelType::Smg, quotient->getType());
+    EXPECT_LE(quotient->getNumberOfStates(), smg->getNumberOfStates());
+
+    // Every state is mapped to a quotient state of the same player and every choice to a choice of that state.
+    std::vector<uint_fast64_t> const& stateMapping = bisim.getQuotientStateMapping();
+    std::vector<uint_fast64_t> const& choiceMapping = bisim.getQuotientChoiceMapping();
+    ASSERT_EQ(smg->getNumberOfStates(), stateMapping.size());
+    ASSERT_EQ(smg->getNumberOfChoices(), choiceMapping.size());
+    auto const& rowGroupIndices = smg->getTransitionMatrix().getRowGroupIndices();
+    auto const& quotientRowGroupIndices = quotient->getTransitionMatrix().getRowGroupIndices();
+    for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+        EXPECT_EQ(smg->getPlayerOfState(state), quotient->getPlayerOfState(stateMapping[state]));
+        EXPECT_EQ(smg->getStateLabeling().getStateHasLabel("crash", state), quotient->getStateLabeling().getStateHasLabel("crash", stateMapping[state]));
+        for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+            EXPECT_LE(quotientRowGroupIndices[stateMapping[state]], choiceMapping[choice]);
+            EXPECT_GT(quotientRowGroupIndices[stateMapping[state] + 1], choiceMapping[choice]);
+        }
+    }
+
+    // The quotient preserves the values of the game.
+    storm::Environment env;
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> checker(*smg);
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> quotientChecker(*quotient);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+    std::unique_ptr<storm::modelchecker::CheckResult> quotientResult = quotientChecker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+    for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[state], quotientResult->asExplicitQuantitativeCheckResult<double>()[stateMapping[state]], 1e-6);
+    }
+}
+
+TEST(NondeterministicModelBisimulationDecomposition, RobotCircleGameLiftedShield) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/robotCircle.nm");
+    std::shared_ptr<storm::models::sparse::Smg<double>> smg = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build()->as<storm::models::sparse::Smg<double>>();
+
+    storm::parser::FormulaParser formulaParser(program);
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<friendlyRobot>> Pmax=? [ G !\"crash\" ]");
+    typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>::Options options(*smg, *formula);
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>> bisim(*smg, options);
+    bisim.computeBisimulationDecomposition();
+    std::shared_ptr<storm::models::sparse::Smg<double>> quotient = bisim.getQuotient();
+
+    // Compute the shield on the game and on the quotient.
+    storm::Environment env;
+    auto shieldingExpression = std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9);
+    storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+    task.setShieldingExpression(shieldingExpression);
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> checker(*smg);
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> quotientChecker(*quotient);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+    std::unique_ptr<storm::modelchecker::CheckResult> quotientResult = quotientChecker.check(env, task);
+    ASSERT_TRUE(result->hasShield());
+    ASSERT_TRUE(quotientResult->hasShield());
+
+    // The lifted shield allows the same choices as the shield of the game.
+    auto liftedShield = quotientResult->asExplicitQuantitativeCheckResult<double>().getShield()->lift(smg->getTransitionMatrix().getRowGroupIndices(), bisim.getQuotientStateMapping(), bisim.getQuotientChoiceMapping());
+    auto preShield = std::dynamic_pointer_cast<tempest::shields::PreShield<double, storm::storage::sparse::state_type>>(result->asExplicitQuantitativeCheckResult<double>().getShield());
+    auto liftedPreShield = dynamic_cast<tempest::shields::PreShield<double, storm::storage::sparse::state_type>*>(liftedShield.get());
+    ASSERT_TRUE(preShield != nullptr);
+    ASSERT_TRUE(liftedPreShield != nullptr);
+    auto const& scheduler = preShield->construct();
+    auto const& liftedScheduler = liftedPreShield->construct();
+    for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+        auto const& choices = scheduler.getChoice(state).getChoiceMap();
+        auto const& liftedChoices = liftedScheduler.getChoice(state).getChoiceMap();
+        ASSERT_EQ(choices.size(), liftedChoices.size());
+        for (uint_fast64_t index = 0; index < choices.size(); ++index) {
+            EXPECT_NEAR(std::get<0>(choices[index]), std::get<0>(liftedChoices[index]), 1e-6);
+            EXPECT_EQ(std::get<1>(choices[index]), std::get<1>(liftedChoices[index]));
+        }
+    }
+}
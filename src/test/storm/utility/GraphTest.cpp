@@ -12,6 +12,7 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/dd.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
@@ -200,6 +201,70 @@ TEST(GraphTest, SymbolicProb01MinMax_Sylvan) {
     }
 }
 
+TEST(GraphTest, SymbolicReachabilityByChaining_Cudd) {
+    // The dice are two modules that move asynchronously, so the transitions are partitioned by the module that moves.
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(program);
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    {
+        // This block is necessary, so the BDDs get disposed before the manager (contained in the model).
+        storm::dd::DdManager<storm::dd::DdType::CUDD> const& manager = model->getManager();
+        storm::dd::Bdd<storm::dd::DdType::CUDD> transitions = model->getQualitativeTransitionMatrix(false);
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> secondDieVariablePairs = {std::make_pair(manager.getMetaVariable("s2"), manager.getMetaVariable("s2'")), std::make_pair(manager.getMetaVariable("d2"), manager.getMetaVariable("d2'"))};
+        storm::dd::Bdd<storm::dd::DdType::CUDD> secondDieUnchanged = manager.getIdentity(secondDieVariablePairs);
+        std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> transitionPartitions = {transitions && secondDieUnchanged, transitions && !secondDieUnchanged};
+        
+        std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> reachableStates = storm::utility::dd::computeReachableStates(model->getInitialStates(), transitions, model->getRowVariables(), model->getColumnVariables());
+        std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> reachableStatesByChaining = storm::utility::dd::computeReachableStatesByChaining(model->getInitialStates(), transitionPartitions, model->getRowVariables(), model->getColumnVariables());
+        EXPECT_EQ(169ull, reachableStates.first.getNonZeroCount());
+        EXPECT_EQ(169ull, reachableStatesByChaining.first.getNonZeroCount());
+        EXPECT_TRUE(reachableStates.first == reachableStatesByChaining.first);
+        EXPECT_TRUE(model->getReachableStates() == reachableStatesByChaining.first);
+        // States found by the first partition are already explored by the second one within the same iteration.
+        EXPECT_LE(reachableStatesByChaining.second, reachableStates.second);
+        
+        // A single partition is the plain BFS.
+        reachableStatesByChaining = storm::utility::dd::computeReachableStatesByChaining(model->getInitialStates(), std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>>({transitions}), model->getRowVariables(), model->getColumnVariables());
+        EXPECT_TRUE(reachableStates.first == reachableStatesByChaining.first);
+        EXPECT_EQ(reachableStates.second, reachableStatesByChaining.second);
+    }
+}
+
+TEST(GraphTest, SymbolicReachabilityByChaining_Sylvan) {
+    // The dice are two modules that move asynchronously, so the transitions are partitioned by the module that moves.
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program);
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    
+    {
+        // This block is necessary, so the BDDs get disposed before the manager (contained in the model).
+        storm::dd::DdManager<storm::dd::DdType::Sylvan> const& manager = model->getManager();
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> transitions = model->getQualitativeTransitionMatrix(false);
+        std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> secondDieVariablePairs = {std::make_pair(manager.getMetaVariable("s2"), manager.getMetaVariable("s2'")), std::make_pair(manager.getMetaVariable("d2"), manager.getMetaVariable("d2'"))};
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> secondDieUnchanged = manager.getIdentity(secondDieVariablePairs);
+        std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> transitionPartitions = {transitions && secondDieUnchanged, transitions && !secondDieUnchanged};
+        
+        std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> reachableStates = storm::utility::dd::computeReachableStates(model->getInitialStates(), transitions, model->getRowVariables(), model->getColumnVariables());
+        std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> reachableStatesByChaining = storm::utility::dd::computeReachableStatesByChaining(model->getInitialStates(), transitionPartitions, model->getRowVariables(), model->getColumnVariables());
+        EXPECT_EQ(169ull, reachableStates.first.getNonZeroCount());
+        EXPECT_EQ(169ull, reachableStatesByChaining.first.getNonZeroCount());
+        EXPECT_TRUE(reachableStates.first == reachableStatesByChaining.first);
+        EXPECT_TRUE(model->getReachableStates() == reachableStatesByChaining.first);
+        // States found by the first partition are already explored by the second one within the same iteration.
+        EXPECT_LE(reachableStatesByChaining.second, reachableStates.second);
+        
+        // A single partition is the plain BFS.
+        reachableStatesByChaining = storm::utility::dd::computeReachableStatesByChaining(model->getInitialStates(), std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>>({transitions}), model->getRowVariables(), model->getColumnVariables());
+        EXPECT_TRUE(reachableStates.first == reachableStatesByChaining.first);
+        EXPECT_EQ(reachableStates.second, reachableStatesByChaining.second);
+    }
+}
+
 #ifdef STORM_HAVE_MSAT
 
 #include "storm/abstraction/MenuGameRefiner.h"
@@ -0,0 +1,68 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <thread>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/profiling.h"
+
+TEST(ProfilingTest, Disabled) {
+    storm::utility::profiling::disable();
+    storm::utility::profiling::reset();
+    {
+        STORM_PROFILE_SCOPE("test.timer");
+        STORM_PROFILE_COUNT("test.counter", 3);
+    }
+    std::stringstream stream;
+    storm::utility::profiling::writeJsonReport(stream);
+    auto report = storm::json<double>::parse(stream.str());
+    EXPECT_TRUE(report["timers"].empty());
+    EXPECT_TRUE(report["counters"].empty());
+}
+
+TEST(ProfilingTest, TimersAndCounters) {
+    storm::utility::profiling::enable();
+    {
+        STORM_PROFILE_PHASE("test phase");
+        for (uint64_t i = 0; i < 5; ++i) {
+            STORM_PROFILE_SCOPE("test.timer");
+            STORM_PROFILE_COUNT("test.counter", 2);
+        }
+        std::thread worker([]() {
+            STORM_PROFILE_SCOPE("test.timer");
+            STORM_PROFILE_COUNT("test.counter", 1);
+        });
+        worker.join();
+    }
+    storm::utility::profiling::disable();
+
+    std::stringstream stream;
+    storm::utility::profiling::writeJsonReport(stream);
+    auto report = storm::json<double>::parse(stream.str());
+    EXPECT_EQ(6ull, report["timers"]["test.timer"]["count"].get<uint64_t>());
+    EXPECT_EQ(11ull, report["counters"]["test.counter"].get<uint64_t>());
+    EXPECT_EQ(2ull, report["threads"].size());
+    ASSERT_EQ(1ull, report["phases"].size());
+    EXPECT_EQ("test phase", report["phases"][0]["name"].get<std::string>());
+    EXPECT_TRUE(report["phases"][0]["finished"].get<bool>());
+}
+
+TEST(ProfilingTest, ChromeTrace) {
+    storm::utility::profiling::enable(true);
+    for (uint64_t i = 0; i < 3; ++i) {
+        STORM_PROFILE_SCOPE("test.trace");
+    }
+    storm::utility::profiling::disable();
+
+    std::stringstream stream;
+    storm::utility::profiling::writeChromeTrace(stream);
+    auto trace = storm::json<double>::parse(stream.str());
+    uint64_t numEvents = 0;
+    for (auto const& event : trace["traceEvents"]) {
+        if (event["name"].get<std::string>() == "test.trace") {
+            EXPECT_EQ("X", event["ph"].get<std::string>());
+            ++numEvents;
+        }
+    }
+    EXPECT_EQ(3ull, numEvents);
+}